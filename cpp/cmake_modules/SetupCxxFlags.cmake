@@ -20,6 +20,8 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 CHECK_CXX_COMPILER_FLAG("-msse3" CXX_SUPPORTS_SSE3)
+CHECK_CXX_COMPILER_FLAG("-mavx2" CXX_SUPPORTS_AVX2)
+CHECK_CXX_COMPILER_FLAG("-mavx512f" CXX_SUPPORTS_AVX512)
 # power compiler flags
 CHECK_CXX_COMPILER_FLAG("-maltivec" CXX_SUPPORTS_ALTIVEC)
 
@@ -212,6 +214,18 @@ if (CXX_SUPPORTS_SSE3 AND ARROW_SSE3)
   set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} -msse3")
 endif()
 
+# AVX2 and AVX-512 are not enabled globally: the flags are only applied to the
+# source files containing the kernels, which are selected at runtime using CpuInfo
+if (CXX_SUPPORTS_AVX2 AND ARROW_AVX2 AND NOT MSVC)
+  add_definitions(-DARROW_HAVE_AVX2)
+  set(ARROW_AVX2_FLAG "-mavx2")
+endif()
+
+if (CXX_SUPPORTS_AVX512 AND ARROW_AVX512 AND NOT MSVC)
+  add_definitions(-DARROW_HAVE_AVX512)
+  set(ARROW_AVX512_FLAG "-mavx512f")
+endif()
+
 if (CXX_SUPPORTS_ALTIVEC AND ARROW_ALTIVEC)
   set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} -maltivec")
 endif()
@@ -0,0 +1,644 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/test-util.h"
+#include "arrow/type.h"
+#include "arrow/util/decimal.h"
+
+#include "orc/OrcFile.hh"
+
+// alias to not interfere with nested orc namespace
+namespace liborc = orc;
+
+namespace arrow {
+namespace adapters {
+namespace orc {
+
+// Exposes a buffer to liborc, to inspect the files written by ORCFileWriter
+class BufferInputStream : public liborc::InputStream {
+ public:
+  explicit BufferInputStream(const std::shared_ptr<Buffer>& buffer) : buffer_(buffer) {}
+
+  uint64_t getLength() const override { return static_cast<uint64_t>(buffer_->size()); }
+
+  uint64_t getNaturalReadSize() const override { return 128 * 1024; }
+
+  void read(void* buf, uint64_t length, uint64_t offset) override {
+    std::memcpy(buf, buffer_->data() + offset, static_cast<size_t>(length));
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("BufferInputStream");
+    return filename;
+  }
+
+ private:
+  std::shared_ptr<Buffer> buffer_;
+};
+
+void WriteOrcTable(const Table& table, const ORCWriterOptions& options,
+                   std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+  std::unique_ptr<ORCFileWriter> writer;
+  ASSERT_OK(ORCFileWriter::Open(table.schema(), sink, options, &writer));
+  ASSERT_OK(writer->Write(table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink->Finish(out));
+}
+
+void ReadOrcTable(const std::shared_ptr<Buffer>& buffer, bool use_threads,
+                  std::shared_ptr<Table>* out) {
+  std::unique_ptr<ORCFileReader> reader;
+  ASSERT_OK(ORCFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                default_memory_pool(), &reader));
+  reader->set_use_threads(use_threads);
+  ASSERT_OK(reader->Read(out));
+}
+
+// Write the table with and without threads and in small batches, and check
+// that it reads back as expected
+void CheckRoundtrip(const Table& table, const Table& expected) {
+  for (bool use_threads : {false, true}) {
+    ORCWriterOptions options = ORCWriterOptions::Defaults();
+    options.use_threads = use_threads;
+    options.batch_size = 7;
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteOrcTable(table, options, &buffer));
+
+    std::shared_ptr<Table> result;
+    ASSERT_NO_FATAL_FAILURE(ReadOrcTable(buffer, use_threads, &result));
+    ASSERT_TRUE(result->schema()->Equals(*expected.schema()))
+        << result->schema()->ToString();
+    ASSERT_NO_FATAL_FAILURE(AssertTablesEqual(expected, *result, false));
+  }
+}
+
+void CheckRoundtrip(const Table& table) { CheckRoundtrip(table, table); }
+
+std::shared_ptr<Table> MakeTable(const std::vector<std::shared_ptr<Array>>& columns) {
+  std::vector<std::shared_ptr<Field>> fields;
+  for (size_t i = 0; i < columns.size(); i++) {
+    fields.push_back(field("c" + std::to_string(i), columns[i]->type()));
+  }
+  return Table::Make(::arrow::schema(fields), columns);
+}
+
+const std::vector<bool> kIsValid = {true,  false, true, true,  true, false, true,
+                                    true,  true,  true, false, true, true,  true,
+                                    false, true,  true, true,  true, true};
+
+TEST(TestOrcWriter, PrimitiveTypes) {
+  const int64_t length = static_cast<int64_t>(kIsValid.size());
+  std::vector<bool> bools;
+  std::vector<int8_t> int8s;
+  std::vector<int16_t> int16s;
+  std::vector<int32_t> int32s, dates;
+  std::vector<int64_t> int64s;
+  std::vector<float> floats;
+  std::vector<double> doubles;
+  std::vector<std::string> strings;
+  for (int64_t i = 0; i < length; i++) {
+    bools.push_back(i % 3 == 0);
+    int8s.push_back(static_cast<int8_t>(i * 13 - 128));
+    int16s.push_back(static_cast<int16_t>(i * 1000 - 10000));
+    int32s.push_back(static_cast<int32_t>(i * 100000 - 1000000));
+    int64s.push_back(i * 10000000000LL - 100000000000LL);
+    floats.push_back(static_cast<float>(i) / 4 - 2);
+    doubles.push_back(static_cast<double>(i) / 3 - 2);
+    strings.push_back(
+        std::string(static_cast<size_t>(i % 5), static_cast<char>('a' + i)));
+    dates.push_back(static_cast<int32_t>(i * 365 - 3650));
+  }
+
+  std::vector<std::shared_ptr<Array>> columns(10);
+  ArrayFromVector<BooleanType, bool>(kIsValid, bools, &columns[0]);
+  ArrayFromVector<Int8Type, int8_t>(kIsValid, int8s, &columns[1]);
+  ArrayFromVector<Int16Type, int16_t>(kIsValid, int16s, &columns[2]);
+  ArrayFromVector<Int32Type, int32_t>(kIsValid, int32s, &columns[3]);
+  ArrayFromVector<Int64Type, int64_t>(kIsValid, int64s, &columns[4]);
+  ArrayFromVector<FloatType, float>(kIsValid, floats, &columns[5]);
+  ArrayFromVector<DoubleType, double>(kIsValid, doubles, &columns[6]);
+  ArrayFromVector<StringType, std::string>(kIsValid, strings, &columns[7]);
+  ArrayFromVector<BinaryType, std::string>(kIsValid, strings, &columns[8]);
+  ArrayFromVector<Date32Type, int32_t>(kIsValid, dates, &columns[9]);
+
+  FixedSizeBinaryBuilder fsb_builder(fixed_size_binary(3));
+  for (int64_t i = 0; i < length; i++) {
+    if (kIsValid[i]) {
+      ASSERT_OK(fsb_builder.Append(std::string(3, static_cast<char>('A' + i)).c_str()));
+    } else {
+      ASSERT_OK(fsb_builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> fsb;
+  ASSERT_OK(fsb_builder.Finish(&fsb));
+  columns.push_back(fsb);
+
+  auto table = MakeTable(columns);
+  CheckRoundtrip(*table);
+
+  // Sliced columns, with bitmaps which don't start on a byte boundary
+  std::vector<std::shared_ptr<Array>> sliced;
+  for (const auto& column : columns) {
+    sliced.push_back(column->Slice(3, 14));
+  }
+  CheckRoundtrip(*MakeTable(sliced));
+}
+
+TEST(TestOrcWriter, AllNullsAndEmpty) {
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int32Type, int32_t>({false, false, false}, {1, 2, 3}, &values);
+  CheckRoundtrip(*MakeTable({values}));
+  CheckRoundtrip(*MakeTable({values->Slice(0, 0)}));
+}
+
+// ORC timestamps are split into seconds and non-negative nanoseconds, and are
+// read back with a nanosecond unit
+TEST(TestOrcWriter, Timestamps) {
+  const std::vector<int64_t> millis = {-1500, -1000, -1, 0, 1, 999, 1000, 1500,
+                                       1546300800123LL, -1546300800123LL};
+  std::vector<int64_t> nanos;
+  for (int64_t value : millis) {
+    nanos.push_back(value * 1000000);
+  }
+  const std::vector<bool> is_valid = {true, true, false, true, true,
+                                      true, true, true,  true, true};
+
+  std::shared_ptr<Array> millis_array, nanos_array, seconds_array, ex_seconds_array;
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), is_valid, millis,
+                                          &millis_array);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::NANO), is_valid, nanos,
+                                          &nanos_array);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::SECOND), is_valid,
+                                          {-3, -2, -1, 0, 1, 2, 3, 4, 5, 6},
+                                          &seconds_array);
+  ArrayFromVector<TimestampType, int64_t>(
+      timestamp(TimeUnit::NANO), is_valid,
+      {-3000000000LL, -2000000000LL, -1000000000LL, 0, 1000000000LL, 2000000000LL,
+       3000000000LL, 4000000000LL, 5000000000LL, 6000000000LL},
+      &ex_seconds_array);
+
+  CheckRoundtrip(*MakeTable({millis_array, seconds_array}),
+                 *MakeTable({nanos_array, ex_seconds_array}));
+  CheckRoundtrip(*MakeTable({nanos_array}));
+  CheckRoundtrip(*MakeTable({millis_array->Slice(1, 8)}),
+                 *MakeTable({nanos_array->Slice(1, 8)}));
+}
+
+// Decimals up to a precision of 18 are written through 64-bit batches, wider
+// ones through 128-bit batches
+TEST(TestOrcWriter, Decimals) {
+  const std::vector<std::string> narrow_values = {
+      "123456789012345.678", "-123456789012345.678", "0.000", "-0.001", "1.000"};
+  const std::vector<std::string> wide_values = {
+      "1234567890123456789012.345", "-1234567890123456789012.345", "0.000",
+      "-0.001", "99999999999999999999999.999"};
+  const std::vector<bool> is_valid = {true, true, false, true, true};
+
+  auto make_decimals = [&is_valid](const std::shared_ptr<DataType>& type,
+                                   const std::vector<std::string>& values,
+                                   std::shared_ptr<Array>* out) {
+    Decimal128Builder builder(type);
+    for (size_t i = 0; i < values.size(); i++) {
+      if (is_valid[i]) {
+        ASSERT_OK(builder.Append(Decimal128(values[i])));
+      } else {
+        ASSERT_OK(builder.AppendNull());
+      }
+    }
+    ASSERT_OK(builder.Finish(out));
+  };
+  std::vector<std::shared_ptr<Array>> columns(2);
+  ASSERT_NO_FATAL_FAILURE(make_decimals(decimal(18, 3), narrow_values, &columns[0]));
+  ASSERT_NO_FATAL_FAILURE(make_decimals(decimal(26, 3), wide_values, &columns[1]));
+  CheckRoundtrip(*MakeTable(columns));
+  CheckRoundtrip(*MakeTable({columns[0]->Slice(1), columns[1]->Slice(1)}));
+}
+
+// The offsets of sliced lists are rebased on the first written value
+TEST(TestOrcWriter, Lists) {
+  std::shared_ptr<Array> offsets, values, lists;
+  ArrayFromVector<Int32Type, int32_t>({true, true, false, true, true, true, true},
+                                      {0, 2, 5, 5, 6, 6, 9}, &offsets);
+  ArrayFromVector<Int32Type, int32_t>(
+      {true, false, true, true, true, true, true, false, true},
+      {1, 2, 3, 4, 5, 6, 7, 8, 9}, &values);
+  ASSERT_OK(ListArray::FromArrays(*offsets, *values, default_memory_pool(), &lists));
+  ASSERT_EQ(1, lists->null_count());
+
+  CheckRoundtrip(*MakeTable({lists}));
+  CheckRoundtrip(*MakeTable({lists->Slice(1, 4)}));
+  CheckRoundtrip(*MakeTable({lists->Slice(3)}));
+
+  // Lists of lists, sliced at both levels
+  std::shared_ptr<Array> outer_offsets, nested;
+  ArrayFromVector<Int32Type, int32_t>({0, 1, 3, 4, 6}, &outer_offsets);
+  ASSERT_OK(ListArray::FromArrays(*outer_offsets, *lists->Slice(0, 6),
+                                  default_memory_pool(), &nested));
+  CheckRoundtrip(*MakeTable({nested}));
+  CheckRoundtrip(*MakeTable({nested->Slice(1, 2)}));
+}
+
+TEST(TestOrcWriter, Structs) {
+  std::shared_ptr<Array> ints, strings;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true, true, true, true},
+                                      {1, 2, 3, 4, 5, 6}, &ints);
+  ArrayFromVector<StringType, std::string>({true, true, true, false, true, true},
+                                           {"a", "bb", "", "dddd", "e", "ff"},
+                                           &strings);
+  auto type = struct_({field("ints", int32()), field("strings", utf8())});
+  auto structs = std::make_shared<StructArray>(
+      type, 6, std::vector<std::shared_ptr<Array>>{ints, strings});
+
+  CheckRoundtrip(*MakeTable({structs}));
+  CheckRoundtrip(*MakeTable({structs->Slice(2, 3)}));
+
+  // Lists of structs
+  std::shared_ptr<Array> offsets, lists;
+  ArrayFromVector<Int32Type, int32_t>({0, 2, 2, 6}, &offsets);
+  ASSERT_OK(ListArray::FromArrays(*offsets, *structs, default_memory_pool(), &lists));
+  CheckRoundtrip(*MakeTable({lists}));
+  CheckRoundtrip(*MakeTable({lists->Slice(1)}));
+}
+
+TEST(TestOrcWriter, ChunkedColumns) {
+  std::shared_ptr<Array> c1, c2;
+  ArrayFromVector<Int64Type, int64_t>({true, false, true}, {1, 2, 3}, &c1);
+  ArrayFromVector<Int64Type, int64_t>({4, 5, 6, 7, 8, 9, 10, 11, 12, 13}, &c2);
+  auto column =
+      std::make_shared<Column>(field("c0", int64()), ArrayVector{c1, c2->Slice(2)});
+  CheckRoundtrip(*Table::Make(::arrow::schema({column->field()}), {column}));
+}
+
+TEST(TestOrcWriter, SchemaMetadata) {
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &values);
+  auto metadata = std::make_shared<KeyValueMetadata>(
+      std::vector<std::string>{"key"}, std::vector<std::string>{"value"});
+  auto table =
+      Table::Make(::arrow::schema({field("c0", int32())}, metadata), {values});
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteOrcTable(*table, ORCWriterOptions::Defaults(), &buffer));
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(ReadOrcTable(buffer, false, &result));
+  ASSERT_TRUE(result->schema()->Equals(*table->schema(), true /* check_metadata */));
+}
+
+TEST(TestOrcWriter, Errors) {
+  std::shared_ptr<Array> ints, strings;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &ints);
+  ArrayFromVector<StringType, std::string>({"a", "b", "c"}, &strings);
+  auto table = MakeTable({ints});
+
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+  std::unique_ptr<ORCFileWriter> writer;
+  ASSERT_OK(ORCFileWriter::Open(table->schema(), sink, ORCWriterOptions::Defaults(),
+                                &writer));
+
+  // Data whose schema differs from the writer schema
+  ASSERT_RAISES(Invalid, writer->Write(*MakeTable({strings})));
+  auto renamed = Table::Make(::arrow::schema({field("other", int32())}), {ints});
+  ASSERT_RAISES(Invalid, writer->Write(*renamed));
+  std::shared_ptr<Array> longs;
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3}, &longs);
+  auto batch = RecordBatch::Make(::arrow::schema({field("c0", int64())}), 3, {longs});
+  ASSERT_RAISES(Invalid, writer->Write(*batch));
+
+  ASSERT_OK(writer->Write(*table));
+  ASSERT_OK(writer->Close());
+  ASSERT_RAISES(Invalid, writer->Write(*table));
+  ASSERT_RAISES(Invalid, writer->Close());
+
+  // Types which can't be written
+  ORCWriterOptions options = ORCWriterOptions::Defaults();
+  ASSERT_RAISES(NotImplemented,
+                ORCFileWriter::Open(::arrow::schema({field("c0", null())}), sink,
+                                    options, &writer));
+  ASSERT_RAISES(NotImplemented,
+                ORCFileWriter::Open(::arrow::schema({field("c0", uint32())}), sink,
+                                    options, &writer));
+  ASSERT_RAISES(NotImplemented,
+                ORCFileWriter::Open(::arrow::schema({field("c0", list(uint8()))}), sink,
+                                    options, &writer));
+
+  options.batch_size = 0;
+  ASSERT_RAISES(Invalid, ORCFileWriter::Open(table->schema(), sink, options, &writer));
+}
+
+TEST(TestOrcWriter, Compression) {
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < 1000; i++) {
+    values.push_back(i % 10);
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(values, &array);
+  auto table = MakeTable({array});
+
+  const std::vector<std::pair<Compression::type, liborc::CompressionKind>> codecs = {
+      {Compression::UNCOMPRESSED, liborc::CompressionKind_NONE},
+      {Compression::GZIP, liborc::CompressionKind_ZLIB},
+      {Compression::SNAPPY, liborc::CompressionKind_SNAPPY},
+      {Compression::LZ4, liborc::CompressionKind_LZ4},
+      {Compression::ZSTD, liborc::CompressionKind_ZSTD}};
+  for (const auto& codec : codecs) {
+    ORCWriterOptions options = ORCWriterOptions::Defaults();
+    options.compression = codec.first;
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteOrcTable(*table, options, &buffer));
+
+    std::unique_ptr<liborc::InputStream> stream(new BufferInputStream(buffer));
+    auto reader = liborc::createReader(std::move(stream), liborc::ReaderOptions());
+    ASSERT_EQ(codec.second, reader->getCompression());
+
+    std::shared_ptr<Table> result;
+    ASSERT_NO_FATAL_FAILURE(ReadOrcTable(buffer, false, &result));
+    ASSERT_NO_FATAL_FAILURE(AssertTablesEqual(*table, *result, false));
+  }
+
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+  std::unique_ptr<ORCFileWriter> writer;
+  for (auto codec : {Compression::LZO, Compression::BROTLI}) {
+    ORCWriterOptions options = ORCWriterOptions::Defaults();
+    options.compression = codec;
+    ASSERT_RAISES(NotImplemented,
+                  ORCFileWriter::Open(table->schema(), sink, options, &writer));
+  }
+}
+
+// Numeric columns covering each ORC numeric kind: LONG and DOUBLE columns,
+// with nulls, without nulls and only nulls, then the narrowed INT, SHORT,
+// BYTE, FLOAT and DATE kinds
+std::vector<std::shared_ptr<Array>> MakeNumericColumns(int64_t length) {
+  std::vector<bool> is_valid, no_nulls, all_nulls;
+  std::vector<int64_t> int64s;
+  std::vector<double> doubles;
+  std::vector<int32_t> int32s, dates;
+  std::vector<int16_t> int16s;
+  std::vector<int8_t> int8s;
+  std::vector<float> floats;
+  for (int64_t i = 0; i < length; i++) {
+    is_valid.push_back(i % 7 != 3);
+    no_nulls.push_back(true);
+    all_nulls.push_back(false);
+    int64s.push_back(i * 1234567891011LL - 617283945505500LL);
+    doubles.push_back(static_cast<double>(i) / 8 - 100);
+    const int32_t offset = static_cast<int32_t>(i);
+    int32s.push_back(i % 2 ? std::numeric_limits<int32_t>::max() - offset
+                           : std::numeric_limits<int32_t>::min() + offset);
+    int16s.push_back(static_cast<int16_t>(i % 2 ? 32767 - i % 1000 : -32768 + i % 1000));
+    int8s.push_back(static_cast<int8_t>(i % 256 - 128));
+    floats.push_back(static_cast<float>(i) / 16 - 30);
+    dates.push_back(static_cast<int32_t>(i * 17 - 8000));
+  }
+
+  std::vector<std::shared_ptr<Array>> columns(9);
+  ArrayFromVector<Int64Type, int64_t>(is_valid, int64s, &columns[0]);
+  ArrayFromVector<DoubleType, double>(is_valid, doubles, &columns[1]);
+  ArrayFromVector<Int64Type, int64_t>(no_nulls, int64s, &columns[2]);
+  ArrayFromVector<DoubleType, double>(all_nulls, doubles, &columns[3]);
+  ArrayFromVector<Int32Type, int32_t>(is_valid, int32s, &columns[4]);
+  ArrayFromVector<Int16Type, int16_t>(is_valid, int16s, &columns[5]);
+  ArrayFromVector<Int8Type, int8_t>(is_valid, int8s, &columns[6]);
+  ArrayFromVector<FloatType, float>(is_valid, floats, &columns[7]);
+  ArrayFromVector<Date32Type, int32_t>(is_valid, dates, &columns[8]);
+  return columns;
+}
+
+// Write the table in batches of kStripeRows rows, each of which ends up in
+// its own stripe
+constexpr int64_t kStripeRows = 100;
+
+void WriteStripedTable(const Table& table, std::shared_ptr<Buffer>* out) {
+  ORCWriterOptions options = ORCWriterOptions::Defaults();
+  options.stripe_size = 1;
+  options.batch_size = kStripeRows;
+  ASSERT_NO_FATAL_FAILURE(WriteOrcTable(table, options, out));
+}
+
+void OpenOrcReader(const std::shared_ptr<Buffer>& buffer, MemoryPool* pool,
+                   std::unique_ptr<ORCFileReader>* out) {
+  ASSERT_OK(ORCFileReader::Open(std::make_shared<io::BufferReader>(buffer), pool, out));
+  ASSERT_GT((*out)->NumberOfStripes(), 1);
+}
+
+// The number of rows in each stripe of the file
+void GetStripeRows(ORCFileReader* reader, std::vector<int64_t>* out) {
+  out->clear();
+  for (int64_t stripe = 0; stripe < reader->NumberOfStripes(); stripe++) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadStripe(stripe, &batch));
+    out->push_back(batch->num_rows());
+  }
+}
+
+TEST(TestOrcReader, NumericColumns) {
+  const int64_t length = 1000;
+  auto table = MakeTable(MakeNumericColumns(length));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteStripedTable(*table, &buffer));
+
+  for (bool use_threads : {false, true}) {
+    std::unique_ptr<ORCFileReader> reader;
+    ASSERT_NO_FATAL_FAILURE(OpenOrcReader(buffer, default_memory_pool(), &reader));
+    ASSERT_EQ(length, reader->NumberOfRows());
+    reader->set_use_threads(use_threads);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader->Read(&result));
+    ASSERT_TRUE(result->schema()->Equals(*table->schema()));
+    ASSERT_NO_FATAL_FAILURE(AssertTablesEqual(*table, *result, false));
+
+    // One chunk per stripe, in file order
+    std::vector<int64_t> stripe_rows;
+    ASSERT_NO_FATAL_FAILURE(GetStripeRows(reader.get(), &stripe_rows));
+    for (int i = 0; i < result->num_columns(); i++) {
+      const auto& chunks = *result->column(i)->data();
+      ASSERT_EQ(reader->NumberOfStripes(), chunks.num_chunks());
+      for (int j = 0; j < chunks.num_chunks(); j++) {
+        ASSERT_EQ(stripe_rows[j], chunks.chunk(j)->length());
+      }
+    }
+
+    // A validity bitmap is only allocated for columns with nulls
+    for (int j = 0; j < result->column(2)->data()->num_chunks(); j++) {
+      ASSERT_EQ(nullptr, result->column(2)->data()->chunk(j)->null_bitmap_data());
+      const auto& all_nulls = result->column(3)->data()->chunk(j);
+      ASSERT_EQ(all_nulls->length(), all_nulls->null_count());
+    }
+  }
+}
+
+// LONG and DOUBLE columns point into the decoded liborc batches, which must
+// outlive the reader
+TEST(TestOrcReader, ZeroCopyNumericColumns) {
+  const int64_t length = 1000;
+  auto columns = MakeNumericColumns(length);
+  auto table = MakeTable({columns[0], columns[1], columns[2]});
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteStripedTable(*table, &buffer));
+
+  ProxyMemoryPool pool(default_memory_pool());
+  std::shared_ptr<Table> result;
+  {
+    std::unique_ptr<ORCFileReader> reader;
+    ASSERT_NO_FATAL_FAILURE(OpenOrcReader(buffer, &pool, &reader));
+    reader->set_use_threads(true);
+    ASSERT_OK(reader->Read(&result));
+  }
+  buffer.reset();
+
+  // Only the validity bitmaps come from the pool
+  ASSERT_LT(pool.bytes_allocated(), length * static_cast<int64_t>(sizeof(int64_t)));
+  ASSERT_NO_FATAL_FAILURE(AssertTablesEqual(*table, *result, false));
+}
+
+// Columns nested in a struct are converted through builders, and must read
+// the same as the top-level columns converted in bulk
+TEST(TestOrcReader, MatchesBuilderPath) {
+  const int64_t length = 1000;
+  auto columns = MakeNumericColumns(length);
+  std::vector<std::shared_ptr<Field>> fields;
+  for (size_t i = 0; i < columns.size(); i++) {
+    fields.push_back(field("f" + std::to_string(i), columns[i]->type()));
+  }
+  auto structs = std::make_shared<StructArray>(struct_(fields), length, columns);
+  auto table = MakeTable({structs});
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteStripedTable(*table, &buffer));
+
+  std::unique_ptr<ORCFileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenOrcReader(buffer, default_memory_pool(), &reader));
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader->Read(&result));
+  ASSERT_NO_FATAL_FAILURE(AssertTablesEqual(*table, *result, false));
+
+  std::shared_ptr<Buffer> flat_buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteStripedTable(*MakeTable(columns), &flat_buffer));
+  std::unique_ptr<ORCFileReader> flat_reader;
+  ASSERT_NO_FATAL_FAILURE(
+      OpenOrcReader(flat_buffer, default_memory_pool(), &flat_reader));
+  std::shared_ptr<Table> flat_result;
+  ASSERT_OK(flat_reader->Read(&flat_result));
+
+  const auto& struct_chunks = *result->column(0)->data();
+  for (size_t i = 0; i < columns.size(); i++) {
+    ArrayVector children;
+    for (int j = 0; j < struct_chunks.num_chunks(); j++) {
+      const auto& chunk = static_cast<const StructArray&>(*struct_chunks.chunk(j));
+      children.push_back(chunk.field(static_cast<int>(i)));
+    }
+    ASSERT_NO_FATAL_FAILURE(AssertChunkedEqual(
+        *flat_result->column(static_cast<int>(i))->data(), children));
+  }
+}
+
+TEST(TestOrcReader, ReadStripe) {
+  const int64_t length = 1000;
+  auto columns = MakeNumericColumns(length);
+  auto table = MakeTable(columns);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteStripedTable(*table, &buffer));
+
+  std::unique_ptr<ORCFileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenOrcReader(buffer, default_memory_pool(), &reader));
+  int64_t offset = 0;
+  for (int64_t stripe = 0; stripe < reader->NumberOfStripes(); stripe++) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadStripe(stripe, &batch));
+    ASSERT_GT(batch->num_rows(), 0);
+    for (int i = 0; i < batch->num_columns(); i++) {
+      ASSERT_ARRAYS_EQUAL(*columns[i]->Slice(offset, batch->num_rows()),
+                          *batch->column(i));
+    }
+    offset += batch->num_rows();
+  }
+  ASSERT_EQ(length, offset);
+}
+
+// The batches of a RecordBatchReader have at most batch_size rows and never
+// span several stripes
+TEST(TestOrcReader, RecordBatchReader) {
+  const int64_t length = 1000;
+  auto table = MakeTable(MakeNumericColumns(length));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteStripedTable(*table, &buffer));
+
+  std::unique_ptr<ORCFileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenOrcReader(buffer, default_memory_pool(), &reader));
+  std::vector<int64_t> stripe_rows;
+  ASSERT_NO_FATAL_FAILURE(GetStripeRows(reader.get(), &stripe_rows));
+
+  for (int64_t batch_size : std::vector<int64_t>{1, 30, kStripeRows, 10 * length}) {
+    std::shared_ptr<RecordBatchReader> batch_reader;
+    ASSERT_OK(reader->GetRecordBatchReader(batch_size, &batch_reader));
+    ASSERT_TRUE(batch_reader->schema()->Equals(*table->schema()));
+
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    size_t stripe = 0;
+    int64_t stripe_remaining = stripe_rows[0];
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      ASSERT_OK(batch_reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ASSERT_GT(batch->num_rows(), 0);
+      ASSERT_LE(batch->num_rows(), batch_size);
+      ASSERT_LT(stripe, stripe_rows.size());
+      ASSERT_LE(batch->num_rows(), stripe_remaining);
+      stripe_remaining -= batch->num_rows();
+      if (stripe_remaining == 0 && ++stripe < stripe_rows.size()) {
+        stripe_remaining = stripe_rows[stripe];
+      }
+      batches.push_back(batch);
+    }
+    ASSERT_EQ(stripe_rows.size(), stripe);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(Table::FromRecordBatches(table->schema(), batches, &result));
+    ASSERT_NO_FATAL_FAILURE(AssertTablesEqual(*table, *result, false));
+  }
+
+  std::shared_ptr<RecordBatchReader> batch_reader;
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchReader(0, &batch_reader));
+}
+
+}  // namespace orc
+}  // namespace adapters
+}  // namespace arrow
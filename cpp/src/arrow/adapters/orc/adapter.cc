@@ -23,6 +23,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -33,7 +34,6 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
-#include "arrow/table_builder.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
@@ -41,6 +41,7 @@
 #include "arrow/util/decimal.h"
 #include "arrow/util/lazy.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
@@ -98,6 +99,17 @@ class ArrowInputFile : public liborc::InputStream {
   std::shared_ptr<io::ReadableFileInterface> file_;
 };
 
+// A buffer pointing into the memory of a liborc batch, which it keeps alive
+class OrcBatchBuffer : public Buffer {
+ public:
+  OrcBatchBuffer(const void* data, int64_t size,
+                 std::shared_ptr<liborc::ColumnVectorBatch> batch)
+      : Buffer(reinterpret_cast<const uint8_t*>(data), size), batch_(std::move(batch)) {}
+
+ private:
+  std::shared_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
 struct StripeInformation {
   uint64_t offset;
   uint64_t length;
@@ -215,15 +227,14 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
-// The number of rows to read in a ColumnVectorBatch
-constexpr int64_t kReadRowsBatch = 1000;
-
 // The numer of nanoseconds in a second
 constexpr int64_t kOneSecondNanos = 1000000000LL;
 
 class ORCFileReader::Impl {
  public:
-  Impl() {}
+  class StripeReader;
+
+  Impl() : use_threads_(false) {}
   ~Impl() {}
 
   Status Open(const std::shared_ptr<io::ReadableFileInterface>& file, MemoryPool* pool) {
@@ -253,6 +264,8 @@ class ORCFileReader::Impl {
     return Status::OK();
   }
 
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
   int64_t NumberOfStripes() { return stripes_.size(); }
 
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
@@ -370,11 +383,21 @@ class ORCFileReader::Impl {
 
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    const std::shared_ptr<Schema>& schema, std::shared_ptr<Table>* out) {
-    liborc::RowReaderOptions opts(row_opts);
     std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
-    for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
+    auto read_stripe = [&row_opts, &schema, &batches, this](int stripe) {
+      liborc::RowReaderOptions opts(row_opts);
       opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]));
+      return ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]);
+    };
+
+    // Each stripe is decoded by its own row reader
+    const int nstripes = static_cast<int>(stripes_.size());
+    if (use_threads_) {
+      RETURN_NOT_OK(internal::ParallelFor(nstripes, read_stripe));
+    } else {
+      for (int stripe = 0; stripe < nstripes; stripe++) {
+        RETURN_NOT_OK(read_stripe(stripe));
+      }
     }
     return Table::FromRecordBatches(schema, batches, out);
   }
@@ -382,28 +405,145 @@ class ORCFileReader::Impl {
   Status ReadBatch(const liborc::RowReaderOptions& opts,
                    const std::shared_ptr<Schema>& schema, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
+    // Decode the whole stripe at once, so that its columns don't need to be
+    // accumulated in builders
     std::unique_ptr<liborc::RowReader> rowreader;
-    std::unique_ptr<liborc::ColumnVectorBatch> batch;
+    std::shared_ptr<liborc::ColumnVectorBatch> batch;
     try {
       rowreader = reader_->createRowReader(opts);
-      batch = rowreader->createRowBatch(std::min(nrows, kReadRowsBatch));
+      batch = rowreader->createRowBatch(nrows);
+      rowreader->next(*batch);
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
     }
-    std::unique_ptr<RecordBatchBuilder> builder;
-    RETURN_NOT_OK(RecordBatchBuilder::Make(schema, pool_, nrows, &builder));
+    if (static_cast<int64_t>(batch->numElements) != nrows) {
+      std::stringstream ss;
+      ss << "Read " << batch->numElements << " rows from an ORC stripe of " << nrows
+         << " rows";
+      return Status::IOError(ss.str());
+    }
+    return ConvertBatch(rowreader->getSelectedType(), schema, batch, out);
+  }
 
-    // The top-level type must be a struct to read into an arrow table
+  Status GetRecordBatchReader(const liborc::RowReaderOptions& opts, int64_t batch_size,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  // Convert the top-level fields of a decoded batch, which must be of the
+  // given struct type
+  Status ConvertBatch(const liborc::Type& type, const std::shared_ptr<Schema>& schema,
+                      const std::shared_ptr<liborc::ColumnVectorBatch>& batch,
+                      std::shared_ptr<RecordBatch>* out) {
     const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
+    const int64_t length = static_cast<int64_t>(batch->numElements);
 
-    const liborc::Type& type = rowreader->getSelectedType();
-    while (rowreader->next(*batch)) {
-      for (int i = 0; i < builder->num_fields(); i++) {
-        RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
-                                  batch->numElements, builder->GetField(i)));
-      }
+    std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+    for (int i = 0; i < schema->num_fields(); i++) {
+      RETURN_NOT_OK(ConvertColumn(type.getSubtype(i), schema->field(i)->type(),
+                                  struct_batch.fields[i], length, batch, &columns[i]));
+    }
+    *out = RecordBatch::Make(schema, length, std::move(columns));
+    return Status::OK();
+  }
+
+  // Convert a top-level column. The buffers of same-width numeric columns
+  // are shared with the batch (which owns the column), other primitive
+  // columns are converted in a single pass, and the remaining types go
+  // through builders.
+  Status ConvertColumn(const liborc::Type* type,
+                       const std::shared_ptr<DataType>& out_type,
+                       liborc::ColumnVectorBatch* column, int64_t length,
+                       const std::shared_ptr<liborc::ColumnVectorBatch>& batch,
+                       std::shared_ptr<Array>* out) {
+    if (type == nullptr) {
+      *out = std::make_shared<NullArray>(length);
+      return Status::OK();
+    }
+    switch (type->getKind()) {
+      case liborc::LONG:
+        return ShareNumericColumn<liborc::LongVectorBatch>(out_type, column, length,
+                                                           batch, out);
+      case liborc::DOUBLE:
+        return ShareNumericColumn<liborc::DoubleVectorBatch>(out_type, column, length,
+                                                             batch, out);
+      case liborc::INT:
+      case liborc::DATE:
+        return ConvertNumericColumn<int32_t, liborc::LongVectorBatch>(
+            out_type, column, length, out);
+      case liborc::SHORT:
+        return ConvertNumericColumn<int16_t, liborc::LongVectorBatch>(
+            out_type, column, length, out);
+      case liborc::BYTE:
+        return ConvertNumericColumn<int8_t, liborc::LongVectorBatch>(out_type, column,
+                                                                    length, out);
+      case liborc::FLOAT:
+        return ConvertNumericColumn<float, liborc::DoubleVectorBatch>(
+            out_type, column, length, out);
+      default:
+        break;
+    }
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(pool_, out_type, &builder));
+    RETURN_NOT_OK(builder->Reserve(length));
+    RETURN_NOT_OK(AppendBatch(type, column, 0, length, builder.get()));
+    return builder->Finish(out);
+  }
+
+  // Convert the not-null bytes of a column to a validity bitmap, if it has
+  // any nulls
+  Status ConvertValidity(const liborc::ColumnVectorBatch& column, int64_t length,
+                         std::shared_ptr<Buffer>* out, int64_t* null_count) {
+    *null_count = 0;
+    if (!column.hasNulls) {
+      return Status::OK();
     }
-    RETURN_NOT_OK(builder->Flush(out));
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, length, out));
+    const char* not_null = column.notNull.data();
+    int64_t nulls = 0;
+    internal::GenerateBitsUnrolled((*out)->mutable_data(), 0, length,
+                                   [&not_null, &nulls]() {
+                                     const bool valid = *not_null++ != 0;
+                                     nulls += !valid;
+                                     return valid;
+                                   });
+    *null_count = nulls;
+    return Status::OK();
+  }
+
+  template <class batch_type>
+  Status ShareNumericColumn(const std::shared_ptr<DataType>& out_type,
+                            liborc::ColumnVectorBatch* cbatch, int64_t length,
+                            const std::shared_ptr<liborc::ColumnVectorBatch>& batch,
+                            std::shared_ptr<Array>* out) {
+    auto column = checked_cast<batch_type*>(cbatch);
+    using elem_type = typename std::decay<decltype(*column->data.data())>::type;
+
+    std::shared_ptr<Buffer> validity;
+    int64_t null_count;
+    RETURN_NOT_OK(ConvertValidity(*column, length, &validity, &null_count));
+    auto values = std::make_shared<OrcBatchBuffer>(
+        column->data.data(), length * static_cast<int64_t>(sizeof(elem_type)), batch);
+    *out = MakeArray(ArrayData::Make(out_type, length, {validity, values}, null_count));
+    return Status::OK();
+  }
+
+  template <class target_type, class batch_type>
+  Status ConvertNumericColumn(const std::shared_ptr<DataType>& out_type,
+                              liborc::ColumnVectorBatch* cbatch, int64_t length,
+                              std::shared_ptr<Array>* out) {
+    auto column = checked_cast<batch_type*>(cbatch);
+
+    std::shared_ptr<Buffer> validity;
+    int64_t null_count;
+    RETURN_NOT_OK(ConvertValidity(*column, length, &validity, &null_count));
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(AllocateBuffer(
+        pool_, length * static_cast<int64_t>(sizeof(target_type)), &values));
+    auto target = reinterpret_cast<target_type*>(values->mutable_data());
+    const auto source = column->data.data();
+    for (int64_t i = 0; i < length; i++) {
+      target[i] = static_cast<target_type>(source[i]);
+    }
+    *out = MakeArray(ArrayData::Make(out_type, length, {validity, values}, null_count));
     return Status::OK();
   }
 
@@ -627,12 +767,20 @@ class ORCFileReader::Impl {
     auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
 
     const bool has_nulls = batch->hasNulls;
+    int64_t data_length = 0;
+    for (int64_t i = offset; i < length + offset; i++) {
+      if (!has_nulls || batch->notNull[i]) {
+        data_length += batch->length[i];
+      }
+    }
+    RETURN_NOT_OK(builder->Reserve(length));
+    RETURN_NOT_OK(builder->ReserveData(data_length));
+
     for (int64_t i = offset; i < length + offset; i++) {
       if (!has_nulls || batch->notNull[i]) {
-        RETURN_NOT_OK(
-            builder->Append(batch->data[i], static_cast<int32_t>(batch->length[i])));
+        builder->UnsafeAppend(batch->data[i], static_cast<int32_t>(batch->length[i]));
       } else {
-        RETURN_NOT_OK(builder->AppendNull());
+        builder->UnsafeAppendNull();
       }
     }
     return Status::OK();
@@ -686,8 +834,63 @@ class ORCFileReader::Impl {
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
+  bool use_threads_;
+};
+
+// Reads the rows of a file in record batches of a bounded size. Each batch
+// is decoded into a fresh liborc batch, whose numeric buffers can then be
+// shared with the returned record batch.
+class ORCFileReader::Impl::StripeReader : public RecordBatchReader {
+ public:
+  StripeReader(std::unique_ptr<liborc::RowReader> row_reader,
+               std::shared_ptr<Schema> schema, int64_t batch_size,
+               ORCFileReader::Impl* impl)
+      : row_reader_(std::move(row_reader)),
+        schema_(std::move(schema)),
+        batch_size_(batch_size),
+        impl_(impl) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::shared_ptr<liborc::ColumnVectorBatch> batch;
+    try {
+      batch = row_reader_->createRowBatch(batch_size_);
+      if (!row_reader_->next(*batch)) {
+        *out = nullptr;
+        return Status::OK();
+      }
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    return impl_->ConvertBatch(row_reader_->getSelectedType(), schema_, batch, out);
+  }
+
+ private:
+  std::unique_ptr<liborc::RowReader> row_reader_;
+  std::shared_ptr<Schema> schema_;
+  int64_t batch_size_;
+  ORCFileReader::Impl* impl_;
 };
 
+Status ORCFileReader::Impl::GetRecordBatchReader(
+    const liborc::RowReaderOptions& opts, int64_t batch_size,
+    std::shared_ptr<RecordBatchReader>* out) {
+  if (batch_size <= 0) {
+    return Status::Invalid("Batch size must be positive");
+  }
+  std::unique_ptr<liborc::RowReader> row_reader;
+  try {
+    row_reader = reader_->createRowReader(opts);
+  } catch (const liborc::ParseError& e) {
+    return Status::Invalid(e.what());
+  }
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(GetArrowSchema(row_reader->getSelectedType(), &schema));
+  *out = std::make_shared<StripeReader>(std::move(row_reader), schema, batch_size, this);
+  return Status::OK();
+}
+
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
 
 ORCFileReader::~ORCFileReader() {}
@@ -731,10 +934,511 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::GetRecordBatchReader(int64_t batch_size,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  liborc::RowReaderOptions opts;
+  return impl_->GetRecordBatchReader(opts, batch_size, out);
+}
+
+Status ORCFileReader::GetRecordBatchReader(int64_t batch_size,
+                                           const std::vector<int>& include_indices,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  liborc::RowReaderOptions opts;
+  RETURN_NOT_OK(impl_->SelectIndices(&opts, include_indices));
+  return impl_->GetRecordBatchReader(opts, batch_size, out);
+}
+
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+// ----------------------------------------------------------------------
+// ORC file writer
+
+ORCWriterOptions ORCWriterOptions::Defaults() { return ORCWriterOptions(); }
+
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(const std::shared_ptr<io::OutputStream>& sink)
+      : sink_(sink), length_(0) {}
+
+  uint64_t getLength() const override { return static_cast<uint64_t>(length_); }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(sink_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<int64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  // The sink is closed by its owner
+  void close() override {}
+
+ private:
+  std::shared_ptr<io::OutputStream> sink_;
+  int64_t length_;
+};
+
+Status GetOrcType(const DataType& type, std::unique_ptr<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::FIXED_SIZE_BINARY: {
+      const auto& fw_type = checked_cast<const FixedSizeBinaryType&>(type);
+      *out = liborc::createCharType(liborc::CHAR, fw_type.byte_width());
+      break;
+    }
+    case Type::DATE32:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(decimal_type.precision(), decimal_type.scale());
+      break;
+    }
+    case Type::LIST: {
+      const auto& list_type = checked_cast<const ListType&>(type);
+      std::unique_ptr<liborc::Type> elemtype;
+      RETURN_NOT_OK(GetOrcType(*list_type.value_type(), &elemtype));
+      *out = liborc::createListType(std::move(elemtype));
+      break;
+    }
+    case Type::STRUCT: {
+      *out = liborc::createStructType();
+      for (const auto& child : type.children()) {
+        std::unique_ptr<liborc::Type> elemtype;
+        RETURN_NOT_OK(GetOrcType(*child->type(), &elemtype));
+        (*out)->addStructField(child->name(), std::move(elemtype));
+      }
+      break;
+    }
+    default: {
+      std::stringstream ss;
+      ss << "Cannot write Arrow type to ORC: " << type.ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+Status GetOrcCompression(Compression::type compression, liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::NotImplemented("Compression not supported by the ORC writer");
+  }
+  return Status::OK();
+}
+
+// Copies slices of Arrow arrays into liborc batches. The values are copied
+// in bulk wherever the representations agree; string and binary values are
+// not copied at all, the batch points into the Arrow buffers.
+class BatchFiller {
+ public:
+  // Fill batch with rows [offset, offset + length) of array
+  static Status Fill(const Array& array, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* batch) {
+    if (batch->capacity < static_cast<uint64_t>(length)) {
+      batch->resize(length);
+    }
+    FillValidity(array, offset, length, batch);
+
+    switch (array.type_id()) {
+      case Type::BOOL:
+        return FillBool(array, offset, length, batch);
+      case Type::INT8:
+        return FillNumeric<Int8Type, liborc::LongVectorBatch>(array, offset, length,
+                                                              batch);
+      case Type::INT16:
+        return FillNumeric<Int16Type, liborc::LongVectorBatch>(array, offset, length,
+                                                               batch);
+      case Type::INT32:
+        return FillNumeric<Int32Type, liborc::LongVectorBatch>(array, offset, length,
+                                                               batch);
+      case Type::INT64:
+        return FillNumeric<Int64Type, liborc::LongVectorBatch>(array, offset, length,
+                                                               batch);
+      case Type::DATE32:
+        return FillNumeric<Date32Type, liborc::LongVectorBatch>(array, offset, length,
+                                                                batch);
+      case Type::FLOAT:
+        return FillNumeric<FloatType, liborc::DoubleVectorBatch>(array, offset, length,
+                                                                 batch);
+      case Type::DOUBLE:
+        return FillNumeric<DoubleType, liborc::DoubleVectorBatch>(array, offset, length,
+                                                                  batch);
+      case Type::STRING:
+      case Type::BINARY:
+        return FillBinary(array, offset, length, batch);
+      case Type::FIXED_SIZE_BINARY:
+        return FillFixedSizeBinary(array, offset, length, batch);
+      case Type::TIMESTAMP:
+        return FillTimestamp(array, offset, length, batch);
+      case Type::DECIMAL:
+        return FillDecimal(array, offset, length, batch);
+      case Type::LIST:
+        return FillList(array, offset, length, batch);
+      case Type::STRUCT:
+        return FillStruct(array, offset, length, batch);
+      default: {
+        std::stringstream ss;
+        ss << "Cannot write Arrow type to ORC: " << array.type()->ToString();
+        return Status::NotImplemented(ss.str());
+      }
+    }
+  }
+
+ private:
+  static void FillValidity(const Array& array, int64_t offset, int64_t length,
+                           liborc::ColumnVectorBatch* batch) {
+    batch->numElements = length;
+    batch->hasNulls = array.null_count() > 0;
+    if (batch->hasNulls) {
+      char* not_null = batch->notNull.data();
+      internal::BitmapReader reader(array.null_bitmap_data(), array.offset() + offset,
+                                    length);
+      for (int64_t i = 0; i < length; i++) {
+        not_null[i] = reader.IsSet();
+        reader.Next();
+      }
+    }
+  }
+
+  static Status FillBool(const Array& array, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch) {
+    const auto& bool_array = checked_cast<const BooleanArray&>(array);
+    auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+    int64_t* target = batch->data.data();
+    internal::BitmapReader reader(bool_array.values()->data(),
+                                  bool_array.offset() + offset, length);
+    for (int64_t i = 0; i < length; i++) {
+      target[i] = reader.IsSet();
+      reader.Next();
+    }
+    return Status::OK();
+  }
+
+  // A plain copy when the types have the same width, a widening copy else
+  template <class arrow_type, class batch_type>
+  static Status FillNumeric(const Array& array, int64_t offset, int64_t length,
+                            liborc::ColumnVectorBatch* cbatch) {
+    using ArrayType = typename TypeTraits<arrow_type>::ArrayType;
+    const auto source = checked_cast<const ArrayType&>(array).raw_values() + offset;
+    auto batch = checked_cast<batch_type*>(cbatch);
+    std::copy(source, source + length, batch->data.data());
+    return Status::OK();
+  }
+
+  static Status FillBinary(const Array& array, int64_t offset, int64_t length,
+                           liborc::ColumnVectorBatch* cbatch) {
+    const auto& binary_array = checked_cast<const BinaryArray&>(array);
+    auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+    for (int64_t i = 0; i < length; i++) {
+      int32_t value_length;
+      const uint8_t* value = binary_array.GetValue(offset + i, &value_length);
+      batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+      batch->length[i] = value_length;
+    }
+    return Status::OK();
+  }
+
+  static Status FillFixedSizeBinary(const Array& array, int64_t offset, int64_t length,
+                                    liborc::ColumnVectorBatch* cbatch) {
+    const auto& fw_array = checked_cast<const FixedSizeBinaryArray&>(array);
+    auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+    const int32_t byte_width = fw_array.byte_width();
+    for (int64_t i = 0; i < length; i++) {
+      const uint8_t* value = fw_array.GetValue(offset + i);
+      batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+      batch->length[i] = byte_width;
+    }
+    return Status::OK();
+  }
+
+  // ORC timestamps are made of seconds and non-negative nanoseconds
+  static Status FillTimestamp(const Array& array, int64_t offset, int64_t length,
+                              liborc::ColumnVectorBatch* cbatch) {
+    const auto& ts_array = checked_cast<const TimestampArray&>(array);
+    const auto& ts_type = checked_cast<const TimestampType&>(*array.type());
+    auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+
+    int64_t units_per_second = 1;
+    switch (ts_type.unit()) {
+      case TimeUnit::SECOND:
+        break;
+      case TimeUnit::MILLI:
+        units_per_second = 1000;
+        break;
+      case TimeUnit::MICRO:
+        units_per_second = 1000000;
+        break;
+      case TimeUnit::NANO:
+        units_per_second = kOneSecondNanos;
+        break;
+    }
+    const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+
+    const int64_t* source = ts_array.raw_values() + offset;
+    int64_t* seconds = batch->data.data();
+    int64_t* nanos = batch->nanoseconds.data();
+    for (int64_t i = 0; i < length; i++) {
+      int64_t value_seconds = source[i] / units_per_second;
+      int64_t value_units = source[i] % units_per_second;
+      if (value_units < 0) {
+        value_seconds -= 1;
+        value_units += units_per_second;
+      }
+      seconds[i] = value_seconds;
+      nanos[i] = value_units * nanos_per_unit;
+    }
+    return Status::OK();
+  }
+
+  static Status FillDecimal(const Array& array, int64_t offset, int64_t length,
+                            liborc::ColumnVectorBatch* cbatch) {
+    const auto& decimal_array = checked_cast<const Decimal128Array&>(array);
+    const auto& decimal_type = checked_cast<const Decimal128Type&>(*array.type());
+
+    // liborc uses 64-bit decimals up to a precision of 18
+    if (decimal_type.precision() <= 18) {
+      auto batch = checked_cast<liborc::Decimal64VectorBatch*>(cbatch);
+      for (int64_t i = 0; i < length; i++) {
+        const Decimal128 value(decimal_array.GetValue(offset + i));
+        batch->values[i] = static_cast<int64_t>(value.low_bits());
+      }
+    } else {
+      auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+      for (int64_t i = 0; i < length; i++) {
+        const Decimal128 value(decimal_array.GetValue(offset + i));
+        batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+      }
+    }
+    return Status::OK();
+  }
+
+  static Status FillList(const Array& array, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch) {
+    const auto& list_array = checked_cast<const ListArray&>(array);
+    auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+
+    const int32_t* value_offsets = list_array.raw_value_offsets() + offset;
+    const int32_t values_offset = value_offsets[0];
+    int64_t* target = batch->offsets.data();
+    for (int64_t i = 0; i <= length; i++) {
+      target[i] = value_offsets[i] - values_offset;
+    }
+    const int64_t values_length = value_offsets[length] - values_offset;
+    return Fill(*list_array.values(), values_offset, values_length,
+                batch->elements.get());
+  }
+
+  static Status FillStruct(const Array& array, int64_t offset, int64_t length,
+                           liborc::ColumnVectorBatch* cbatch) {
+    const auto& struct_array = checked_cast<const StructArray&>(array);
+    auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+    for (int i = 0; i < struct_array.num_fields(); i++) {
+      RETURN_NOT_OK(Fill(*struct_array.field(i), offset, length, batch->fields[i]));
+    }
+    return Status::OK();
+  }
+};
+
+class ORCFileWriter::Impl {
+ public:
+  Impl() : closed_(false) {}
+
+  Status Open(const std::shared_ptr<Schema>& schema,
+              const std::shared_ptr<io::OutputStream>& sink,
+              const ORCWriterOptions& options) {
+    if (options.batch_size <= 0) {
+      return Status::Invalid("Batch size must be positive");
+    }
+    std::unique_ptr<liborc::Type> type = liborc::createStructType();
+    for (const auto& field : schema->fields()) {
+      std::unique_ptr<liborc::Type> field_type;
+      RETURN_NOT_OK(GetOrcType(*field->type(), &field_type));
+      type->addStructField(field->name(), std::move(field_type));
+    }
+
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetOrcCompression(options.compression, &compression));
+    liborc::WriterOptions writer_options;
+    writer_options.setStripeSize(options.stripe_size);
+    writer_options.setCompression(compression);
+    writer_options.setCompressionBlockSize(options.compression_block_size);
+
+    schema_ = schema;
+    options_ = options;
+    type_ = std::move(type);
+    stream_.reset(new ArrowOutputStream(sink));
+    try {
+      writer_ = liborc::createWriter(*type_, stream_.get(), writer_options);
+      const auto& metadata = schema->metadata();
+      if (metadata != nullptr) {
+        for (int64_t i = 0; i < metadata->size(); i++) {
+          writer_->addUserMetadata(metadata->key(i), metadata->value(i));
+        }
+      }
+      batch_ = writer_->createRowBatch(options.batch_size);
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    RETURN_NOT_OK(CheckSchema(*table.schema()));
+    TableBatchReader reader(table);
+    reader.set_chunksize(options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+  }
+
+  Status Write(const RecordBatch& batch) {
+    RETURN_NOT_OK(CheckSchema(*batch.schema()));
+    auto& root = checked_cast<liborc::StructVectorBatch&>(*batch_);
+    const int num_columns = batch.num_columns();
+
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length = std::min(options_.batch_size, batch.num_rows() - offset);
+      auto fill_column = [&batch, &root, offset, length](int i) {
+        return BatchFiller::Fill(*batch.column(i), offset, length, root.fields[i]);
+      };
+      if (options_.use_threads) {
+        RETURN_NOT_OK(internal::ParallelFor(num_columns, fill_column));
+      } else {
+        for (int i = 0; i < num_columns; i++) {
+          RETURN_NOT_OK(fill_column(i));
+        }
+      }
+      root.numElements = length;
+      try {
+        writer_->add(root);
+      } catch (const std::exception& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    RETURN_NOT_OK(CheckOpen());
+    closed_ = true;
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status CheckOpen() {
+    if (closed_) {
+      return Status::Invalid("ORC writer is closed");
+    }
+    return Status::OK();
+  }
+
+  Status CheckSchema(const Schema& schema) {
+    RETURN_NOT_OK(CheckOpen());
+    if (!schema.Equals(*schema_, false /* check_metadata */)) {
+      std::stringstream ss;
+      ss << "Schema of the data to write:\n"
+         << schema.ToString() << "\ndoes not match the schema of the ORC writer:\n"
+         << schema_->ToString();
+      return Status::Invalid(ss.str());
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  ORCWriterOptions options_;
+  // The writer refers to its type and stream, which must outlive it
+  std::unique_ptr<liborc::Type> type_;
+  std::unique_ptr<ArrowOutputStream> stream_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+  bool closed_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           const std::shared_ptr<io::OutputStream>& sink,
+                           const ORCWriterOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, sink, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
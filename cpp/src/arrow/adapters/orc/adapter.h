@@ -27,6 +27,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -102,6 +103,33 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Return a RecordBatchReader over the rows of the file
+  ///
+  /// The record batches have at most batch_size rows and never span several
+  /// stripes. The reader must not outlive this ORCFileReader.
+  ///
+  /// \param[in] batch_size the maximum number of rows in a record batch
+  /// \param[out] out the returned RecordBatchReader
+  Status GetRecordBatchReader(int64_t batch_size,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Return a RecordBatchReader over the rows of the file
+  ///
+  /// The record batches have at most batch_size rows and never span several
+  /// stripes. The reader must not outlive this ORCFileReader.
+  ///
+  /// \param[in] batch_size the maximum number of rows in a record batch
+  /// \param[in] include_indices the selected field indices to read
+  /// \param[out] out the returned RecordBatchReader
+  Status GetRecordBatchReader(int64_t batch_size, const std::vector<int>& include_indices,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Set whether to decode the stripes of a Table read in parallel
+  ///
+  /// The stripes are decoded on the CPU thread pool. By default only one
+  /// thread is used.
+  void set_use_threads(bool use_threads);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -114,6 +142,63 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+struct ARROW_EXPORT ORCWriterOptions {
+  // Approximate size of the stripes, in bytes
+  int64_t stripe_size = 64 * 1024 * 1024;  // 64 MB
+  // Compression of the stripes; LZO and BROTLI are not supported
+  Compression::type compression = Compression::GZIP;
+  // Size of the compressed blocks, in bytes
+  int64_t compression_block_size = 64 * 1024;  // 64 KB
+  // Number of rows handed to liborc at once
+  int64_t batch_size = 64 * 1024;
+  // Whether to fill the columns of a batch in parallel on the CPU thread pool
+  bool use_threads = false;
+
+  static ORCWriterOptions Defaults();
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow Tables or RecordBatches to an ORC file.
+///
+/// Nested list and struct types are supported. Dictionary-encoded data must
+/// be decoded first.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Create a new ORC writer
+  ///
+  /// The schema metadata is written as ORC user metadata.
+  ///
+  /// \param[in] schema the schema of the data to write
+  /// \param[in] sink the data sink, which is not closed by the writer
+  /// \param[in] options the writer options
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     const std::shared_ptr<io::OutputStream>& sink,
+                     const ORCWriterOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a Table, whose schema must be the writer schema
+  ///
+  /// \param[in] table the Table to write
+  Status Write(const Table& table);
+
+  /// \brief Write a RecordBatch, whose schema must be the writer schema
+  ///
+  /// \param[in] batch the RecordBatch to write
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write the file footer. No data can be written afterwards.
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
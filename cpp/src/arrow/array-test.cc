@@ -1535,11 +1535,175 @@ TEST_F(TestBinaryBuilder, TestCapacityReserve) {
   ASSERT_EQ(640, result_->value_data()->capacity());
 }
 
+TEST_F(TestBinaryBuilder, TestUnsafeAppend) {
+  vector<string> strings = {"", "bb", "a", "", "ccc"};
+  vector<uint8_t> is_null = {0, 0, 0, 1, 0};
+
+  int N = static_cast<int>(strings.size());
+  int reps = 10;
+
+  ASSERT_OK(builder_->Reserve(N * reps));
+  ASSERT_OK(builder_->ReserveData(reps * 6));
+  for (int j = 0; j < reps; ++j) {
+    for (int i = 0; i < N; ++i) {
+      if (is_null[i]) {
+        builder_->UnsafeAppendNull();
+      } else {
+        builder_->UnsafeAppend(strings[i]);
+      }
+    }
+  }
+  Done();
+  ASSERT_EQ(reps * N, result_->length());
+  ASSERT_EQ(reps, result_->null_count());
+  ASSERT_EQ(reps * 6, result_->value_data()->size());
+
+  for (int i = 0; i < N * reps; ++i) {
+    if (is_null[i % N]) {
+      ASSERT_TRUE(result_->IsNull(i));
+    } else {
+      ASSERT_FALSE(result_->IsNull(i));
+      ASSERT_EQ(strings[i % N], result_->GetString(i));
+    }
+  }
+}
+
+TEST_F(TestBinaryBuilder, TestAppendValuesWithOffsets) {
+  // "bb", null, "a", "", " ccc", with offsets not starting at zero
+  const std::string data = "xxbbzza ccc";
+  vector<int32_t> offsets = {2, 4, 6, 7, 7, 11};
+  vector<uint8_t> valid_bytes = {1, 0, 1, 1, 1};
+
+  ASSERT_OK(builder_->Append("dd"));
+  ASSERT_OK(builder_->AppendValues(reinterpret_cast<const uint8_t*>(data.data()),
+                                   offsets.data(), 5, valid_bytes.data()));
+  // Without validity, the trailing values
+  ASSERT_OK(builder_->AppendValues(reinterpret_cast<const uint8_t*>(data.data()),
+                                   offsets.data() + 3, 2));
+  Done();
+
+  ASSERT_EQ(8, result_->length());
+  ASSERT_EQ(1, result_->null_count());
+
+  vector<string> expected = {"dd", "bb", "", "a", "", " ccc", "", " ccc"};
+  for (int64_t i = 0; i < result_->length(); ++i) {
+    if (i == 2) {
+      ASSERT_TRUE(result_->IsNull(i));
+    } else {
+      ASSERT_FALSE(result_->IsNull(i));
+      ASSERT_EQ(expected[i], result_->GetString(i));
+    }
+  }
+}
+
+TEST_F(TestBinaryBuilder, TestAppendValuesOverflow) {
+  // The data is not read, since the values cannot fit in a BinaryArray
+  const uint8_t data[] = {0};
+  vector<int32_t> offsets = {0, 1, std::numeric_limits<int32_t>::max()};
+
+  ASSERT_RAISES(CapacityError, builder_->AppendValues(data, offsets.data(), 2));
+  ASSERT_EQ(0, builder_->length());
+
+  // With the existing data, the rebased offsets would overflow int32
+  ASSERT_OK(builder_->Append("abc"));
+  offsets = {1, static_cast<int32_t>(kBinaryMemoryLimit) - 1};
+  ASSERT_RAISES(CapacityError, builder_->AppendValues(data, offsets.data(), 1));
+  ASSERT_EQ(1, builder_->length());
+  ASSERT_EQ(3, builder_->value_data_length());
+
+  // The builder is left usable
+  offsets = {0, 0};
+  ASSERT_OK(builder_->AppendValues(data, offsets.data(), 1));
+  Done();
+  ASSERT_EQ(2, result_->length());
+  ASSERT_EQ("abc", result_->GetString(0));
+  ASSERT_EQ("", result_->GetString(1));
+}
+
 TEST_F(TestBinaryBuilder, TestZeroLength) {
   // All buffers are null
   Done();
 }
 
+// ----------------------------------------------------------------------
+// ChunkedBinaryBuilder tests
+
+TEST(TestChunkedBinaryBuilder, SplitsAtMaxChunkSize) {
+  internal::ChunkedBinaryBuilder builder(10);
+
+  ASSERT_OK(builder.Append("12345"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append("67890"));
+  ASSERT_EQ(0, builder.num_chunks());
+  // Doesn't fit in the first chunk anymore
+  ASSERT_OK(builder.Append("a"));
+  ASSERT_EQ(1, builder.num_chunks());
+  ASSERT_OK(builder.AppendNull());
+  // Larger than a chunk, gets a chunk of its own
+  ASSERT_OK(builder.Append("bcdefghijklm"));
+  ASSERT_OK(builder.Append("n"));
+
+  vector<std::shared_ptr<Array>> chunks;
+  ASSERT_OK(builder.Finish(&chunks));
+  ASSERT_EQ(4, static_cast<int>(chunks.size()));
+
+  std::shared_ptr<Array> expected;
+
+  ArrayFromVector<BinaryType, string>({true, false, true}, {"12345", "", "67890"},
+                                     &expected);
+  AssertArraysEqual(*expected, *chunks[0]);
+  ArrayFromVector<BinaryType, string>({true, false}, {"a", ""}, &expected);
+  AssertArraysEqual(*expected, *chunks[1]);
+  ArrayFromVector<BinaryType, string>({true}, {"bcdefghijklm"}, &expected);
+  AssertArraysEqual(*expected, *chunks[2]);
+  ArrayFromVector<BinaryType, string>({true}, {"n"}, &expected);
+  AssertArraysEqual(*expected, *chunks[3]);
+
+  // The builder is reset by Finish
+  ASSERT_EQ(0, builder.num_chunks());
+  ASSERT_OK(builder.Append("o"));
+  ASSERT_OK(builder.Finish(&chunks));
+  ASSERT_EQ(1, static_cast<int>(chunks.size()));
+  ArrayFromVector<BinaryType, string>({true}, {"o"}, &expected);
+  AssertArraysEqual(*expected, *chunks[0]);
+}
+
+TEST(TestChunkedBinaryBuilder, Empty) {
+  internal::ChunkedBinaryBuilder builder(10);
+
+  std::shared_ptr<ChunkedArray> out;
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_EQ(1, out->num_chunks());
+  ASSERT_EQ(0, out->length());
+  ASSERT_TRUE(out->type()->Equals(binary()));
+}
+
+TEST(TestChunkedStringBuilder, Basics) {
+  internal::ChunkedStringBuilder builder(4);
+
+  ASSERT_OK(builder.Reserve(4));
+  ASSERT_OK(builder.ReserveData(100));
+  ASSERT_OK(builder.Append("ab"));
+  ASSERT_OK(builder.Append("cd"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append("ef"));
+
+  std::shared_ptr<ChunkedArray> out;
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_TRUE(out->type()->Equals(utf8()));
+  ASSERT_EQ(2, out->num_chunks());
+  ASSERT_EQ(4, out->length());
+  ASSERT_EQ(1, out->null_count());
+
+  std::shared_ptr<Array> expected;
+
+  ArrayFromVector<StringType, string>({true, true, false}, {"ab", "cd", ""},
+                                     &expected);
+  AssertArraysEqual(*expected, *out->chunk(0));
+  ArrayFromVector<StringType, string>({true}, {"ef"}, &expected);
+  AssertArraysEqual(*expected, *out->chunk(1));
+}
+
 // ----------------------------------------------------------------------
 // Slice tests
 
@@ -152,6 +152,46 @@ static void BM_BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const
   state.SetBytesProcessed(state.iterations() * iterations * value.size());
 }
 
+static void BM_BuildBinaryArrayUnsafeAppend(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+
+  std::string value = "1234567890";
+  while (state.KeepRunning()) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(iterations));
+    ABORT_NOT_OK(builder.ReserveData(iterations * value.size()));
+    for (int64_t i = 0; i < iterations; i++) {
+      builder.UnsafeAppend(value);
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * value.size());
+}
+
+static void BM_BuildBinaryArrayAppendValues(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t iterations = 1 << 20;
+  const int32_t width = 10;
+
+  // The values as they would come out of a decoder, contiguous with offsets
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (int64_t i = 0; i < iterations; i++) {
+    data += "1234567890";
+    offsets.push_back(offsets.back() + width);
+  }
+  while (state.KeepRunning()) {
+    BinaryBuilder builder;
+    ABORT_NOT_OK(builder.AppendValues(reinterpret_cast<const uint8_t*>(data.data()),
+                                      offsets.data(), iterations));
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+  state.SetBytesProcessed(state.iterations() * iterations * width);
+}
+
 static void BM_BuildFixedSizeBinaryArray(
     benchmark::State& state) {  // NOLINT non-const reference
   const int64_t iterations = 1 << 20;
@@ -183,6 +223,12 @@ BENCHMARK(BM_BuildAdaptiveIntNoNullsScalarAppend)
 BENCHMARK(BM_BuildAdaptiveUIntNoNulls)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK(BM_BuildBinaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayUnsafeAppend)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildBinaryArrayAppendValues)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_BuildFixedSizeBinaryArray)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 }  // namespace arrow
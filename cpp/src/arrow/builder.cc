@@ -28,21 +28,15 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
-#include "arrow/util/hash-util.h"
-#include "arrow/util/hash.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 
-#ifdef ARROW_USE_SSE
-#define SSE4_FLAG true
-#else
-#define SSE4_FLAG false
-#endif
-
 namespace arrow {
 
 using internal::AdaptiveIntBuilderBase;
@@ -759,130 +753,43 @@ Status BooleanBuilder::AppendValues(const std::vector<bool>& values) {
 // ----------------------------------------------------------------------
 // DictionaryBuilder
 
-using internal::DictionaryScalar;
 using internal::WrappedBinary;
 
-namespace {
-
-// A helper class to manage a hash table embedded in a typed Builder.
-template <typename T, typename Enable = void>
-struct DictionaryHashHelper {};
-
-// DictionaryHashHelper implementation for primitive types
+// The memo table is forward declared in the header, so that builder.h does
+// not need the hashing internals
 template <typename T>
-struct DictionaryHashHelper<T, enable_if_has_c_type<T>> {
-  using Builder = typename TypeTraits<T>::BuilderType;
-  using Scalar = typename DictionaryScalar<T>::type;
-
-  // Get the dictionary value at the given builder index
-  static Scalar GetDictionaryValue(const Builder& builder, int64_t index) {
-    return builder.GetValue(index);
-  }
-
-  // Compute the hash of a scalar value
-  static int64_t HashValue(const Scalar& value, int byte_width) {
-    return HashUtil::Hash<SSE4_FLAG>(&value, sizeof(Scalar), 0);
-  }
-
-  // Return whether the dictionary value at the given builder index is unequal to value
-  static bool SlotDifferent(const Builder& builder, int64_t index, const Scalar& value) {
-    return GetDictionaryValue(builder, index) != value;
-  }
-
-  // Append a value to the builder
-  static Status AppendValue(Builder& builder, const Scalar& value) {
-    return builder.Append(value);
-  }
-
-  // Append another builder's contents to the builder
-  static Status AppendArray(Builder& builder, const Array& in_array) {
-    const auto& array = checked_cast<const PrimitiveArray&>(in_array);
-    return builder.AppendValues(reinterpret_cast<const Scalar*>(array.values()->data()),
-                                array.length(), nullptr);
-  }
+class DictionaryBuilder<T>::MemoTableImpl
+    : public internal::HashTraits<T>::MemoTableType {
+ public:
+  using MemoTableType = typename internal::HashTraits<T>::MemoTableType;
+  using MemoTableType::MemoTableType;
 };
 
-// DictionaryHashHelper implementation for StringType / BinaryType
-template <typename T>
-struct DictionaryHashHelper<T, enable_if_binary<T>> {
-  using Builder = typename TypeTraits<T>::BuilderType;
-  using Scalar = typename DictionaryScalar<T>::type;
-
-  static Scalar GetDictionaryValue(const Builder& builder, int64_t index) {
-    int32_t v_length;
-    const uint8_t* v_ptr = builder.GetValue(index, &v_length);
-    return WrappedBinary(v_ptr, v_length);
-  }
-
-  static int64_t HashValue(const Scalar& value, int byte_width) {
-    return HashUtil::Hash<SSE4_FLAG>(value.ptr_, value.length_, 0);
-  }
+namespace {
 
-  static bool SlotDifferent(const Builder& builder, int64_t index, const Scalar& value) {
-    int32_t other_length;
-    const uint8_t* other_ptr = builder.GetValue(index, &other_length);
-    return value.length_ != other_length ||
-           memcmp(value.ptr_, other_ptr, other_length) != 0;
-  }
+template <typename MemoTableType, typename Scalar>
+Status GetOrInsertScalar(MemoTableType* memo_table, const Scalar& value,
+                         int32_t* out_memo_index) {
+  return memo_table->GetOrInsert(value, out_memo_index);
+}
 
-  static Status AppendValue(Builder& builder, const Scalar& value) {
-    return builder.Append(value.ptr_, value.length_);
-  }
+template <typename MemoTableType>
+Status GetOrInsertScalar(MemoTableType* memo_table, const WrappedBinary& value,
+                         int32_t* out_memo_index) {
+  return memo_table->GetOrInsert(value.ptr_, value.length_, out_memo_index);
+}
 
-  static Status AppendArray(Builder& builder, const Array& in_array) {
-    const auto& array = checked_cast<const BinaryArray&>(in_array);
-    for (uint64_t index = 0, limit = array.length(); index < limit; ++index) {
-      int32_t length;
-      const uint8_t* ptr = array.GetValue(index, &length);
-      RETURN_NOT_OK(builder.Append(ptr, length));
-    }
-    return Status::OK();
-  }
-};
+}  // namespace
 
-// DictionaryHashHelper implementation for FixedSizeBinaryType
 template <typename T>
-struct DictionaryHashHelper<T, enable_if_fixed_size_binary<T>> {
-  using Builder = typename TypeTraits<FixedSizeBinaryType>::BuilderType;
-  using Scalar = typename DictionaryScalar<FixedSizeBinaryType>::type;
-
-  static Scalar GetDictionaryValue(const Builder& builder, int64_t index) {
-    return builder.GetValue(index);
-  }
-
-  static int64_t HashValue(const Scalar& value, int byte_width) {
-    return HashUtil::Hash<SSE4_FLAG>(value, byte_width, 0);
-  }
-
-  static bool SlotDifferent(const Builder& builder, int64_t index, const uint8_t* value) {
-    const int32_t width = builder.byte_width();
-    const uint8_t* other_value = builder.GetValue(index);
-    return memcmp(value, other_value, width) != 0;
-  }
-
-  static Status AppendValue(Builder& builder, const Scalar& value) {
-    return builder.Append(value);
-  }
-
-  static Status AppendArray(Builder& builder, const Array& in_array) {
-    const auto& array = checked_cast<const FixedSizeBinaryArray&>(in_array);
-    for (uint64_t index = 0, limit = array.length(); index < limit; ++index) {
-      const Scalar value = array.GetValue(index);
-      RETURN_NOT_OK(builder.Append(value));
-    }
-    return Status::OK();
-  }
-};
-
-}  // namespace
+DictionaryBuilder<T>::~DictionaryBuilder() {}
 
 template <typename T>
 DictionaryBuilder<T>::DictionaryBuilder(const std::shared_ptr<DataType>& type,
                                         MemoryPool* pool)
     : ArrayBuilder(type, pool),
-      hash_slots_(nullptr),
-      dict_builder_(type, pool),
-      overflow_dict_builder_(type, pool),
+      memo_table_(new MemoTableImpl(pool, 0)),
+      entry_id_offset_(0),
       values_builder_(pool),
       byte_width_(-1) {}
 
@@ -894,17 +801,17 @@ template <>
 DictionaryBuilder<FixedSizeBinaryType>::DictionaryBuilder(
     const std::shared_ptr<DataType>& type, MemoryPool* pool)
     : ArrayBuilder(type, pool),
-      hash_slots_(nullptr),
-      dict_builder_(type, pool),
-      overflow_dict_builder_(type, pool),
+      memo_table_(new MemoTableImpl(pool, 0)),
+      entry_id_offset_(0),
       values_builder_(pool),
       byte_width_(checked_cast<const FixedSizeBinaryType&>(*type).byte_width()) {}
 
 template <typename T>
 void DictionaryBuilder<T>::Reset() {
-  dict_builder_.Reset();
-  overflow_dict_builder_.Reset();
+  ArrayBuilder::Reset();
   values_builder_.Reset();
+  memo_table_.reset(new MemoTableImpl(pool_, 0));
+  entry_id_offset_ = 0;
 }
 
 template <typename T>
@@ -912,17 +819,6 @@ Status DictionaryBuilder<T>::Resize(int64_t capacity) {
   if (capacity < kMinBuilderCapacity) {
     capacity = kMinBuilderCapacity;
   }
-
-  if (capacity_ == 0) {
-    // Fill the initial hash table
-    RETURN_NOT_OK(internal::NewHashTable(kInitialHashTableSize, pool_, &hash_table_));
-    hash_slots_ = reinterpret_cast<int32_t*>(hash_table_->mutable_data());
-    hash_table_size_ = kInitialHashTableSize;
-    entry_id_offset_ = 0;
-    mod_bitmask_ = kInitialHashTableSize - 1;
-    hash_table_load_threshold_ =
-        static_cast<int64_t>(static_cast<double>(capacity) * kMaxHashTableLoad);
-  }
   RETURN_NOT_OK(values_builder_.Resize(capacity));
   return ArrayBuilder::Resize(capacity);
 }
@@ -935,69 +831,20 @@ Status DictionaryBuilder<NullType>::Resize(int64_t capacity) {
   return ArrayBuilder::Resize(capacity);
 }
 
-template <typename T>
-int64_t DictionaryBuilder<T>::HashValue(const Scalar& value) {
-  return DictionaryHashHelper<T>::HashValue(value, byte_width_);
-}
-
-template <typename T>
-typename DictionaryBuilder<T>::Scalar DictionaryBuilder<T>::GetDictionaryValue(
-    typename TypeTraits<T>::BuilderType& dictionary_builder, int64_t index) {
-  return DictionaryHashHelper<T>::GetDictionaryValue(dictionary_builder, index);
-}
-
-template <typename T>
-bool DictionaryBuilder<T>::SlotDifferent(hash_slot_t index, const Scalar& value) {
-  DCHECK_GE(index, 0);
-  if (index >= entry_id_offset_) {
-    // Lookup delta dictionary
-    DCHECK_LT(index - entry_id_offset_, dict_builder_.length());
-    return DictionaryHashHelper<T>::SlotDifferent(
-        dict_builder_, static_cast<int64_t>(index - entry_id_offset_), value);
-  } else {
-    DCHECK_LT(index, overflow_dict_builder_.length());
-    return DictionaryHashHelper<T>::SlotDifferent(overflow_dict_builder_,
-                                                  static_cast<int64_t>(index), value);
-  }
-}
-
-template <typename T>
-Status DictionaryBuilder<T>::AppendDictionary(const Scalar& value) {
-  return DictionaryHashHelper<T>::AppendValue(dict_builder_, value);
-}
-
 template <typename T>
 Status DictionaryBuilder<T>::Append(const Scalar& value) {
   RETURN_NOT_OK(Reserve(1));
-  // Based on DictEncoder<DType>::Put
-  int64_t j = HashValue(value) & mod_bitmask_;
-  hash_slot_t index = hash_slots_[j];
-
-  // Find an empty slot
-  while (kHashSlotEmpty != index && SlotDifferent(index, value)) {
-    // Linear probing
-    ++j;
-    if (j == hash_table_size_) {
-      j = 0;
-    }
-    index = hash_slots_[j];
-  }
-
-  if (index == kHashSlotEmpty) {
-    // Not in the hash table, so we insert it now
-    index = static_cast<hash_slot_t>(dict_builder_.length() + entry_id_offset_);
-    hash_slots_[j] = index;
-    RETURN_NOT_OK(AppendDictionary(value));
-
-    if (ARROW_PREDICT_FALSE(static_cast<int32_t>(dict_builder_.length()) >
-                            hash_table_load_threshold_)) {
-      RETURN_NOT_OK(DoubleTableSize());
-    }
-  }
-
-  RETURN_NOT_OK(values_builder_.Append(index));
+  int32_t memo_index;
+  RETURN_NOT_OK(GetOrInsertScalar(memo_table_.get(), value, &memo_index));
+  return values_builder_.Append(memo_index);
+}
 
-  return Status::OK();
+template <>
+Status DictionaryBuilder<FixedSizeBinaryType>::Append(const Scalar& value) {
+  RETURN_NOT_OK(Reserve(1));
+  int32_t memo_index;
+  RETURN_NOT_OK(memo_table_->GetOrInsert(value, byte_width_, &memo_index));
+  return values_builder_.Append(memo_index);
 }
 
 template <typename T>
@@ -1044,31 +891,18 @@ Status DictionaryBuilder<FixedSizeBinaryType>::AppendArray(const Array& array) {
   return Status::OK();
 }
 
-template <typename T>
-Status DictionaryBuilder<T>::DoubleTableSize() {
-#define INNER_LOOP \
-  int64_t j = HashValue(GetDictionaryValue(dict_builder_, index)) & new_mod_bitmask
-
-  DOUBLE_TABLE_SIZE(, INNER_LOOP);
-
-  return Status::OK();
-}
-
 template <typename T>
 Status DictionaryBuilder<T>::FinishInternal(std::shared_ptr<ArrayData>* out) {
-  std::shared_ptr<Array> dictionary;
-  entry_id_offset_ += dict_builder_.length();
-  RETURN_NOT_OK(dict_builder_.Finish(&dictionary));
-
-  // Store current dict entries for further uses of this DictionaryBuilder
-  RETURN_NOT_OK(
-      DictionaryHashHelper<T>::AppendArray(overflow_dict_builder_, *dictionary));
-  DCHECK_EQ(entry_id_offset_, overflow_dict_builder_.length());
+  // Only the entries added since the last Finish call make up the dictionary
+  std::shared_ptr<ArrayData> dictionary_data;
+  RETURN_NOT_OK(internal::DictionaryTraits<T>::GetDictionaryArrayData(
+      pool_, type_, *memo_table_, entry_id_offset_, &dictionary_data));
+  std::shared_ptr<Array> dictionary = MakeArray(dictionary_data);
+  entry_id_offset_ = memo_table_->size();
 
   RETURN_NOT_OK(values_builder_.FinishInternal(out));
   (*out)->type = std::make_shared<DictionaryType>((*out)->type, dictionary);
 
-  dict_builder_.Reset();
   values_builder_.Reset();
 
   return Status::OK();
@@ -1282,6 +1116,35 @@ Status BinaryBuilder::AppendNull() {
   return Status::OK();
 }
 
+Status BinaryBuilder::AppendValues(const uint8_t* data, const int32_t* offsets,
+                                   int64_t length, const uint8_t* valid_bytes) {
+  if (length == 0) {
+    return Status::OK();
+  }
+  // The data of all the values, including nulls, is copied at once
+  const int64_t data_length = static_cast<int64_t>(offsets[length]) - offsets[0];
+  // Checked up front, since the rebased offsets must not overflow
+  const int64_t num_bytes = value_data_length() + data_length;
+  if (ARROW_PREDICT_FALSE(num_bytes > kBinaryMemoryLimit)) {
+    std::stringstream ss;
+    ss << "BinaryArray cannot contain more than " << kBinaryMemoryLimit << " bytes, have "
+       << num_bytes;
+    return Status::CapacityError(ss.str());
+  }
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(ReserveData(data_length));
+
+  // Rebase the offsets at the end of the existing data
+  const int32_t delta = static_cast<int32_t>(value_data_length() - offsets[0]);
+  for (int64_t i = 0; i < length; ++i) {
+    offsets_builder_.UnsafeAppend(offsets[i] + delta);
+  }
+  value_data_builder_.UnsafeAppend(data + offsets[0], data_length);
+
+  UnsafeAppendToBitmap(valid_bytes, length);
+  return Status::OK();
+}
+
 Status BinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   // Write final offset (values length)
   RETURN_NOT_OK(AppendNextOffset());
@@ -1403,6 +1266,57 @@ Status StringBuilder::AppendValues(const char** values, int64_t length,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// ChunkedBinaryBuilder
+
+namespace internal {
+
+ChunkedBinaryBuilder::ChunkedBinaryBuilder(int32_t max_chunk_size, MemoryPool* pool)
+    : max_chunk_size_(max_chunk_size),
+      chunk_data_size_(0),
+      builder_(new BinaryBuilder(pool)) {}
+
+Status ChunkedBinaryBuilder::Reserve(int64_t values) {
+  const int64_t room = kListMaximumElements - builder_->length();
+  return builder_->Reserve(std::min(values, room));
+}
+
+Status ChunkedBinaryBuilder::ReserveData(int64_t elements) {
+  const int64_t room = std::max<int64_t>(max_chunk_size_ - chunk_data_size_, 0);
+  return builder_->ReserveData(std::min(elements, room));
+}
+
+Status ChunkedBinaryBuilder::NextChunk() {
+  std::shared_ptr<Array> chunk;
+  RETURN_NOT_OK(builder_->Finish(&chunk));
+  chunks_.emplace_back(std::move(chunk));
+  chunk_data_size_ = 0;
+  return Status::OK();
+}
+
+Status ChunkedBinaryBuilder::Finish(std::vector<std::shared_ptr<Array>>* out) {
+  if (builder_->length() > 0 || chunks_.empty()) {
+    RETURN_NOT_OK(NextChunk());
+  }
+  *out = std::move(chunks_);
+  chunks_.clear();
+  return Status::OK();
+}
+
+Status ChunkedBinaryBuilder::Finish(std::shared_ptr<ChunkedArray>* out) {
+  std::vector<std::shared_ptr<Array>> chunks;
+  RETURN_NOT_OK(Finish(&chunks));
+  *out = std::make_shared<ChunkedArray>(chunks);
+  return Status::OK();
+}
+
+ChunkedStringBuilder::ChunkedStringBuilder(int32_t max_chunk_size, MemoryPool* pool)
+    : ChunkedBinaryBuilder(max_chunk_size, pool) {
+  builder_.reset(new StringBuilder(pool));
+}
+
+}  // namespace internal
+
 // ----------------------------------------------------------------------
 // Fixed width binary
 
@@ -35,7 +35,6 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
-#include "arrow/util/hash.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/type_traits.h"
 #include "arrow/util/visibility.h"
@@ -850,6 +849,41 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
 
   Status AppendNull();
 
+  /// \brief Append a sequence of values stored contiguously
+  ///
+  /// \param[in] data the value data of all the values
+  /// \param[in] offsets length + 1 offsets into data, value i is between
+  /// offsets[i] and offsets[i + 1]
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const uint8_t* data, const int32_t* offsets, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR);
+
+  /// \brief Append without checking capacity
+  ///
+  /// Offsets and data should have been reserved with Reserve() and
+  /// ReserveData() respectively
+  void UnsafeAppend(const uint8_t* value, int32_t length) {
+    UnsafeAppendNextOffset();
+    value_data_builder_.UnsafeAppend(value, length);
+    UnsafeAppendToBitmap(true);
+  }
+
+  void UnsafeAppend(const char* value, int32_t length) {
+    UnsafeAppend(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  void UnsafeAppend(const std::string& value) {
+    UnsafeAppend(value.c_str(), static_cast<int32_t>(value.size()));
+  }
+
+  void UnsafeAppendNull() {
+    UnsafeAppendNextOffset();
+    UnsafeAppendToBitmap(false);
+  }
+
   void Reset() override;
   Status Resize(int64_t capacity) override;
 
@@ -874,6 +908,11 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
   TypedBufferBuilder<uint8_t> value_data_builder_;
 
   Status AppendNextOffset();
+
+  void UnsafeAppendNextOffset() {
+    const int64_t num_bytes = value_data_builder_.length();
+    offsets_builder_.UnsafeAppend(static_cast<int32_t>(num_bytes));
+  }
 };
 
 /// \class StringBuilder
@@ -884,6 +923,7 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
   explicit StringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
 
   using BinaryBuilder::Append;
+  using BinaryBuilder::AppendValues;
   using BinaryBuilder::Reset;
 
   /// \brief Append a sequence of strings in one shot.
@@ -908,6 +948,90 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
                       const uint8_t* valid_bytes = NULLPTR);
 };
 
+// ----------------------------------------------------------------------
+// ChunkedBinaryBuilder
+
+namespace internal {
+
+/// \class ChunkedBinaryBuilder
+/// \brief Builder for binary data split into several arrays
+///
+/// A new chunk is started whenever a value would take the data of the
+/// current chunk beyond max_chunk_size bytes, or the current chunk is full,
+/// so that more data than fits in the 32-bit offsets of a single BinaryArray
+/// can be built
+class ARROW_EXPORT ChunkedBinaryBuilder {
+ public:
+  explicit ChunkedBinaryBuilder(int32_t max_chunk_size,
+                                MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+
+  virtual ~ChunkedBinaryBuilder() = default;
+
+  Status Append(const uint8_t* value, int32_t length) {
+    if (ARROW_PREDICT_FALSE(length + chunk_data_size_ > max_chunk_size_ ||
+                            builder_->length() == kListMaximumElements)) {
+      // A value larger than max_chunk_size is put in a chunk of its own
+      if (builder_->length() > 0) {
+        ARROW_RETURN_NOT_OK(NextChunk());
+      }
+    }
+    chunk_data_size_ += length;
+    return builder_->Append(value, length);
+  }
+
+  Status Append(const char* value, int32_t length) {
+    return Append(reinterpret_cast<const uint8_t*>(value), length);
+  }
+
+  Status Append(const std::string& value) {
+    return Append(value.c_str(), static_cast<int32_t>(value.size()));
+  }
+
+  Status AppendNull() {
+    if (ARROW_PREDICT_FALSE(builder_->length() == kListMaximumElements)) {
+      ARROW_RETURN_NOT_OK(NextChunk());
+    }
+    return builder_->AppendNull();
+  }
+
+  /// \brief Reserve space for the indicated number of values in the current
+  /// chunk, as far as it can hold them
+  Status Reserve(int64_t values);
+
+  /// \brief Reserve the indicated number of bytes of value data in the current
+  /// chunk, as far as it can hold them
+  Status ReserveData(int64_t elements);
+
+  /// \brief Finish the chunks built so far and reset the builder
+  ///
+  /// There is always at least one chunk, which may be empty
+  Status Finish(std::vector<std::shared_ptr<Array>>* out);
+
+  Status Finish(std::shared_ptr<ChunkedArray>* out);
+
+  /// \brief The number of chunks finished so far, excluding the current one
+  int64_t num_chunks() const { return static_cast<int64_t>(chunks_.size()); }
+
+ protected:
+  Status NextChunk();
+
+  int64_t max_chunk_size_;
+  int64_t chunk_data_size_;
+
+  std::unique_ptr<BinaryBuilder> builder_;
+  std::vector<std::shared_ptr<Array>> chunks_;
+};
+
+/// \class ChunkedStringBuilder
+/// \brief Builder for UTF8 strings split into several arrays
+class ARROW_EXPORT ChunkedStringBuilder : public ChunkedBinaryBuilder {
+ public:
+  explicit ChunkedStringBuilder(int32_t max_chunk_size,
+                                MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+};
+
+}  // namespace internal
+
 // ----------------------------------------------------------------------
 // FixedSizeBinaryBuilder
 
@@ -1072,6 +1196,8 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
       typename std::enable_if<TypeTraits<T1>::is_parameter_free, MemoryPool*>::type pool)
       : DictionaryBuilder<T1>(TypeTraits<T1>::type_singleton(), pool) {}
 
+  ~DictionaryBuilder() override;
+
   /// \brief Append a scalar value
   Status Append(const Scalar& value);
 
@@ -1089,42 +1215,15 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
   bool is_building_delta() { return entry_id_offset_ > 0; }
 
  protected:
-  // Hash table implementation helpers
-  Status DoubleTableSize();
-  Scalar GetDictionaryValue(typename TypeTraits<T>::BuilderType& dictionary_builder,
-                            int64_t index);
-  int64_t HashValue(const Scalar& value);
-  // Check whether the dictionary entry in *slot* is equal to the given *value*
-  bool SlotDifferent(hash_slot_t slot, const Scalar& value);
-  Status AppendDictionary(const Scalar& value);
-
-  std::shared_ptr<Buffer> hash_table_;
-  int32_t* hash_slots_;
-
-  /// Size of the table. Must be a power of 2.
-  int64_t hash_table_size_;
-
-  // Offset for the dictionary entries in dict_builder_.
-  // Increased on every Finish call by the number of current entries
-  // in the dictionary.
-  int64_t entry_id_offset_;
-
-  // Store hash_table_size_ - 1, so that j & mod_bitmask_ is equivalent to j %
-  // hash_table_size_, but uses far fewer CPU cycles
-  int64_t mod_bitmask_;
-
-  // This builder accumulates new dictionary entries since the last Finish call
-  // (or since the beginning if Finish hasn't been called).
-  // In other words, it contains the current delta dictionary.
-  typename TypeTraits<T>::BuilderType dict_builder_;
-  // This builder stores dictionary entries encountered before the last Finish call.
-  typename TypeTraits<T>::BuilderType overflow_dict_builder_;
+  class MemoTableImpl;
+  std::unique_ptr<MemoTableImpl> memo_table_;
+
+  // Number of the dictionary entries emitted by the previous Finish calls.
+  // The entries from this offset on form the current delta dictionary.
+  int32_t entry_id_offset_;
 
   AdaptiveIntBuilder values_builder_;
   int32_t byte_width_;
-
-  /// Size at which we decide to resize
-  int64_t hash_table_load_threshold_;
 };
 
 template <>
@@ -941,6 +941,59 @@ TEST_F(TestCast, StringToNumberErrors) {
   CheckFails<StringType, std::string>(utf8(), {"z"}, is_valid, float32(), options);
 }
 
+TEST_F(TestCast, StringToTimestamp) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true};
+  vector<std::string> strings = {"1970-01-01", "xxx", "2000-02-29 12:34:56.789"};
+
+  auto type = timestamp(TimeUnit::SECOND);
+  vector<int64_t> e = {0, 0, 951827696};
+  CheckFails<StringType, std::string>(utf8(), strings, is_valid, type, options);
+
+  strings[2] = "2000-02-29 12:34:56";
+  CheckCase<StringType, std::string, TimestampType, int64_t>(utf8(), strings, is_valid,
+                                                             type, e, options);
+
+  type = timestamp(TimeUnit::MILLI);
+  strings[2] = "2000-02-29 12:34:56.789";
+  e = {0, 0, 951827696789LL};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(utf8(), strings, is_valid,
+                                                             type, e, options);
+
+  type = timestamp(TimeUnit::NANO, "UTC");
+  e = {0, 0, 951827696789000000LL};
+  CheckCase<StringType, std::string, TimestampType, int64_t>(utf8(), strings, is_valid,
+                                                             type, e, options);
+
+  CheckFails<StringType, std::string>(utf8(), {"2000-02-30"}, {true}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"1960-01-01T"}, {true}, type, options);
+}
+
+TEST_F(TestCast, StringToDecimal) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true};
+  vector<std::string> strings = {"0", "xxx", "-123.4", "1.23E2"};
+
+  auto type = decimal(5, 2);
+  vector<Decimal128> e = {Decimal128(0), Decimal128(0), Decimal128(-12340),
+                          Decimal128(12300)};
+  CheckCase<StringType, std::string, Decimal128Type, Decimal128>(
+      utf8(), strings, is_valid, type, e, options);
+
+  type = decimal(38, 20);
+  e = {Decimal128(0), Decimal128(0), Decimal128("-12340000000000000000000"),
+       Decimal128("12300000000000000000000")};
+  CheckCase<StringType, std::string, Decimal128Type, Decimal128>(
+      utf8(), strings, is_valid, type, e, options);
+
+  type = decimal(5, 2);
+  CheckFails<StringType, std::string>(utf8(), {"1234"}, {true}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"0.125"}, {true}, type, options);
+  CheckFails<StringType, std::string>(utf8(), {"1.2.3"}, {true}, type, options);
+}
+
 template <typename TestType>
 class TestDictionaryCast : public TestCast {};
 
@@ -994,16 +1047,141 @@ TEST_F(TestCast, DictToNonDictNoNulls) {
   ASSERT_ARRAYS_EQUAL(*e2, *chunks[1]);
 }
 
-/*TYPED_TEST(TestDictionaryCast, Reverse) {
+TYPED_TEST(TestDictionaryCast, Reverse) {
   CastOptions options;
   shared_ptr<Array> plain_array =
       TestBase::MakeRandomArray<typename TypeTraits<TypeParam>::ArrayType>(10, 2);
 
-  shared_ptr<Array> dict_array;
-  ASSERT_OK(EncodeArrayToDictionary(*plain_array, this->pool_, &dict_array));
+  Datum encoded;
+  ASSERT_OK(DictionaryEncode(&this->ctx_, Datum(plain_array->data()), &encoded));
+  shared_ptr<Array> dict_array = MakeArray(encoded.array());
 
   this->CheckPass(*plain_array, *dict_array, dict_array->type(), options);
-}*/
+}
+
+TEST_F(TestCast, DictToDictIndexType) {
+  CastOptions options;
+
+  auto dict = _MakeArray<StringType, std::string>(utf8(), {"foo", "bar", "baz"}, {});
+  vector<bool> is_valid = {true, false, true, true};
+  auto indices = _MakeArray<Int32Type, int32_t>(int32(), {2, 0, 1, 2}, is_valid);
+  DictionaryArray input(dictionary(int32(), dict), indices);
+
+  auto ex_indices = _MakeArray<Int8Type, int8_t>(int8(), {2, 0, 1, 2}, is_valid);
+  DictionaryArray expected(dictionary(int8(), dict), ex_indices);
+  CheckPass(input, expected, dictionary(int8(), dict), options);
+  CheckPass(*input.Slice(1), *expected.Slice(1), dictionary(int8(), dict), options);
+
+  ex_indices = _MakeArray<Int64Type, int64_t>(int64(), {2, 0, 1, 2}, is_valid);
+  DictionaryArray expected_int64(dictionary(int64(), dict), ex_indices);
+  CheckPass(input, expected_int64, dictionary(int64(), dict), options);
+
+  // Indices that don't fit in the new index type
+  vector<std::string> many_values;
+  for (int i = 0; i < 200; ++i) {
+    many_values.push_back(std::to_string(i));
+  }
+  auto large_dict = _MakeArray<StringType, std::string>(utf8(), many_values, {});
+  indices = _MakeArray<Int32Type, int32_t>(int32(), {1, 150}, {});
+  DictionaryArray large_input(dictionary(int32(), large_dict), indices);
+  shared_ptr<Array> result;
+  auto int8_type = dictionary(int8(), large_dict);
+  ASSERT_RAISES(Invalid, Cast(&ctx_, large_input, int8_type, options, &result));
+  // Even by unsafe casts, since wrapped indices would point to other values
+  ASSERT_RAISES(Invalid,
+                Cast(&ctx_, large_input, int8_type, CastOptions::Unsafe(), &result));
+  // Dense input with too many distinct values for the index type
+  ASSERT_RAISES(Invalid,
+                Cast(&ctx_, *large_dict, int8_type, CastOptions::Unsafe(), &result));
+
+  // Dictionary indices must be signed integers
+  ASSERT_RAISES(Invalid, Cast(&ctx_, input, dictionary(uint8(), dict), options, &result));
+}
+
+TEST_F(TestCast, DictToDictValueType) {
+  CastOptions options;
+
+  auto dict = _MakeArray<Int32Type, int32_t>(int32(), {10, 20, 30}, {});
+  auto dict_type = dictionary(int32(), dict);
+  vector<bool> is_valid = {true, true, false, true};
+  auto i1 = _MakeArray<Int32Type, int32_t>(int32(), {2, 0, 0, 1}, is_valid);
+  auto i2 = _MakeArray<Int32Type, int32_t>(int32(), {1, 1}, {});
+  auto input = std::make_shared<ChunkedArray>(
+      ArrayVector{std::make_shared<DictionaryArray>(dict_type, i1),
+                  std::make_shared<DictionaryArray>(dict_type, i2)});
+
+  // Only the value type of the target dictionary is used
+  auto empty_int64 = _MakeArray<Int64Type, int64_t>(int64(), {}, {});
+  Datum out;
+  ASSERT_OK(Cast(&ctx_, Datum(input), dictionary(int16(), empty_int64), options, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  auto chunks = out.chunked_array()->chunks();
+  ASSERT_EQ(2, chunks.size());
+
+  // Both chunks share the casted dictionary
+  ASSERT_EQ(chunks[0]->type().get(), chunks[1]->type().get());
+
+  auto ex_dict = _MakeArray<Int64Type, int64_t>(int64(), {10, 20, 30}, {});
+  auto ex_type = dictionary(int16(), ex_dict);
+  DictionaryArray e1(ex_type,
+                     _MakeArray<Int16Type, int16_t>(int16(), {2, 0, 0, 1}, is_valid));
+  DictionaryArray e2(ex_type, _MakeArray<Int16Type, int16_t>(int16(), {1, 1}, {}));
+  ASSERT_ARRAYS_EQUAL(e1, *chunks[0]);
+  ASSERT_ARRAYS_EQUAL(e2, *chunks[1]);
+
+  // Values of a string dictionary are parsed
+  auto str_dict = _MakeArray<StringType, std::string>(utf8(), {"7", "42"}, {});
+  DictionaryArray str_input(dictionary(int32(), str_dict),
+                            _MakeArray<Int32Type, int32_t>(int32(), {1, 0}, {}));
+  auto ex_int_dict = _MakeArray<Int32Type, int32_t>(int32(), {7, 42}, {});
+  DictionaryArray ex_int(dictionary(int8(), ex_int_dict),
+                         _MakeArray<Int8Type, int8_t>(int8(), {1, 0}, {}));
+  CheckPass(str_input, ex_int, dictionary(int8(), dict), options);
+
+  // Dictionary values which fail to cast
+  auto bad_dict = _MakeArray<StringType, std::string>(utf8(), {"7", "a"}, {});
+  DictionaryArray bad_input(dictionary(int32(), bad_dict),
+                            _MakeArray<Int32Type, int32_t>(int32(), {0, 0}, {}));
+  shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid,
+                Cast(&ctx_, bad_input, dictionary(int32(), dict), options, &result));
+}
+
+TEST_F(TestCast, DenseToDict) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, true, false, true, true};
+  auto input = _MakeArray<StringType, std::string>(
+      utf8(), {"foo", "bar", "", "foo", "baz"}, is_valid);
+  auto ex_dict = _MakeArray<StringType, std::string>(utf8(), {"foo", "bar", "baz"}, {});
+  auto ex_indices = _MakeArray<Int8Type, int8_t>(int8(), {0, 1, 0, 0, 2}, is_valid);
+  DictionaryArray expected(dictionary(int8(), ex_dict), ex_indices);
+  CheckPass(*input, expected, dictionary(int8(), ex_dict), options);
+
+  // With a different value type
+  auto numbers = _MakeArray<StringType, std::string>(utf8(), {"1.5", "2", "1.5"}, {});
+  auto ex_double_dict = _MakeArray<DoubleType, double>(float64(), {1.5, 2.0}, {});
+  DictionaryArray ex_double(dictionary(int8(), ex_double_dict),
+                            _MakeArray<Int8Type, int8_t>(int8(), {0, 1, 0}, {}));
+  CheckPass(*numbers, ex_double, dictionary(int8(), ex_double_dict), options);
+
+  // The chunks of a chunked array are encoded with the same dictionary
+  auto c1 = _MakeArray<Int32Type, int32_t>(int32(), {5, 7, 5}, {});
+  auto c2 = _MakeArray<Int32Type, int32_t>(int32(), {9, 7}, {});
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{c1, c2});
+  Datum out;
+  ASSERT_OK(Cast(&ctx_, Datum(chunked), dictionary(int16(), c1), options, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  auto chunks = out.chunked_array()->chunks();
+  ASSERT_EQ(2, chunks.size());
+
+  auto ex_dict_int32 = _MakeArray<Int32Type, int32_t>(int32(), {5, 7, 9}, {});
+  auto ex_type = dictionary(int16(), ex_dict_int32);
+  DictionaryArray e1(ex_type, _MakeArray<Int16Type, int16_t>(int16(), {0, 1, 0}, {}));
+  DictionaryArray e2(ex_type, _MakeArray<Int16Type, int16_t>(int16(), {2, 1}, {}));
+  ASSERT_ARRAYS_EQUAL(e1, *chunks[0]);
+  ASSERT_ARRAYS_EQUAL(e2, *chunks[1]);
+}
 
 TEST_F(TestCast, ListToList) {
   CastOptions options;
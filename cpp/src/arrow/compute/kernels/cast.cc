@@ -34,12 +34,14 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash.h"
 #include "arrow/compute/kernels/util-internal.h"
 
 #ifdef ARROW_EXTRA_ERROR_CONTEXT
@@ -789,17 +791,112 @@ struct CastFunctor<T, DictionaryType,
 };
 
 // ----------------------------------------------------------------------
-// String to Number
+// Dictionary to dictionary
+
+// Cast dictionary-encoded data to another index type and / or dictionary
+// value type without decoding it: the indices are cast on their own, and
+// the dictionary values only once for all arrays sharing the same
+// dictionary, which costs O(cardinality) instead of O(length).
+class DictionaryCastKernel : public UnaryKernel {
+ public:
+  DictionaryCastKernel(std::unique_ptr<UnaryKernel> index_caster,
+                       std::unique_ptr<UnaryKernel> dictionary_caster,
+                       const std::shared_ptr<DataType>& out_type)
+      : index_caster_(std::move(index_caster)),
+        dictionary_caster_(std::move(dictionary_caster)),
+        out_type_(out_type) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    const ArrayData& in_data = *input.array();
+    DCHECK_EQ(Type::DICTIONARY, in_data.type->id());
+    const auto& in_type = checked_cast<const DictionaryType&>(*in_data.type);
+
+    RETURN_NOT_OK(CastDictionary(ctx, in_type));
+
+    // The data of a dictionary array is the data of its indices
+    std::shared_ptr<ArrayData> indices = in_data.Copy();
+    indices->type = in_type.index_type();
+    if (index_caster_) {
+      Datum casted_indices;
+      RETURN_NOT_OK(index_caster_->Call(ctx, Datum(indices), &casted_indices));
+      indices = casted_indices.array();
+    }
+    indices->type = out_dict_type_;
+    out->value = indices;
+
+    RETURN_IF_ERROR(ctx);
+    return Status::OK();
+  }
+
+ private:
+  // Compute the output type, with the casted dictionary values
+  Status CastDictionary(FunctionContext* ctx, const DictionaryType& in_type) {
+    std::shared_ptr<Array> in_dictionary = in_type.dictionary();
+    if (out_dict_type_ != nullptr && in_dictionary == last_in_dictionary_) {
+      // The chunks of a column usually share their dictionary
+      return Status::OK();
+    }
+    std::shared_ptr<Array> out_dictionary = in_dictionary;
+    if (dictionary_caster_) {
+      Datum casted_dictionary;
+      RETURN_NOT_OK(dictionary_caster_->Call(ctx, Datum(in_dictionary->data()),
+                                             &casted_dictionary));
+      RETURN_IF_ERROR(ctx);
+      out_dictionary = MakeArray(casted_dictionary.array());
+    }
+    const auto& out_type = checked_cast<const DictionaryType&>(*out_type_);
+    out_dict_type_ = ::arrow::dictionary(out_type.index_type(), out_dictionary,
+                                         out_type.ordered());
+    last_in_dictionary_ = in_dictionary;
+    return Status::OK();
+  }
+
+  std::unique_ptr<UnaryKernel> index_caster_;
+  std::unique_ptr<UnaryKernel> dictionary_caster_;
+  std::shared_ptr<DataType> out_type_;
+
+  std::shared_ptr<Array> last_in_dictionary_;
+  std::shared_ptr<DataType> out_dict_type_;
+};
+
+// ----------------------------------------------------------------------
+// Dense to dictionary
+
+// Dictionary-encode the input with the hash kernel, then cast the result to
+// the requested index and value types
+class DictionaryEncodeCastKernel : public UnaryKernel {
+ public:
+  explicit DictionaryEncodeCastKernel(std::unique_ptr<UnaryKernel> dictionary_caster)
+      : dictionary_caster_(std::move(dictionary_caster)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+
+    Datum encoded;
+    RETURN_NOT_OK(DictionaryEncode(ctx, input, &encoded));
+    return dictionary_caster_->Call(ctx, encoded, out);
+  }
+
+ private:
+  std::unique_ptr<UnaryKernel> dictionary_caster_;
+};
+
+// ----------------------------------------------------------------------
+// String to Number and Timestamp
 
 template <typename O>
-struct CastFunctor<O, StringType, enable_if_number<O>> {
+struct CastFunctor<O, StringType,
+                   typename std::enable_if<is_number<O>::value ||
+                                           std::is_same<TimestampType, O>::value>::type> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
     using out_type = typename O::c_type;
 
     StringArray input_array(input.Copy());
     auto out_data = GetMutableValues<out_type>(output, 1);
-    internal::StringConverter<O> converter;
+    internal::StringConverter<O> converter(output->type);
 
     for (int64_t i = 0; i < input.length; ++i, ++out_data) {
       if (input_array.IsNull(i)) {
@@ -811,7 +908,8 @@ struct CastFunctor<O, StringType, enable_if_number<O>> {
       if (!converter(reinterpret_cast<const char*>(str), static_cast<size_t>(length),
                      out_data)) {
         std::stringstream ss;
-        ss << "Failed to cast String '" << str << "' into " << output->type->ToString();
+        ss << "Failed to cast String '" << input_array.GetString(i) << "' into "
+           << output->type->ToString();
         ctx->SetStatus(Status(StatusCode::Invalid, ss.str()));
         return;
       }
@@ -819,6 +917,42 @@ struct CastFunctor<O, StringType, enable_if_number<O>> {
   }
 };
 
+// ----------------------------------------------------------------------
+// String to Decimal
+
+template <>
+struct CastFunctor<Decimal128Type, StringType> {
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const int32_t byte_width =
+        checked_cast<const Decimal128Type&>(*output->type).byte_width();
+
+    StringArray input_array(input.Copy());
+    uint8_t* out_data = output->buffers[1]->mutable_data() + output->offset * byte_width;
+    internal::StringConverter<Decimal128Type> converter(output->type);
+
+    for (int64_t i = 0; i < input.length; ++i, out_data += byte_width) {
+      if (input_array.IsNull(i)) {
+        memset(out_data, 0, byte_width);
+        continue;
+      }
+
+      int32_t length = -1;
+      auto str = input_array.GetValue(i, &length);
+      Decimal128 value;
+      if (!converter(reinterpret_cast<const char*>(str), static_cast<size_t>(length),
+                     &value)) {
+        std::stringstream ss;
+        ss << "Failed to cast String '" << input_array.GetString(i) << "' into "
+           << output->type->ToString();
+        ctx->SetStatus(Status(StatusCode::Invalid, ss.str()));
+        return;
+      }
+      value.ToBytes(out_data);
+    }
+  }
+};
+
 // ----------------------------------------------------------------------
 // String to Boolean
 
@@ -1051,7 +1185,9 @@ class CastKernel : public UnaryKernel {
   FN(StringType, UInt64Type);     \
   FN(StringType, Int64Type);      \
   FN(StringType, FloatType);      \
-  FN(StringType, DoubleType);
+  FN(StringType, DoubleType);     \
+  FN(StringType, TimestampType);  \
+  FN(StringType, Decimal128Type);
 
 #define DICTIONARY_CASES(FN, IN_TYPE) \
   FN(IN_TYPE, NullType);              \
@@ -1136,10 +1272,66 @@ Status GetListCastFunc(const DataType& in_type, const std::shared_ptr<DataType>&
   return Status::OK();
 }
 
+// Casts to a dictionary type.  Only the index type and the value type of the
+// target type matter: the output dictionary is computed from the input.
+Status GetDictionaryCastFunc(const DataType& in_type,
+                             const std::shared_ptr<DataType>& out_type,
+                             const CastOptions& options,
+                             std::unique_ptr<UnaryKernel>* kernel) {
+  const auto& out_dict_type = checked_cast<const DictionaryType&>(*out_type);
+  const std::shared_ptr<DataType>& out_index_type = out_dict_type.index_type();
+  if (!is_integer(out_index_type->id()) ||
+      !checked_cast<const Integer&>(*out_index_type).is_signed()) {
+    std::stringstream ss;
+    ss << "Dictionary index type must be a signed integer, got "
+       << out_index_type->ToString();
+    return Status::Invalid(ss.str());
+  }
+  if (out_dict_type.dictionary() == nullptr) {
+    return Status::Invalid("Dictionary cast target type must have a dictionary");
+  }
+  const std::shared_ptr<DataType>& out_value_type = out_dict_type.dictionary()->type();
+
+  // Dense input is first encoded with int32 indices
+  std::shared_ptr<DataType> in_index_type = int32();
+  const DataType* in_value_type = &in_type;
+  if (in_type.id() == Type::DICTIONARY) {
+    const auto& in_dict_type = checked_cast<const DictionaryType&>(in_type);
+    in_index_type = in_dict_type.index_type();
+    in_value_type = in_dict_type.dictionary()->type().get();
+  }
+
+  std::unique_ptr<UnaryKernel> index_caster, dictionary_caster;
+  if (!in_index_type->Equals(*out_index_type)) {
+    // A wrapped index would silently point to another dictionary value, so the
+    // indices are always checked, even by unsafe casts
+    CastOptions index_options = options;
+    index_options.allow_int_overflow = false;
+    RETURN_NOT_OK(
+        GetCastFunction(*in_index_type, out_index_type, index_options, &index_caster));
+  }
+  if (!in_value_type->Equals(*out_value_type)) {
+    RETURN_NOT_OK(
+        GetCastFunction(*in_value_type, out_value_type, options, &dictionary_caster));
+  }
+  std::unique_ptr<UnaryKernel> dictionary_kernel(new DictionaryCastKernel(
+      std::move(index_caster), std::move(dictionary_caster), out_type));
+
+  if (in_type.id() == Type::DICTIONARY) {
+    *kernel = std::move(dictionary_kernel);
+  } else {
+    kernel->reset(new DictionaryEncodeCastKernel(std::move(dictionary_kernel)));
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>& out_type,
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel) {
+  if (out_type->id() == Type::DICTIONARY) {
+    return GetDictionaryCastFunc(in_type, out_type, options, kernel);
+  }
   switch (in_type.id()) {
     CAST_FUNCTION_CASE(NullType);
     CAST_FUNCTION_CASE(BooleanType);
@@ -1178,6 +1370,14 @@ Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>&
 Status Cast(FunctionContext* ctx, const Datum& value,
             const std::shared_ptr<DataType>& out_type, const CastOptions& options,
             Datum* out) {
+  if (value.kind() == Datum::CHUNKED_ARRAY && out_type->id() == Type::DICTIONARY &&
+      value.type()->id() != Type::DICTIONARY) {
+    // Encode all chunks against the same dictionary, then cast that
+    Datum encoded;
+    RETURN_NOT_OK(DictionaryEncode(ctx, value, &encoded));
+    return Cast(ctx, encoded, out_type, options, out);
+  }
+
   // Dynamic dispatch to obtain right cast function
   std::unique_ptr<UnaryKernel> func;
   RETURN_NOT_OK(GetCastFunction(*value.type(), out_type, options, &func));
@@ -67,6 +67,11 @@ Status GetCastFunction(const DataType& in_type, const std::shared_ptr<DataType>&
 /// \param[in] options casting options
 /// \param[out] out resulting array
 ///
+/// When casting to a dictionary type, only the index type and the value type
+/// of to_type are used: dense input is dictionary-encoded, and dictionary
+/// input keeps its indices and casts its dictionary values, without decoding.
+/// The resulting dictionary is derived from the input.
+///
 /// \since 0.7.0
 /// \note API not yet finalized
 ARROW_EXPORT
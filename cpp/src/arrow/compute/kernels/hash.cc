@@ -39,8 +39,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
-#include "arrow/util/hash-util.h"
-#include "arrow/util/hash.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 
@@ -52,9 +51,6 @@ using internal::checked_cast;
 
 namespace compute {
 
-// TODO(wesm): Enable top-level dispatch to SSE4 hashing if it is enabled
-#define HASH_USE_SSE false
-
 namespace {
 
 enum class SIMDMode : char { NOSIMD, SSE4, AVX2 };
@@ -91,13 +87,7 @@ const char* HashException::what() const throw() { return msg_.c_str(); }
 class HashTable {
  public:
   HashTable(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : type_(type),
-        pool_(pool),
-        initialized_(false),
-        hash_table_(nullptr),
-        hash_slots_(nullptr),
-        hash_table_size_(0),
-        mod_bitmask_(0) {}
+      : type_(type), pool_(pool) {}
 
   virtual ~HashTable() {}
 
@@ -106,40 +96,10 @@ class HashTable {
   virtual Status GetDictionary(std::shared_ptr<ArrayData>* out) = 0;
 
  protected:
-  Status Init(int64_t elements);
-
   std::shared_ptr<DataType> type_;
   MemoryPool* pool_;
-  bool initialized_;
-
-  // The hash table contains integer indices that reference the set of observed
-  // distinct values
-  std::shared_ptr<Buffer> hash_table_;
-  hash_slot_t* hash_slots_;
-
-  /// Size of the table. Must be a power of 2.
-  int64_t hash_table_size_;
-
-  /// Size at which we decide to resize
-  int64_t hash_table_load_threshold_;
-
-  // Store hash_table_size_ - 1, so that j & mod_bitmask_ is equivalent to j %
-  // hash_table_size_, but uses far fewer CPU cycles
-  int64_t mod_bitmask_;
 };
 
-Status HashTable::Init(int64_t elements) {
-  DCHECK_EQ(elements, BitUtil::NextPower2(elements));
-  RETURN_NOT_OK(internal::NewHashTable(elements, pool_, &hash_table_));
-  hash_slots_ = reinterpret_cast<hash_slot_t*>(hash_table_->mutable_data());
-  hash_table_size_ = elements;
-  hash_table_load_threshold_ =
-      static_cast<int64_t>(static_cast<double>(elements) * kMaxHashTableLoad);
-  mod_bitmask_ = elements - 1;
-  initialized_ = true;
-  return Status::OK();
-}
-
 template <typename Type, typename Action, typename Enable = void>
 class HashTableKernel : public HashTable {};
 
@@ -151,8 +111,48 @@ class HashTableKernel : public HashTable {};
 // isin: set false when not found, otherwise true
 // value counts: append to dictionary when not found, increment count for slot
 
-template <typename Type, typename Enable = void>
-class HashDictionary {};
+// Look up a value in the memo table, inserting it if the action allows the
+// dictionary to grow, and notify the action of the memo index
+template <typename Action, typename MemoTableType, typename... Args>
+void ObserveValue(Action* action, MemoTableType* memo_table, const Args&... args) {
+  if (Action::allow_expand) {
+    // The actions are notified of the index by the callbacks
+    int32_t unused_memo_index;
+    Status st = memo_table->GetOrInsert(
+        args..., [action](int32_t memo_index) { action->ObserveFound(memo_index); },
+        [action](int32_t memo_index) { action->ObserveNotFound(memo_index); },
+        &unused_memo_index);
+    if (ARROW_PREDICT_FALSE(!st.ok())) {
+      throw HashException(st.message(), st.code());
+    }
+  } else {
+    const int32_t memo_index = memo_table->Get(args...);
+    if (memo_index == internal::kKeyNotFound) {
+      throw HashException("Encountered new dictionary value");
+    }
+    action->ObserveFound(memo_index);
+  }
+}
+
+#define GENERIC_HASH_PASS(HASH_INNER_LOOP)                                               \
+  if (arr.null_count != 0) {                                                             \
+    internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length); \
+    for (int64_t i = 0; i < arr.length; ++i) {                                           \
+      const bool is_null = valid_reader.IsNotSet();                                      \
+      valid_reader.Next();                                                               \
+                                                                                         \
+      if (is_null) {                                                                     \
+        action->ObserveNull();                                                           \
+        continue;                                                                        \
+      }                                                                                  \
+                                                                                         \
+      HASH_INNER_LOOP();                                                                 \
+    }                                                                                    \
+  } else {                                                                               \
+    for (int64_t i = 0; i < arr.length; ++i) {                                           \
+      HASH_INNER_LOOP();                                                                 \
+    }                                                                                    \
+  }
 
 // ----------------------------------------------------------------------
 // Hash table pass for nulls
@@ -162,15 +162,7 @@ class HashTableKernel<Type, Action, enable_if_null<Type>> : public HashTable {
  public:
   using HashTable::HashTable;
 
-  Status Init() {
-    // No-op, do not even need to initialize hash table
-    return Status::OK();
-  }
-
   Status Append(const ArrayData& arr) override {
-    if (!initialized_) {
-      RETURN_NOT_OK(Init());
-    }
     auto action = checked_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
     for (int64_t i = 0; i < arr.length; ++i) {
@@ -188,113 +180,27 @@ class HashTableKernel<Type, Action, enable_if_null<Type>> : public HashTable {
 };
 
 // ----------------------------------------------------------------------
-// Hash table pass for primitive types
-
-template <typename Type>
-struct HashDictionary<Type, enable_if_has_c_type<Type>> {
-  using T = typename Type::c_type;
-
-  explicit HashDictionary(MemoryPool* pool) : pool(pool), size(0), capacity(0) {}
-
-  Status Init() {
-    this->size = 0;
-    RETURN_NOT_OK(AllocateResizableBuffer(this->pool, 0, &this->buffer));
-    return Resize(kInitialHashTableSize);
-  }
-
-  Status DoubleSize() { return Resize(this->size * 2); }
-
-  Status Resize(const int64_t elements) {
-    RETURN_NOT_OK(this->buffer->Resize(elements * sizeof(T)));
-
-    this->capacity = elements;
-    this->values = reinterpret_cast<T*>(this->buffer->mutable_data());
-    return Status::OK();
-  }
-
-  MemoryPool* pool;
-  std::shared_ptr<ResizableBuffer> buffer;
-  T* values;
-  int64_t size;
-  int64_t capacity;
-};
-
-#define GENERIC_HASH_PASS(HASH_INNER_LOOP)                                               \
-  if (arr.null_count != 0) {                                                             \
-    internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length); \
-    for (int64_t i = 0; i < arr.length; ++i) {                                           \
-      const bool is_null = valid_reader.IsNotSet();                                      \
-      valid_reader.Next();                                                               \
-                                                                                         \
-      if (is_null) {                                                                     \
-        action->ObserveNull();                                                           \
-        continue;                                                                        \
-      }                                                                                  \
-                                                                                         \
-      HASH_INNER_LOOP();                                                                 \
-    }                                                                                    \
-  } else {                                                                               \
-    for (int64_t i = 0; i < arr.length; ++i) {                                           \
-      HASH_INNER_LOOP();                                                                 \
-    }                                                                                    \
-  }
+// Hash table pass for primitive types, including the 8-bit integers which
+// use a direct lookup table
 
 template <typename Type, typename Action>
-class HashTableKernel<
-    Type, Action,
-    typename std::enable_if<has_c_type<Type>::value && !is_8bit_int<Type>::value>::type>
-    : public HashTable {
+class HashTableKernel<Type, Action, enable_if_has_c_type<Type>> : public HashTable {
  public:
   using T = typename Type::c_type;
+  using MemoTableType = typename internal::HashTraits<Type>::MemoTableType;
 
   HashTableKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : HashTable(type, pool), dict_(pool) {}
-
-  Status Init() {
-    RETURN_NOT_OK(dict_.Init());
-    return HashTable::Init(kInitialHashTableSize);
-  }
+      : HashTable(type, pool), memo_table_(pool, 0) {}
 
   Status Append(const ArrayData& arr) override {
-    if (!initialized_) {
-      RETURN_NOT_OK(Init());
-    }
-
     const T* values = GetValues<T>(arr, 1);
     auto action = checked_cast<Action*>(this);
 
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                               \
-  const T value = values[i];                                            \
-  int64_t j = HashValue(value) & mod_bitmask_;                          \
-  hash_slot_t slot = hash_slots_[j];                                    \
-                                                                        \
-  while (kHashSlotEmpty != slot && dict_.values[slot] != value) {       \
-    ++j;                                                                \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                   \
-      j = 0;                                                            \
-    }                                                                   \
-    slot = hash_slots_[j];                                              \
-  }                                                                     \
-                                                                        \
-  if (slot == kHashSlotEmpty) {                                         \
-    if (!Action::allow_expand) {                                        \
-      throw HashException("Encountered new dictionary value");          \
-    }                                                                   \
-                                                                        \
-    slot = static_cast<hash_slot_t>(dict_.size);                        \
-    hash_slots_[j] = slot;                                              \
-    dict_.values[dict_.size++] = value;                                 \
-                                                                        \
-    action->ObserveNotFound(slot);                                      \
-                                                                        \
-    if (ARROW_PREDICT_FALSE(dict_.size > hash_table_load_threshold_)) { \
-      RETURN_NOT_OK(action->DoubleSize());                              \
-    }                                                                   \
-  } else {                                                              \
-    action->ObserveFound(slot);                                         \
-  }
+#define HASH_INNER_LOOP()    \
+  const T value = values[i]; \
+  ObserveValue(action, &memo_table_, value)
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
 
@@ -305,33 +211,12 @@ class HashTableKernel<
 
   Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
     // TODO(wesm): handle null being in the dictionary
-    auto dict_data = dict_.buffer;
-    RETURN_NOT_OK(dict_data->Resize(dict_.size * sizeof(T), false));
-    dict_data->ZeroPadding();
-
-    *out = ArrayData::Make(type_, dict_.size, {nullptr, dict_data}, 0);
-    return Status::OK();
+    return internal::DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_,
+                                                                    memo_table_, 0, out);
   }
 
  protected:
-  int64_t HashValue(const T& value) const {
-    // TODO(wesm): Use faster hash function for C types
-    return HashUtil::Hash<HASH_USE_SSE>(&value, sizeof(T), 0);
-  }
-
-  Status DoubleTableSize() {
-#define PRIMITIVE_INNER_LOOP           \
-  const T value = dict_.values[index]; \
-  int64_t j = HashValue(value) & new_mod_bitmask;
-
-    DOUBLE_TABLE_SIZE(, PRIMITIVE_INNER_LOOP);
-
-#undef PRIMITIVE_INNER_LOOP
-
-    return dict_.Resize(hash_table_size_);
-  }
-
-  HashDictionary<Type> dict_;
+  MemoTableType memo_table_;
 };
 
 // ----------------------------------------------------------------------
@@ -340,10 +225,10 @@ class HashTableKernel<
 template <typename Type, typename Action>
 class HashTableKernel<Type, Action, enable_if_boolean<Type>> : public HashTable {
  public:
+  using MemoTableType = typename internal::HashTraits<Type>::MemoTableType;
+
   HashTableKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : HashTable(type, pool) {
-    std::fill(table_, table_ + 2, kHashSlotEmpty);
-  }
+      : HashTable(type, pool), memo_table_(pool, 0) {}
 
   Status Append(const ArrayData& arr) override {
     auto action = checked_cast<Action*>(this);
@@ -352,18 +237,6 @@ class HashTableKernel<Type, Action, enable_if_boolean<Type>> : public HashTable
 
     internal::BitmapReader value_reader(arr.buffers[1]->data(), arr.offset, arr.length);
 
-#define HASH_INNER_LOOP()                                      \
-  if (slot == kHashSlotEmpty) {                                \
-    if (!Action::allow_expand) {                               \
-      throw HashException("Encountered new dictionary value"); \
-    }                                                          \
-    table_[j] = slot = static_cast<hash_slot_t>(dict_.size()); \
-    dict_.push_back(value);                                    \
-    action->ObserveNotFound(slot);                             \
-  } else {                                                     \
-    action->ObserveFound(slot);                                \
-  }
-
     if (arr.null_count != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
       for (int64_t i = 0; i < arr.length; ++i) {
@@ -376,36 +249,26 @@ class HashTableKernel<Type, Action, enable_if_boolean<Type>> : public HashTable
         }
         const bool value = value_reader.IsSet();
         value_reader.Next();
-        const int j = value ? 1 : 0;
-        hash_slot_t slot = table_[j];
-        HASH_INNER_LOOP();
+        ObserveValue(action, &memo_table_, value);
       }
     } else {
       for (int64_t i = 0; i < arr.length; ++i) {
         const bool value = value_reader.IsSet();
         value_reader.Next();
-        const int j = value ? 1 : 0;
-        hash_slot_t slot = table_[j];
-        HASH_INNER_LOOP();
+        ObserveValue(action, &memo_table_, value);
       }
     }
 
-#undef HASH_INNER_LOOP
-
     return Status::OK();
   }
 
   Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
-    BooleanBuilder builder(pool_);
-    for (const bool value : dict_) {
-      RETURN_NOT_OK(builder.Append(value));
-    }
-    return builder.FinishInternal(out);
+    return internal::DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_,
+                                                                    memo_table_, 0, out);
   }
 
  private:
-  hash_slot_t table_[2];
-  std::vector<bool> dict_;
+  MemoTableType memo_table_;
 };
 
 // ----------------------------------------------------------------------
@@ -415,26 +278,10 @@ template <typename Type, typename Action>
 class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
  public:
   HashTableKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : HashTable(type, pool), dict_offsets_(pool), dict_data_(pool), dict_size_(0) {}
-
-  Status Init() {
-    RETURN_NOT_OK(dict_offsets_.Resize(kInitialHashTableSize));
-
-    // We append the end offset after each append to the dictionary, so this
-    // sets the initial condition for the length-0 case
-    //
-    // initial offsets (dict size == 0): 0
-    // after 1st dict entry of length 3: 0 3
-    // after 2nd dict entry of length 4: 0 3 7
-    RETURN_NOT_OK(dict_offsets_.Append(0));
-    return HashTable::Init(kInitialHashTableSize);
-  }
+      : HashTable(type, pool), memo_table_(pool, 0) {}
 
   Status Append(const ArrayData& arr) override {
     constexpr uint8_t empty_value = 0;
-    if (!initialized_) {
-      RETURN_NOT_OK(Init());
-    }
 
     const int32_t* offsets = GetValues<int32_t>(arr, 1);
     const uint8_t* data;
@@ -447,45 +294,10 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
     auto action = checked_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                                           \
-  const int32_t position = offsets[i];                                              \
-  const int32_t length = offsets[i + 1] - position;                                 \
-  const uint8_t* value = data + position;                                           \
-                                                                                    \
-  int64_t j = HashValue(value, length) & mod_bitmask_;                              \
-  hash_slot_t slot = hash_slots_[j];                                                \
-                                                                                    \
-  const int32_t* dict_offsets = dict_offsets_.data();                               \
-  const uint8_t* dict_data = dict_data_.data();                                     \
-  while (kHashSlotEmpty != slot &&                                                  \
-         !((dict_offsets[slot + 1] - dict_offsets[slot]) == length &&               \
-           0 == memcmp(value, dict_data + dict_offsets[slot], length))) {           \
-    ++j;                                                                            \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                               \
-      j = 0;                                                                        \
-    }                                                                               \
-    slot = hash_slots_[j];                                                          \
-  }                                                                                 \
-                                                                                    \
-  if (slot == kHashSlotEmpty) {                                                     \
-    if (!Action::allow_expand) {                                                    \
-      throw HashException("Encountered new dictionary value");                      \
-    }                                                                               \
-                                                                                    \
-    slot = dict_size_++;                                                            \
-    hash_slots_[j] = slot;                                                          \
-                                                                                    \
-    RETURN_NOT_OK(dict_data_.Append(value, length));                                \
-    RETURN_NOT_OK(dict_offsets_.Append(static_cast<int32_t>(dict_data_.length()))); \
-                                                                                    \
-    action->ObserveNotFound(slot);                                                  \
-                                                                                    \
-    if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {             \
-      RETURN_NOT_OK(action->DoubleSize());                                          \
-    }                                                                               \
-  } else {                                                                          \
-    action->ObserveFound(slot);                                                     \
-  }
+#define HASH_INNER_LOOP()                           \
+  const int32_t position = offsets[i];              \
+  const int32_t length = offsets[i + 1] - position; \
+  ObserveValue(action, &memo_table_, data + position, length)
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
 
@@ -496,41 +308,12 @@ class HashTableKernel<Type, Action, enable_if_binary<Type>> : public HashTable {
 
   Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
     // TODO(wesm): handle null being in the dictionary
-    BufferVector buffers = {nullptr, nullptr, nullptr};
-
-    RETURN_NOT_OK(dict_offsets_.Finish(&buffers[1]));
-    RETURN_NOT_OK(dict_data_.Finish(&buffers[2]));
-
-    *out = ArrayData::Make(type_, dict_size_, std::move(buffers), 0);
-    return Status::OK();
+    return internal::DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_,
+                                                                    memo_table_, 0, out);
   }
 
  protected:
-  int64_t HashValue(const uint8_t* data, int32_t length) const {
-    return HashUtil::Hash<HASH_USE_SSE>(data, length, 0);
-  }
-
-  Status DoubleTableSize() {
-#define VARBYTES_SETUP                                \
-  const int32_t* dict_offsets = dict_offsets_.data(); \
-  const uint8_t* dict_data = dict_data_.data()
-
-#define VARBYTES_COMPUTE_HASH                                           \
-  const int32_t length = dict_offsets[index + 1] - dict_offsets[index]; \
-  const uint8_t* value = dict_data + dict_offsets[index];               \
-  int64_t j = HashValue(value, length) & new_mod_bitmask
-
-    DOUBLE_TABLE_SIZE(VARBYTES_SETUP, VARBYTES_COMPUTE_HASH);
-
-#undef VARBYTES_SETUP
-#undef VARBYTES_COMPUTE_HASH
-
-    return Status::OK();
-  }
-
-  TypedBufferBuilder<int32_t> dict_offsets_;
-  TypedBufferBuilder<uint8_t> dict_data_;
-  int32_t dict_size_;
+  internal::BinaryMemoTable memo_table_;
 };
 
 // ----------------------------------------------------------------------
@@ -541,59 +324,19 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
     : public HashTable {
  public:
   HashTableKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : HashTable(type, pool), dict_data_(pool), dict_size_(0) {
+      : HashTable(type, pool), memo_table_(pool, 0) {
     const auto& fw_type = checked_cast<const FixedSizeBinaryType&>(*type);
     byte_width_ = fw_type.bit_width() / 8;
   }
 
-  Status Init() {
-    RETURN_NOT_OK(dict_data_.Resize(kInitialHashTableSize * byte_width_));
-    return HashTable::Init(kInitialHashTableSize);
-  }
-
   Status Append(const ArrayData& arr) override {
-    if (!initialized_) {
-      RETURN_NOT_OK(Init());
-    }
-
     const uint8_t* data = GetValues<uint8_t>(arr, 1);
 
     auto action = checked_cast<Action*>(this);
     RETURN_NOT_OK(action->Reserve(arr.length));
 
-#define HASH_INNER_LOOP()                                                      \
-  const uint8_t* value = data + i * byte_width_;                               \
-  int64_t j = HashValue(value) & mod_bitmask_;                                 \
-  hash_slot_t slot = hash_slots_[j];                                           \
-                                                                               \
-  const uint8_t* dict_data = dict_data_.data();                                \
-  while (kHashSlotEmpty != slot &&                                             \
-         !(0 == memcmp(value, dict_data + slot * byte_width_, byte_width_))) { \
-    ++j;                                                                       \
-    if (ARROW_PREDICT_FALSE(j == hash_table_size_)) {                          \
-      j = 0;                                                                   \
-    }                                                                          \
-    slot = hash_slots_[j];                                                     \
-  }                                                                            \
-                                                                               \
-  if (slot == kHashSlotEmpty) {                                                \
-    if (!Action::allow_expand) {                                               \
-      throw HashException("Encountered new dictionary value");                 \
-    }                                                                          \
-                                                                               \
-    slot = dict_size_++;                                                       \
-    hash_slots_[j] = slot;                                                     \
-                                                                               \
-    RETURN_NOT_OK(dict_data_.Append(value, byte_width_));                      \
-                                                                               \
-    action->ObserveNotFound(slot);                                             \
-                                                                               \
-    if (ARROW_PREDICT_FALSE(dict_size_ > hash_table_load_threshold_)) {        \
-      RETURN_NOT_OK(action->DoubleSize());                                     \
-    }                                                                          \
-  } else {                                                                     \
-    action->ObserveFound(slot);                                                \
-  }
+#define HASH_INNER_LOOP() \
+  ObserveValue(action, &memo_table_, data + i * byte_width_, byte_width_)
 
     GENERIC_HASH_PASS(HASH_INNER_LOOP);
 
@@ -604,109 +347,13 @@ class HashTableKernel<Type, Action, enable_if_fixed_size_binary<Type>>
 
   Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
     // TODO(wesm): handle null being in the dictionary
-    BufferVector buffers = {nullptr, nullptr};
-    RETURN_NOT_OK(dict_data_.Finish(&buffers[1]));
-
-    *out = ArrayData::Make(type_, dict_size_, std::move(buffers), 0);
-    return Status::OK();
+    return internal::DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_,
+                                                                    memo_table_, 0, out);
   }
 
  protected:
-  int64_t HashValue(const uint8_t* data) const {
-    return HashUtil::Hash<HASH_USE_SSE>(data, byte_width_, 0);
-  }
-
-  Status DoubleTableSize() {
-#define FIXED_BYTES_SETUP const uint8_t* dict_data = dict_data_.data()
-
-#define FIXED_BYTES_COMPUTE_HASH \
-  int64_t j = HashValue(dict_data + index * byte_width_) & new_mod_bitmask
-
-    DOUBLE_TABLE_SIZE(FIXED_BYTES_SETUP, FIXED_BYTES_COMPUTE_HASH);
-
-#undef FIXED_BYTES_SETUP
-#undef FIXED_BYTES_COMPUTE_HASH
-
-    return Status::OK();
-  }
-
   int32_t byte_width_;
-  TypedBufferBuilder<uint8_t> dict_data_;
-  int32_t dict_size_;
-};
-
-// ----------------------------------------------------------------------
-// Hash table pass for uint8 and int8
-
-template <typename T>
-inline int Hash8Bit(const T val) {
-  return 0;
-}
-
-template <>
-inline int Hash8Bit(const uint8_t val) {
-  return val;
-}
-
-template <>
-inline int Hash8Bit(const int8_t val) {
-  return val + 128;
-}
-
-template <typename Type, typename Action>
-class HashTableKernel<Type, Action, enable_if_8bit_int<Type>> : public HashTable {
- public:
-  using T = typename Type::c_type;
-
-  HashTableKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : HashTable(type, pool) {
-    std::fill(table_, table_ + 256, kHashSlotEmpty);
-  }
-
-  Status Append(const ArrayData& arr) override {
-    const T* values = GetValues<T>(arr, 1);
-    auto action = checked_cast<Action*>(this);
-    RETURN_NOT_OK(action->Reserve(arr.length));
-
-#define HASH_INNER_LOOP()                                      \
-  const T value = values[i];                                   \
-  const int hash = Hash8Bit<T>(value);                         \
-  hash_slot_t slot = table_[hash];                             \
-                                                               \
-  if (slot == kHashSlotEmpty) {                                \
-    if (!Action::allow_expand) {                               \
-      throw HashException("Encountered new dictionary value"); \
-    }                                                          \
-                                                               \
-    slot = static_cast<hash_slot_t>(dict_.size());             \
-    table_[hash] = slot;                                       \
-    dict_.push_back(value);                                    \
-    action->ObserveNotFound(slot);                             \
-  } else {                                                     \
-    action->ObserveFound(slot);                                \
-  }
-
-    GENERIC_HASH_PASS(HASH_INNER_LOOP);
-
-#undef HASH_INNER_LOOP
-
-    return Status::OK();
-  }
-
-  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
-    using BuilderType = typename TypeTraits<Type>::BuilderType;
-    BuilderType builder(pool_);
-
-    for (const T value : dict_) {
-      RETURN_NOT_OK(builder.Append(value));
-    }
-
-    return builder.FinishInternal(out);
-  }
-
- private:
-  hash_slot_t table_[256];
-  std::vector<T> dict_;
+  internal::BinaryMemoTable memo_table_;
 };
 
 // ----------------------------------------------------------------------
@@ -721,11 +368,9 @@ class UniqueImpl : public HashTableKernel<Type, UniqueImpl<Type>> {
 
   Status Reserve(const int64_t length) { return Status::OK(); }
 
-  void ObserveFound(const hash_slot_t slot) {}
+  void ObserveFound(const int32_t memo_index) {}
   void ObserveNull() {}
-  void ObserveNotFound(const hash_slot_t slot) {}
-
-  Status DoubleSize() { return Base::DoubleTableSize(); }
+  void ObserveNotFound(const int32_t memo_index) {}
 
   Status Append(const ArrayData& input) override { return Base::Append(input); }
 
@@ -751,11 +396,11 @@ class DictEncodeImpl : public HashTableKernel<Type, DictEncodeImpl<Type>> {
 
   void ObserveNull() { indices_builder_.UnsafeAppendToBitmap(false); }
 
-  void ObserveFound(const hash_slot_t slot) { indices_builder_.UnsafeAppend(slot); }
-
-  void ObserveNotFound(const hash_slot_t slot) { return ObserveFound(slot); }
+  void ObserveFound(const int32_t memo_index) {
+    indices_builder_.UnsafeAppend(memo_index);
+  }
 
-  Status DoubleSize() { return Base::DoubleTableSize(); }
+  void ObserveNotFound(const int32_t memo_index) { return ObserveFound(memo_index); }
 
   Status Flush(Datum* out) override {
     std::shared_ptr<ArrayData> result;
@@ -207,8 +207,10 @@ Status VarSizeBinaryConverter<T>::Convert(const BlockParser& parser, int32_t col
 
   // TODO handle nulls
 
+  // The builder is fully reserved below, so values can be appended unchecked
   auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-    return builder.Append(data, size);
+    builder.UnsafeAppend(data, size);
+    return Status::OK();
   };
   RETURN_NOT_OK(builder.Resize(parser.num_rows()));
   RETURN_NOT_OK(builder.ReserveData(parser.num_bytes()));
@@ -253,7 +255,7 @@ Status FixedSizeBinaryConverter::Convert(const BlockParser& parser, int32_t col_
 }
 
 /////////////////////////////////////////////////////////////////////////
-// Concrete Converter for numbers
+// Concrete Converter for numbers, timestamps and decimals
 
 template <typename T>
 class NumericConverter : public ConcreteConverter {
@@ -271,7 +273,7 @@ Status NumericConverter<T>::Convert(const BlockParser& parser, int32_t col_index
   using value_type = typename StringConverter<T>::value_type;
 
   BuilderType builder(type_, pool_);
-  StringConverter<T> converter;
+  StringConverter<T> converter(type_);
 
   auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
     value_type value;
@@ -325,6 +327,8 @@ Status Converter::Make(const std::shared_ptr<DataType>& type, ConvertOptions opt
     CONVERTER_CASE(Type::FLOAT, NumericConverter<FloatType>)
     CONVERTER_CASE(Type::DOUBLE, NumericConverter<DoubleType>)
     CONVERTER_CASE(Type::BOOL, NumericConverter<BooleanType>)
+    CONVERTER_CASE(Type::TIMESTAMP, NumericConverter<TimestampType>)
+    CONVERTER_CASE(Type::DECIMAL, NumericConverter<Decimal128Type>)
 
     default: {
       std::stringstream ss;
@@ -29,6 +29,7 @@
 #include "arrow/status.h"
 #include "arrow/test-util.h"
 #include "arrow/type.h"
+#include "arrow/util/decimal.h"
 
 namespace arrow {
 namespace csv {
@@ -185,10 +186,74 @@ TEST(BooleanConversion, Nulls) {
                                       {{true, true}, {false, true}});
 }
 
-TEST(DecimalConversion, NotImplemented) {
+TEST(TimestampConversion, Basics) {
+  auto type = timestamp(TimeUnit::SECOND);
+
+  AssertConversion<TimestampType, int64_t>(
+      type, {"1970-01-01,2018-11-13 17:11:10\n", "2000-02-29,1900-02-28T12:34:56Z\n"},
+      {{0, 951782400}, {1542129070, -2203932304LL}});
+
+  type = timestamp(TimeUnit::NANO);
+  AssertConversion<TimestampType, int64_t>(
+      type, {"1970-01-01\n", "2000-02-29\n", "1900-02-28\n"},
+      {{0, 951782400000000000LL, -2203977600000000000LL}});
+}
+
+TEST(TimestampConversion, Nulls) {
+  auto type = timestamp(TimeUnit::MILLI);
+  AssertConversion<TimestampType, int64_t>(
+      type, {"1970-01-01 00:01,\n,2018-11-13 17:11:10.5\n"},
+      {{60000, 0}, {0, 1542129070500LL}}, {{true, false}, {false, true}});
+
+  AssertConversionAllNulls<TimestampType, int64_t>(type);
+}
+
+TEST(TimestampConversion, Errors) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array;
+  std::shared_ptr<DataType> type = timestamp(TimeUnit::SECOND);
+
+  ASSERT_OK(Converter::Make(type, ConvertOptions::Defaults(), &converter));
+
+  MakeCSVParser({"1970-01-01 00:00:00.5,1970-01-01\n"}, &parser);
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 0, &array));
+  ASSERT_OK(converter->Convert(*parser, 1, &array));
+}
+
+TEST(DecimalConversion, Basics) {
+  AssertConversion<Decimal128Type, Decimal128>(
+      decimal(12, 3), {"12,-34.5\n", "0.001,1.5E3\n"},
+      {{Decimal128(12000), Decimal128(1)}, {Decimal128(-34500), Decimal128(1500000)}});
+}
+
+TEST(DecimalConversion, Nulls) {
+  AssertConversion<Decimal128Type, Decimal128>(
+      decimal(12, 3), {"12,\n", ",-34.5\n"},
+      {{Decimal128(12000), Decimal128()}, {Decimal128(), Decimal128(-34500)}},
+      {{true, false}, {false, true}});
+
+  AssertConversionAllNulls<Decimal128Type, Decimal128>(decimal(12, 3));
+}
+
+TEST(DecimalConversion, Errors) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array;
+  std::shared_ptr<DataType> type = decimal(5, 2);
+
+  ASSERT_OK(Converter::Make(type, ConvertOptions::Defaults(), &converter));
+
+  MakeCSVParser({"1.234,1000,1.23\n"}, &parser);
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 0, &array));
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 1, &array));
+  ASSERT_OK(converter->Convert(*parser, 2, &array));
+}
+
+TEST(ListConversion, NotImplemented) {
   std::shared_ptr<Converter> converter;
   ASSERT_RAISES(NotImplemented,
-                Converter::Make(decimal(12, 3), ConvertOptions::Defaults(), &converter));
+                Converter::Make(list(int32()), ConvertOptions::Defaults(), &converter));
 }
 
 }  // namespace csv
@@ -17,12 +17,23 @@
 
 #include "arrow/dbi/hiveserver2/columnar-row-set.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 #include "arrow/dbi/hiveserver2/thrift-internal.h"
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
@@ -96,5 +107,176 @@ std::unique_ptr<BinaryColumn> ColumnarRowSet::GetBinaryCol(int i) const {
   return GetCol<BinaryColumn>(i);
 }
 
+namespace {
+
+// HiveServer2 null bitmaps have a bit set for every null value, which is the
+// opposite of Arrow validity bitmaps. They may also be shorter than the column
+// (see Column), the missing bits meaning that the values are not null.
+Status NullsToValidity(const std::string& nulls, int64_t length, MemoryPool* pool,
+                       std::shared_ptr<Buffer>* out, int64_t* null_count) {
+  const auto nulls_data = reinterpret_cast<const uint8_t*>(nulls.data());
+  const int64_t nbits = std::min(static_cast<int64_t>(nulls.size()) * 8, length);
+  *null_count = internal::CountSetBits(nulls_data, 0, nbits);
+  if (*null_count == 0) {
+    out->reset();
+    return Status::OK();
+  }
+
+  const int64_t nbytes = BitUtil::BytesForBits(length);
+  const int64_t nulls_bytes = BitUtil::BytesForBits(nbits);
+  RETURN_NOT_OK(AllocateBuffer(pool, nbytes, out));
+  uint8_t* validity = (*out)->mutable_data();
+  for (int64_t i = 0; i < nulls_bytes; ++i) {
+    validity[i] = static_cast<uint8_t>(~nulls_data[i]);
+  }
+  std::memset(validity + nulls_bytes, 0xFF, static_cast<size_t>(nbytes - nulls_bytes));
+  return Status::OK();
+}
+
+template <typename TColumnValues>
+Status MakeValidity(const TColumnValues& values, MemoryPool* pool,
+                    std::shared_ptr<ArrayData>* out) {
+  const int64_t length = static_cast<int64_t>(values.values.size());
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  RETURN_NOT_OK(NullsToValidity(values.nulls, length, pool, &validity, &null_count));
+  (*out)->length = length;
+  (*out)->null_count = null_count;
+  (*out)->buffers = {validity};
+  return Status::OK();
+}
+
+Status ConvertBooleanColumn(const hs2::TBoolColumn& values, MemoryPool* pool,
+                            std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(MakeValidity(values, pool, out));
+  const int64_t length = (*out)->length;
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), &data));
+  auto it = values.values.begin();
+  internal::GenerateBitsUnrolled(data->mutable_data(), 0, length,
+                                 [&it]() -> bool { return *it++; });
+  (*out)->buffers.push_back(data);
+  return Status::OK();
+}
+
+// Copy the values of a numeric column, converting them if the HiveServer2
+// representation is wider (FLOAT columns are sent as doubles)
+template <typename CType, typename TColumnValues>
+Status ConvertNumericColumn(const TColumnValues& values, MemoryPool* pool,
+                            std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(MakeValidity(values, pool, out));
+  const int64_t length = (*out)->length;
+  std::shared_ptr<Buffer> data;
+  const int64_t data_size = length * static_cast<int64_t>(sizeof(CType));
+  RETURN_NOT_OK(AllocateBuffer(pool, data_size, &data));
+  std::copy(values.values.begin(), values.values.end(),
+            reinterpret_cast<CType*>(data->mutable_data()));
+  (*out)->buffers.push_back(data);
+  return Status::OK();
+}
+
+// Assemble the offsets and the data of a string or binary column in one pass
+template <typename TColumnValues>
+Status ConvertBinaryColumn(const TColumnValues& values, MemoryPool* pool,
+                           std::shared_ptr<ArrayData>* out) {
+  RETURN_NOT_OK(MakeValidity(values, pool, out));
+  const int64_t length = (*out)->length;
+
+  int64_t data_length = 0;
+  for (const std::string& value : values.values) {
+    data_length += static_cast<int64_t>(value.size());
+  }
+  if (data_length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Fetched string column larger than 2GB");
+  }
+
+  std::shared_ptr<Buffer> offsets, data;
+  const int64_t offsets_size = (length + 1) * static_cast<int64_t>(sizeof(int32_t));
+  RETURN_NOT_OK(AllocateBuffer(pool, offsets_size, &offsets));
+  RETURN_NOT_OK(AllocateBuffer(pool, data_length, &data));
+  auto raw_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+  uint8_t* raw_data = data->mutable_data();
+  int32_t offset = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    const std::string& value = values.values[i];
+    raw_offsets[i] = offset;
+    std::memcpy(raw_data + offset, value.data(), value.size());
+    offset += static_cast<int32_t>(value.size());
+  }
+  raw_offsets[length] = offset;
+  (*out)->buffers.push_back(offsets);
+  (*out)->buffers.push_back(data);
+  return Status::OK();
+}
+
+Status ConvertColumn(const hs2::TColumn& column, MemoryPool* pool,
+                     std::shared_ptr<ArrayData>* out) {
+  switch ((*out)->type->id()) {
+    case Type::BOOL:
+      return ConvertBooleanColumn(column.boolVal, pool, out);
+    case Type::INT8:
+      return ConvertNumericColumn<int8_t>(column.byteVal, pool, out);
+    case Type::INT16:
+      return ConvertNumericColumn<int16_t>(column.i16Val, pool, out);
+    case Type::INT32:
+      return ConvertNumericColumn<int32_t>(column.i32Val, pool, out);
+    case Type::INT64:
+      return ConvertNumericColumn<int64_t>(column.i64Val, pool, out);
+    case Type::FLOAT:
+      return ConvertNumericColumn<float>(column.doubleVal, pool, out);
+    case Type::DOUBLE:
+      return ConvertNumericColumn<double>(column.doubleVal, pool, out);
+    case Type::STRING:
+      return ConvertBinaryColumn(column.stringVal, pool, out);
+    case Type::BINARY:
+      if (column.__isset.binaryVal) {
+        return ConvertBinaryColumn(column.binaryVal, pool, out);
+      }
+      return ConvertBinaryColumn(column.stringVal, pool, out);
+    default: {
+      std::stringstream ss;
+      ss << "Cannot convert fetched column to " << (*out)->type->ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+}
+
+}  // namespace
+
+Status ColumnarRowSet::ToRecordBatch(const std::shared_ptr<Schema>& schema,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatch>* out) const {
+  const std::vector<hs2::TColumn>& columns = impl_->resp.results.columns;
+  if (static_cast<int>(columns.size()) != schema->num_fields()) {
+    std::stringstream ss;
+    ss << "Fetched " << columns.size() << " columns, but the schema has "
+       << schema->num_fields() << " fields";
+    return Status::Invalid(ss.str());
+  }
+
+  std::vector<std::shared_ptr<ArrayData>> arrays(columns.size());
+  int64_t num_rows = 0;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    arrays[i] = std::make_shared<ArrayData>(schema->field(i)->type(), 0);
+    if (arrays[i]->type->id() == Type::NA) {
+      continue;
+    }
+    RETURN_NOT_OK(ConvertColumn(columns[i], pool, &arrays[i]));
+    num_rows = arrays[i]->length;
+  }
+  for (const auto& array : arrays) {
+    if (array->type->id() == Type::NA) {
+      // The values of NULL columns carry no information
+      array->length = array->null_count = num_rows;
+      array->buffers = {nullptr};
+    } else if (array->length != num_rows) {
+      return Status::Invalid("Fetched columns have different lengths");
+    }
+  }
+
+  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  return Status::OK();
+}
+
 }  // namespace hiveserver2
 }  // namespace arrow
@@ -26,6 +26,12 @@
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class MemoryPool;
+class RecordBatch;
+class Schema;
+class Status;
+
 namespace hiveserver2 {
 
 // The Column class is used to access data that was fetched in columnar format.
@@ -137,6 +143,12 @@ class ARROW_EXPORT ColumnarRowSet {
   template <typename T>
   std::unique_ptr<T> GetCol(int i) const;
 
+  // Converts the columns to an Arrow RecordBatch with the given schema, which is
+  // usually obtained from Operation::GetArrowSchema(). The values are copied in
+  // bulk, and the RecordBatch remains valid after this ColumnarRowSet is deleted.
+  Status ToRecordBatch(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+                       std::shared_ptr<RecordBatch>* out) const;
+
  private:
   // Hides Thrift objects from the header.
   struct ColumnarRowSetImpl;
@@ -28,8 +28,11 @@
 #include "arrow/dbi/hiveserver2/session.h"
 #include "arrow/dbi/hiveserver2/thrift-internal.h"
 
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/test-util.h"
+#include "arrow/type.h"
 
 using std::string;
 using std::unique_ptr;
@@ -284,6 +287,75 @@ TEST_F(OperationTest, TestIsNull) {
   ASSERT_OK(select_nulls_op->Close());
 }
 
+TEST_F(OperationTest, TestFetchRecordBatch) {
+  CreateTestTable();
+  InsertIntoTestTable(vector<int>({1, 2, 3, 4, 5, NULL_INT_VALUE}),
+                      vector<string>({"a", "b", "NULL", "d", "NULL", "f"}));
+
+  unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+
+  std::shared_ptr<Schema> schema;
+  ASSERT_OK(select_op->GetArrowSchema(&schema));
+  ASSERT_TRUE(schema->Equals(
+      *::arrow::schema({field(TEST_COL1, int32()), field(TEST_COL2, utf8())})));
+
+  std::shared_ptr<RecordBatch> batch;
+  bool has_more_rows = false;
+  ASSERT_OK(select_op->Fetch(4, schema, default_memory_pool(), &batch, &has_more_rows));
+  ASSERT_TRUE(has_more_rows);
+  std::shared_ptr<Array> expected_ints, expected_strings;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3, 4}, &expected_ints);
+  ArrayFromVector<StringType, string>({true, true, false, true}, {"a", "b", "", "d"},
+                                      &expected_strings);
+  AssertArraysEqual(*expected_ints, *batch->column(0));
+  AssertArraysEqual(*expected_strings, *batch->column(1));
+
+  ASSERT_OK(select_op->Fetch(4, schema, default_memory_pool(), &batch, &has_more_rows));
+  ArrayFromVector<Int32Type, int32_t>({true, false}, {5, 0}, &expected_ints);
+  ArrayFromVector<StringType, string>({false, true}, {"", "f"}, &expected_strings);
+  AssertArraysEqual(*expected_ints, *batch->column(0));
+  AssertArraysEqual(*expected_strings, *batch->column(1));
+
+  ASSERT_OK(select_op->Close());
+}
+
+TEST_F(OperationTest, TestRecordBatchReader) {
+  CreateTestTable();
+  InsertIntoTestTable(vector<int>({1, 2, 3, 4, 5}),
+                      vector<string>({"a", "b", "c", "d", "e"}));
+
+  unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(select_op->GetRecordBatchReader(2, default_memory_pool(), &reader));
+
+  vector<int32_t> ints;
+  vector<string> strings;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ASSERT_LE(batch->num_rows(), 2);
+    const auto& int_col = static_cast<const Int32Array&>(*batch->column(0));
+    const auto& string_col = static_cast<const StringArray&>(*batch->column(1));
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      ints.push_back(int_col.Value(i));
+      strings.push_back(string_col.GetString(i));
+    }
+  }
+  ASSERT_EQ(ints, vector<int32_t>({1, 2, 3, 4, 5}));
+  ASSERT_EQ(strings, vector<string>({"a", "b", "c", "d", "e"}));
+  reader.reset();
+
+  ASSERT_OK(select_op->Close());
+}
+
 TEST_F(OperationTest, TestCancel) {
   CreateTestTable();
   InsertIntoTestTable(vector<int>({1, 2, 3, 4}), vector<string>({"a", "b", "c", "d"}));
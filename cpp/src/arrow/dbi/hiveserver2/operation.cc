@@ -17,12 +17,18 @@
 
 #include "arrow/dbi/hiveserver2/operation.h"
 
+#include <future>
+#include <sstream>
+#include <utility>
+
 #include "arrow/dbi/hiveserver2/thrift-internal.h"
 
 #include "arrow/dbi/hiveserver2/ImpalaService_types.h"
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 
@@ -113,6 +119,159 @@ Status Operation::Fetch(int max_rows, FetchOrientation orientation,
   return status;
 }
 
+namespace {
+
+Status ColumnTypeToArrowType(const ColumnType& type, std::shared_ptr<DataType>* out) {
+  switch (type.type_id()) {
+    case ColumnType::TypeId::BOOLEAN:
+      *out = boolean();
+      break;
+    case ColumnType::TypeId::TINYINT:
+      *out = int8();
+      break;
+    case ColumnType::TypeId::SMALLINT:
+      *out = int16();
+      break;
+    case ColumnType::TypeId::INT:
+      *out = int32();
+      break;
+    case ColumnType::TypeId::BIGINT:
+      *out = int64();
+      break;
+    case ColumnType::TypeId::FLOAT:
+      *out = float32();
+      break;
+    case ColumnType::TypeId::DOUBLE:
+      *out = float64();
+      break;
+    case ColumnType::TypeId::STRING:
+    case ColumnType::TypeId::TIMESTAMP:
+    case ColumnType::TypeId::DECIMAL:
+    case ColumnType::TypeId::DATE:
+    case ColumnType::TypeId::VARCHAR:
+    case ColumnType::TypeId::CHAR:
+      *out = utf8();
+      break;
+    case ColumnType::TypeId::BINARY:
+      *out = binary();
+      break;
+    case ColumnType::TypeId::NULL_TYPE:
+      *out = null();
+      break;
+    default: {
+      std::stringstream ss;
+      ss << "No Arrow type for column type " << type.ToString();
+      return Status::NotImplemented(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+struct FetchResult {
+  Status status;
+  unique_ptr<ColumnarRowSet> results;
+  bool has_more_rows;
+};
+
+// Converts the fetched results to record batches, fetching the next results in the
+// background meanwhile
+class FetchRecordBatchReader : public RecordBatchReader {
+ public:
+  FetchRecordBatchReader(const Operation* operation, int max_rows,
+                         const std::shared_ptr<Schema>& schema, MemoryPool* pool)
+      : operation_(operation),
+        max_rows_(max_rows),
+        schema_(schema),
+        pool_(pool),
+        has_more_rows_(true) {}
+
+  ~FetchRecordBatchReader() override {
+    // The operation must not be used before the pending fetch completes
+    if (next_fetch_.valid()) {
+      next_fetch_.wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (true) {
+      if (!next_fetch_.valid()) {
+        if (!has_more_rows_) {
+          out->reset();
+          return Status::OK();
+        }
+        StartFetch();
+      }
+      FetchResult result = next_fetch_.get();
+      RETURN_NOT_OK(result.status);
+      has_more_rows_ = result.has_more_rows;
+      if (has_more_rows_) {
+        StartFetch();
+      }
+      RETURN_NOT_OK(result.results->ToRecordBatch(schema_, pool_, out));
+      if ((*out)->num_rows() > 0 || !has_more_rows_) {
+        if ((*out)->num_rows() == 0) {
+          out->reset();
+        }
+        return Status::OK();
+      }
+    }
+  }
+
+ private:
+  void StartFetch() {
+    const Operation* operation = operation_;
+    const int max_rows = max_rows_;
+    next_fetch_ = std::async(std::launch::async, [operation, max_rows]() {
+      FetchResult result;
+      result.status = operation->Fetch(max_rows, FetchOrientation::NEXT,
+                                       &result.results, &result.has_more_rows);
+      return result;
+    });
+  }
+
+  const Operation* operation_;
+  const int max_rows_;
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_;
+  bool has_more_rows_;
+  std::future<FetchResult> next_fetch_;
+};
+
+}  // namespace
+
+Status Operation::GetArrowSchema(std::shared_ptr<Schema>* out) const {
+  std::vector<ColumnDesc> column_descs;
+  RETURN_NOT_OK(GetResultSetMetadata(&column_descs));
+
+  std::vector<std::shared_ptr<Field>> fields;
+  fields.reserve(column_descs.size());
+  for (const ColumnDesc& column_desc : column_descs) {
+    std::shared_ptr<DataType> type;
+    RETURN_NOT_OK(ColumnTypeToArrowType(*column_desc.type(), &type));
+    fields.push_back(field(column_desc.column_name(), type));
+  }
+  *out = ::arrow::schema(fields);
+  return Status::OK();
+}
+
+Status Operation::Fetch(int max_rows, const std::shared_ptr<Schema>& schema,
+                        MemoryPool* pool, std::shared_ptr<RecordBatch>* out,
+                        bool* has_more_rows) const {
+  unique_ptr<ColumnarRowSet> results;
+  RETURN_NOT_OK(Fetch(max_rows, FetchOrientation::NEXT, &results, has_more_rows));
+  return results->ToRecordBatch(schema, pool, out);
+}
+
+Status Operation::GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                                       std::shared_ptr<RecordBatchReader>* out) const {
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(GetArrowSchema(&schema));
+  *out = std::make_shared<FetchRecordBatchReader>(this, max_rows, schema, pool);
+  return Status::OK();
+}
+
 Status Operation::Cancel() const {
   hs2::TCancelOperationReq req;
   req.__set_operationHandle(impl_->handle);
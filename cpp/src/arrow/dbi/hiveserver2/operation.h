@@ -29,6 +29,10 @@
 
 namespace arrow {
 
+class MemoryPool;
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
 class Status;
 
 namespace hiveserver2 {
@@ -91,6 +95,24 @@ class ARROW_EXPORT Operation {
   Status Fetch(int max_rows, FetchOrientation orientation,
                std::unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const;
 
+  // Returns the Arrow schema of the results of this operation, derived from
+  // GetResultSetMetadata. HiveServer2 sends TIMESTAMP, DECIMAL, DATE, CHAR and VARCHAR
+  // values as strings, so these columns are utf8 columns.
+  Status GetArrowSchema(std::shared_ptr<Schema>* out) const;
+
+  // Fetches the next batch of at most max_rows results as an Arrow RecordBatch with the
+  // given schema, as returned by GetArrowSchema, and sets has_more_rows.
+  Status Fetch(int max_rows, const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+               std::shared_ptr<RecordBatch>* out, bool* has_more_rows) const;
+
+  // Returns a reader over the remaining results of this operation, fetched max_rows at
+  // a time. The next batch is fetched in the background while the current one is
+  // converted and consumed, so no other call may be made on this operation or its
+  // session until the reader is exhausted or deleted. The reader must not outlive
+  // this operation.
+  Status GetRecordBatchReader(int max_rows, MemoryPool* pool,
+                              std::shared_ptr<RecordBatchReader>* out) const;
+
   // May be called after successfully creating the operation and before calling Close.
   Status Cancel() const;
 
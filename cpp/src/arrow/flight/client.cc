@@ -17,184 +17,42 @@
 
 #include "arrow/flight/client.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "grpc/byte_buffer_reader.h"
 #include "grpcpp/grpcpp.h"
 
+#include "arrow/buffer.h"
+#include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
 
 #include "arrow/flight/Flight.grpc.pb.h"
 #include "arrow/flight/Flight.pb.h"
 #include "arrow/flight/internal.h"
+#include "arrow/flight/serialization-internal.h"
 
 namespace pb = arrow::flight::protocol;
 
 namespace arrow {
 namespace flight {
 
-/// Internal, not user-visible type used for memory-efficient reads from gRPC
-/// stream
-struct FlightData {
-  /// Used only for puts, may be null
-  std::unique_ptr<FlightDescriptor> descriptor;
-
-  /// Non-length-prefixed Message header as described in format/Message.fbs
-  std::shared_ptr<Buffer> metadata;
-
-  /// Message body
-  std::shared_ptr<Buffer> body;
-};
-
-}  // namespace flight
-}  // namespace arrow
-
-namespace grpc {
-
-// Customizations to gRPC for more efficient deserialization of FlightData
-
-using google::protobuf::internal::WireFormatLite;
-using google::protobuf::io::CodedInputStream;
-
-using arrow::flight::FlightData;
-
-bool ReadBytesZeroCopy(const std::shared_ptr<arrow::Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<arrow::Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  *out = arrow::SliceBuffer(source_data, input->CurrentPosition(),
-                            static_cast<int64_t>(length));
-  return input->Skip(static_cast<int>(length));
-}
-
-// Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
-// consumers with zero-copy
-class GrpcBuffer : public arrow::MutableBuffer {
- public:
-  GrpcBuffer(grpc_slice slice, bool incref)
-      : MutableBuffer(GRPC_SLICE_START_PTR(slice),
-                      static_cast<int64_t>(GRPC_SLICE_LENGTH(slice))),
-        slice_(incref ? grpc_slice_ref(slice) : slice) {}
-
-  ~GrpcBuffer() override {
-    // Decref slice
-    grpc_slice_unref(slice_);
-  }
-
-  static arrow::Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<arrow::Buffer>* out) {
-    // These types are guaranteed by static assertions in gRPC to have the same
-    // in-memory representation
-
-    auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
-
-    // This part below is based on the Flatbuffers gRPC SerializationTraits in
-    // flatbuffers/grpc.h
-
-    // Check if this is a single uncompressed slice.
-    if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      // Increment reference count so this memory remains valid
-      *out = std::make_shared<GrpcBuffer>(slice, true);
-    } else {
-      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
-      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
-      // us back a new slice with the refcount already incremented.
-      grpc_byte_buffer_reader reader;
-      if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
-        return arrow::Status::IOError("Internal gRPC error reading from ByteBuffer");
-      }
-      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
-      grpc_byte_buffer_reader_destroy(&reader);
-
-      // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
-    }
-
-    return arrow::Status::OK();
-  }
-
- private:
-  grpc_slice slice_;
-};
-
-// Read internal::FlightData from grpc::ByteBuffer containing FlightData
-// protobuf without copying
-template <>
-class SerializationTraits<FlightData> {
- public:
-  static Status Serialize(const FlightData& msg, ByteBuffer** buffer, bool* own_buffer) {
-    return Status(StatusCode::UNIMPLEMENTED,
-                  "internal::FlightData serialization not implemented");
-  }
-
-  static Status Deserialize(ByteBuffer* buffer, FlightData* out) {
-    if (!buffer) {
-      return Status(StatusCode::INTERNAL, "No payload");
-    }
-
-    std::shared_ptr<arrow::Buffer> wrapped_buffer;
-    GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
-
-    auto buffer_length = static_cast<int>(wrapped_buffer->size());
-    CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
-
-    // TODO(wesm): The 2-parameter version of this function is deprecated
-    pb_stream.SetTotalBytesLimit(buffer_length, -1 /* no threshold */);
-
-    // This is the bytes remaining when using CodedInputStream like this
-    while (pb_stream.BytesUntilTotalBytesLimit()) {
-      const uint32_t tag = pb_stream.ReadTag();
-      const int field_number = WireFormatLite::GetTagFieldNumber(tag);
-      switch (field_number) {
-        case pb::FlightData::kFlightDescriptorFieldNumber: {
-          pb::FlightDescriptor pb_descriptor;
-          if (!pb_descriptor.ParseFromCodedStream(&pb_stream)) {
-            return Status(StatusCode::INTERNAL, "Unable to parse FlightDescriptor");
-          }
-        } break;
-        case pb::FlightData::kDataHeaderFieldNumber: {
-          if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
-            return Status(StatusCode::INTERNAL, "Unable to read FlightData metadata");
-          }
-        } break;
-        case pb::FlightData::kDataBodyFieldNumber: {
-          if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
-            return Status(StatusCode::INTERNAL, "Unable to read FlightData body");
-          }
-        } break;
-        default:
-          DCHECK(false) << "cannot happen";
-      }
-    }
-    buffer->Clear();
-
-    // TODO(wesm): Where and when should we verify that the FlightData is not
-    // malformed or missing components?
-
-    return Status::OK;
-  }
-};
-
-}  // namespace grpc
-
-namespace arrow {
-namespace flight {
-
 struct ClientRpc {
   grpc::ClientContext context;
 
@@ -217,21 +75,19 @@ class FlightStreamReader : public RecordBatchReader {
   std::shared_ptr<Schema> schema() const override { return schema_; }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
-    FlightData data;
+    internal::FlightData data;
 
     if (stream_finished_) {
       *out = nullptr;
       return Status::OK();
     }
 
-    // For customizing read path for better memory/serialization efficiency
-    auto custom_reader = reinterpret_cast<grpc::ClientReader<FlightData>*>(stream_.get());
-
-    if (custom_reader->Read(&data)) {
+    // Customized read path for better memory/serialization efficiency
+    if (internal::ReadPayload(stream_.get(), &data)) {
       std::unique_ptr<ipc::Message> message;
 
       // Validate IPC message
-      RETURN_NOT_OK(ipc::Message::Open(data.metadata, data.body, &message));
+      RETURN_NOT_OK(data.OpenMessage(&message));
       return ipc::ReadRecordBatch(*message, schema_, out);
     } else {
       // Stream is completed
@@ -250,6 +106,208 @@ class FlightStreamReader : public RecordBatchReader {
   std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
 };
 
+// Writes the record batches of a DoPut. The schema is sent along with the
+// flight descriptor in the first message, followed by its dictionaries
+class FlightPutWriter : public ipc::RecordBatchWriter {
+ public:
+  FlightPutWriter(std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
+                  std::unique_ptr<grpc::ClientWriter<pb::FlightData>> writer)
+      : rpc_(std::move(rpc)),
+        response_(std::move(response)),
+        writer_(std::move(writer)),
+        pool_(default_memory_pool()),
+        closed_(false) {}
+
+  ~FlightPutWriter() override {
+    if (!closed_) {
+      // The upload was not completed, don't let the server commit it
+      rpc_->context.TryCancel();
+      writer_->Finish();
+    }
+  }
+
+  Status Open(const FlightDescriptor& descriptor, const Schema& schema) {
+    pb::FlightDescriptor pb_descr;
+    RETURN_NOT_OK(internal::ToProto(descriptor, &pb_descr));
+    std::string str_descr;
+    pb_descr.SerializeToString(&str_descr);
+
+    internal::FlightPayload payload;
+    payload.descriptor = Buffer::FromString(std::move(str_descr));
+    ipc::DictionaryMemo dictionary_memo;
+    RETURN_NOT_OK(
+        ipc::internal::GetSchemaPayload(schema, &dictionary_memo, &payload.ipc_message));
+    RETURN_NOT_OK(WritePayload(payload));
+
+    for (const auto& entry : dictionary_memo.id_to_dictionary()) {
+      internal::FlightPayload dictionary_payload;
+      RETURN_NOT_OK(ipc::internal::GetDictionaryPayload(
+          entry.first, entry.second, pool_, &dictionary_payload.ipc_message));
+      RETURN_NOT_OK(WritePayload(dictionary_payload));
+    }
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override {
+    internal::FlightPayload payload;
+    RETURN_NOT_OK(
+        ipc::internal::GetRecordBatchPayload(batch, pool_, &payload.ipc_message));
+    return WritePayload(payload);
+  }
+
+  Status Close() override {
+    if (closed_) {
+      return Status::OK();
+    }
+    closed_ = true;
+    writer_->WritesDone();
+    return internal::FromGrpcStatus(writer_->Finish());
+  }
+
+  void set_memory_pool(MemoryPool* pool) override { pool_ = pool; }
+
+ private:
+  Status WritePayload(const internal::FlightPayload& payload) {
+    if (closed_) {
+      return Status::Invalid("DoPut stream is already closed");
+    }
+    // Customized write path so the body buffers are not copied
+    if (!internal::WritePayload(payload, writer_.get())) {
+      // The stream was closed, the server's status tells why
+      closed_ = true;
+      RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish()));
+      return Status::IOError("Could not write record batch to DoPut stream");
+    }
+    return Status::OK();
+  }
+
+  // The RPC context lifetime must be coupled to the ClientWriter
+  std::unique_ptr<ClientRpc> rpc_;
+  std::unique_ptr<pb::PutResult> response_;
+  std::unique_ptr<grpc::ClientWriter<pb::FlightData>> writer_;
+  MemoryPool* pool_;
+  bool closed_;
+};
+
+// Open the stream of an endpoint, the client connected to the endpoint's
+// location, if any, being returned as it must outlive the stream
+using OpenEndpointFunc = std::function<Status(const FlightEndpoint&,
+                                              std::unique_ptr<FlightClient>*,
+                                              std::unique_ptr<RecordBatchReader>*)>;
+
+// Reads the streams of several endpoints on a thread pool, queueing their
+// record batches in arrival order. The endpoint streams block while the queue
+// is full
+class ConcurrentFlightStreamReader : public RecordBatchReader {
+ public:
+  ConcurrentFlightStreamReader(const std::shared_ptr<Schema>& schema,
+                               const OpenEndpointFunc& open_endpoint,
+                               int max_queued_batches)
+      : schema_(schema),
+        open_endpoint_(open_endpoint),
+        max_queued_batches_(std::max(max_queued_batches, 1)),
+        num_running_(0),
+        cancelled_(false) {}
+
+  ~ConcurrentFlightStreamReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cancelled_ = true;
+    }
+    producer_cv_.notify_all();
+    if (pool_) {
+      // Wait for the streams being read, the pending ones are abandoned
+      ARROW_UNUSED(pool_->Shutdown(false));
+    }
+  }
+
+  Status Start(const std::vector<FlightEndpoint>& endpoints, int parallelism) {
+    if (endpoints.empty()) {
+      return Status::OK();
+    }
+    num_running_ = static_cast<int>(endpoints.size());
+    RETURN_NOT_OK(arrow::internal::ThreadPool::Make(
+        std::min(std::max(parallelism, 1), num_running_), &pool_));
+    for (const FlightEndpoint& endpoint : endpoints) {
+      RETURN_NOT_OK(pool_->Spawn(
+          [this, endpoint]() { FinishEndpoint(ReadEndpoint(endpoint)); }));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumer_cv_.wait(lock, [this]() {
+      return !queue_.empty() || num_running_ == 0 || !status_.ok();
+    });
+    RETURN_NOT_OK(status_);
+    if (queue_.empty()) {
+      // All the streams are completed
+      *out = nullptr;
+      return Status::OK();
+    }
+    *out = std::move(queue_.front());
+    queue_.pop_front();
+    producer_cv_.notify_one();
+    return Status::OK();
+  }
+
+ private:
+  Status ReadEndpoint(const FlightEndpoint& endpoint) {
+    std::unique_ptr<FlightClient> client;
+    std::unique_ptr<RecordBatchReader> stream;
+    RETURN_NOT_OK(open_endpoint_(endpoint, &client, &stream));
+
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(stream->ReadNext(&batch));
+      if (!batch) {
+        return Status::OK();
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      producer_cv_.wait(lock, [this]() {
+        return cancelled_ || static_cast<int>(queue_.size()) < max_queued_batches_;
+      });
+      if (cancelled_) {
+        return Status::OK();
+      }
+      queue_.push_back(std::move(batch));
+      consumer_cv_.notify_one();
+    }
+  }
+
+  void FinishEndpoint(const Status& st) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_running_;
+      if (!st.ok() && status_.ok()) {
+        // The other streams are not needed anymore
+        status_ = st;
+        cancelled_ = true;
+      }
+    }
+    producer_cv_.notify_all();
+    consumer_cv_.notify_one();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  OpenEndpointFunc open_endpoint_;
+  const int max_queued_batches_;
+
+  std::mutex mutex_;
+  std::condition_variable producer_cv_;
+  std::condition_variable consumer_cv_;
+  std::deque<std::shared_ptr<RecordBatch>> queue_;
+  int num_running_;
+  bool cancelled_;
+  Status status_;
+
+  // Destroyed first, as its threads use the members above
+  std::shared_ptr<arrow::internal::ThreadPool> pool_;
+};
+
 class FlightClient::FlightClientImpl {
  public:
   Status Connect(const std::string& host, int port) {
@@ -355,14 +413,112 @@ class FlightClient::FlightClientImpl {
     return Status::OK();
   }
 
-  Status DoPut(std::unique_ptr<FlightPutWriter>* stream) {
-    return Status::NotImplemented("DoPut");
+  Status DoGet(const FlightInfo& info, const FlightReadOptions& options,
+               std::unique_ptr<RecordBatchReader>* out) {
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(info.GetSchema(&schema));
+
+    std::unique_ptr<ConcurrentFlightStreamReader> reader(
+        new ConcurrentFlightStreamReader(schema, OpenEndpoint(schema),
+                                         options.max_queued_batches));
+    RETURN_NOT_OK(reader->Start(info.endpoints(), options.parallelism));
+    *out = std::move(reader);
+    return Status::OK();
+  }
+
+  Status ReadFlight(const FlightInfo& info, const FlightReadOptions& options,
+                    std::shared_ptr<Table>* out) {
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(info.GetSchema(&schema));
+    const std::vector<FlightEndpoint>& endpoints = info.endpoints();
+    if (endpoints.empty()) {
+      return Table::FromRecordBatches(schema, {}, out);
+    }
+
+    OpenEndpointFunc open_endpoint = OpenEndpoint(schema);
+    std::vector<std::vector<std::shared_ptr<RecordBatch>>> endpoint_batches(
+        endpoints.size());
+    auto ReadEndpoint = [&](size_t i) {
+      std::unique_ptr<FlightClient> client;
+      std::unique_ptr<RecordBatchReader> stream;
+      RETURN_NOT_OK(open_endpoint(endpoints[i], &client, &stream));
+
+      std::shared_ptr<RecordBatch> batch;
+      while (true) {
+        RETURN_NOT_OK(stream->ReadNext(&batch));
+        if (!batch) {
+          return Status::OK();
+        }
+        endpoint_batches[i].push_back(std::move(batch));
+      }
+    };
+
+    std::shared_ptr<arrow::internal::ThreadPool> pool;
+    RETURN_NOT_OK(arrow::internal::ThreadPool::Make(
+        std::min(std::max(options.parallelism, 1), static_cast<int>(endpoints.size())),
+        &pool));
+    std::vector<std::future<Status>> tasks;
+    for (size_t i = 0; i < endpoints.size(); ++i) {
+      tasks.emplace_back(pool->Submit(ReadEndpoint, i));
+    }
+    // Wait for all the tasks before returning, as they reference this frame
+    Status st;
+    for (auto&& task : tasks) {
+      Status task_status = task.get();
+      if (st.ok()) {
+        st = task_status;
+      }
+    }
+    RETURN_NOT_OK(st);
+
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (auto& batches_of_endpoint : endpoint_batches) {
+      batches.insert(batches.end(), batches_of_endpoint.begin(),
+                     batches_of_endpoint.end());
+    }
+    return Table::FromRecordBatches(schema, batches, out);
+  }
+
+  Status DoPut(const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
+               std::unique_ptr<ipc::RecordBatchWriter>* out) {
+    std::unique_ptr<ClientRpc> rpc(new ClientRpc);
+    std::unique_ptr<pb::PutResult> response(new pb::PutResult);
+    std::unique_ptr<grpc::ClientWriter<pb::FlightData>> writer(
+        stub_->DoPut(&rpc->context, response.get()));
+
+    std::unique_ptr<FlightPutWriter> put_writer(
+        new FlightPutWriter(std::move(rpc), std::move(response), std::move(writer)));
+    RETURN_NOT_OK(put_writer->Open(descriptor, *schema));
+    *out = std::move(put_writer);
+    return Status::OK();
   }
 
  private:
+  // The endpoints without location are read from this service, the others
+  // from their first location
+  OpenEndpointFunc OpenEndpoint(const std::shared_ptr<Schema>& schema) {
+    return [this, schema](const FlightEndpoint& endpoint,
+                          std::unique_ptr<FlightClient>* client,
+                          std::unique_ptr<RecordBatchReader>* stream) {
+      if (endpoint.locations.empty()) {
+        return DoGet(endpoint.ticket, schema, stream);
+      }
+      const Location& location = endpoint.locations[0];
+      RETURN_NOT_OK(FlightClient::Connect(location.host, location.port, client));
+      return (*client)->DoGet(endpoint.ticket, schema, stream);
+    };
+  }
+
   std::unique_ptr<pb::FlightService::Stub> stub_;
 };
 
+FlightReadOptions FlightReadOptions::Defaults() {
+  FlightReadOptions options;
+  options.parallelism = 4;
+  options.max_queued_batches = 16;
+  return options;
+}
+
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
 
 FlightClient::~FlightClient() {}
@@ -401,9 +557,20 @@ Status FlightClient::DoGet(const Ticket& ticket, const std::shared_ptr<Schema>&
   return impl_->DoGet(ticket, schema, stream);
 }
 
-Status FlightClient::DoPut(const Schema& schema,
-                           std::unique_ptr<FlightPutWriter>* stream) {
-  return Status::NotImplemented("DoPut");
+Status FlightClient::DoGet(const FlightInfo& info, const FlightReadOptions& options,
+                           std::unique_ptr<RecordBatchReader>* stream) {
+  return impl_->DoGet(info, options, stream);
+}
+
+Status FlightClient::ReadFlight(const FlightInfo& info, const FlightReadOptions& options,
+                                std::shared_ptr<Table>* out) {
+  return impl_->ReadFlight(info, options, out);
+}
+
+Status FlightClient::DoPut(const FlightDescriptor& descriptor,
+                           const std::shared_ptr<Schema>& schema,
+                           std::unique_ptr<ipc::RecordBatchWriter>* stream) {
+  return impl_->DoPut(descriptor, schema, stream);
 }
 
 }  // namespace flight
@@ -34,9 +34,28 @@ namespace arrow {
 class RecordBatch;
 class RecordBatchReader;
 class Schema;
+class Table;
+
+namespace ipc {
+
+class RecordBatchWriter;
+
+}  // namespace ipc
 
 namespace flight {
 
+/// \brief Options for reading all the endpoints of a flight concurrently
+struct ARROW_EXPORT FlightReadOptions {
+  /// The number of endpoints streamed at the same time
+  int parallelism;
+
+  /// The maximum number of record batches received from all the endpoints
+  /// but not consumed yet, capping the memory used by a RecordBatchReader
+  int max_queued_batches;
+
+  static FlightReadOptions Defaults();
+};
+
 /// \brief Client class for Arrow Flight RPC services (gRPC-based).
 /// API experimental for now
 class ARROW_EXPORT FlightClient {
@@ -94,11 +113,37 @@ class ARROW_EXPORT FlightClient {
   Status DoGet(const Ticket& ticket, const std::shared_ptr<Schema>& schema,
                std::unique_ptr<RecordBatchReader>* stream);
 
-  /// \brief Initiate DoPut RPC, returns FlightPutWriter interface to
-  /// write. Not yet implemented
+  /// \brief Request the streams of all the endpoints of a flight
+  /// concurrently. The record batches are returned in the order they arrive,
+  /// so batches of different endpoints are interleaved. The endpoints without
+  /// locations are read from the service of this client, which must outlive
+  /// the returned reader; otherwise the first location is used
+  /// \param[in] info the flight, as returned by GetFlightInfo
+  /// \param[in] options the parallelism and memory bounds of the reads
+  /// \param[out] stream the returned RecordBatchReader
+  /// \return Status
+  Status DoGet(const FlightInfo& info, const FlightReadOptions& options,
+               std::unique_ptr<RecordBatchReader>* stream);
+
+  /// \brief Read all the endpoints of a flight concurrently into a Table,
+  /// whose record batches are ordered by endpoint. max_queued_batches is not
+  /// used, as the whole flight is held in memory
+  /// \param[in] info the flight, as returned by GetFlightInfo
+  /// \param[in] options the parallelism of the reads
+  /// \param[out] out the returned Table
+  /// \return Status
+  Status ReadFlight(const FlightInfo& info, const FlightReadOptions& options,
+                    std::shared_ptr<Table>* out);
+
+  /// \brief Upload a stream of record batches to the server. The RPC is
+  /// completed by closing the returned writer, whose Close returns the status
+  /// of the server's DoPut
+  /// \param[in] descriptor the descriptor of the uploaded flight
+  /// \param[in] schema the schema of the record batches
   /// \param[out] stream the created stream to write record batches to
   /// \return Status
-  Status DoPut(const Schema& schema, std::unique_ptr<FlightPutWriter>* stream);
+  Status DoPut(const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
+               std::unique_ptr<ipc::RecordBatchWriter>* stream);
 
  private:
   FlightClient();
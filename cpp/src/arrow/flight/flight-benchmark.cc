@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
+#include <iostream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -40,6 +42,7 @@ DEFINE_int32(num_streams, 4, "Number of streams for each server");
 DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
+DEFINE_bool(test_put, false, "Test DoPut upload throughput instead of DoGet");
 
 namespace perf = arrow::flight::perf;
 
@@ -63,6 +66,92 @@ struct PerformanceStats {
   }
 };
 
+Status MakePerfBatch(const int64_t length, std::shared_ptr<RecordBatch>* out) {
+  // Same layout as the batches of perf-server.cc
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays;
+  std::shared_ptr<ResizableBuffer> buffer;
+  for (const char* name : {"a", "b", "c", "d"}) {
+    RETURN_NOT_OK(MakeRandomBuffer<int64_t>(length, default_memory_pool(), &buffer));
+    fields.push_back(field(name, int64()));
+    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+  }
+  *out = RecordBatch::Make(schema(fields), length, arrays);
+  return Status::OK();
+}
+
+void PrintPerformanceStats(const PerformanceStats& stats, uint64_t elapsed_nanos) {
+  // Elapsed time in seconds
+  double time_elapsed =
+      static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
+
+  constexpr double kMegabyte = static_cast<double>(1 << 20);
+
+  std::cout << "Bytes transferred: " << stats.total_bytes << std::endl;
+  std::cout << "Nanos: " << elapsed_nanos << std::endl;
+  std::cout << "Speed: "
+            << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
+            << " MB/s" << std::endl;
+}
+
+Status RunDoPutTest(const int port) {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(MakePerfBatch(FLAGS_records_per_batch, &batch));
+
+  PerformanceStats stats;
+  auto UploadStream = [&stats, &batch, &port](int stream_index) {
+    std::unique_ptr<FlightClient> client;
+    RETURN_NOT_OK(FlightClient::Connect("localhost", port, &client));
+
+    FlightDescriptor descriptor;
+    descriptor.type = FlightDescriptor::PATH;
+    descriptor.path = {"perf-upload", std::to_string(stream_index)};
+
+    std::unique_ptr<ipc::RecordBatchWriter> writer;
+    RETURN_NOT_OK(client->DoPut(descriptor, batch->schema(), &writer));
+
+    // This is hard-coded for right now, 4 columns each with int64
+    const int bytes_per_record = 32;
+
+    int64_t num_records = 0;
+    while (num_records < FLAGS_records_per_stream) {
+      // Last partial batch
+      const int64_t length =
+          std::min(batch->num_rows(), FLAGS_records_per_stream - num_records);
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch->Slice(0, length)));
+      num_records += length;
+    }
+    RETURN_NOT_OK(writer->Close());
+    stats.Update(num_records, num_records * bytes_per_record);
+    return Status::OK();
+  };
+
+  StopWatch timer;
+  timer.Start();
+
+  std::shared_ptr<ThreadPool> pool;
+  RETURN_NOT_OK(ThreadPool::Make(FLAGS_num_threads, &pool));
+  std::vector<std::future<Status>> tasks;
+  for (int i = 0; i < FLAGS_num_streams; ++i) {
+    tasks.emplace_back(pool->Submit(UploadStream, i));
+  }
+
+  // Wait for tasks to finish
+  for (auto&& task : tasks) {
+    RETURN_NOT_OK(task.get());
+  }
+  uint64_t elapsed_nanos = timer.Stop();
+
+  // Check that number of rows written is as expected
+  if (stats.total_records !=
+      static_cast<int64_t>(FLAGS_num_streams) * FLAGS_records_per_stream) {
+    return Status::Invalid("Did not upload expected number of records");
+  }
+
+  PrintPerformanceStats(stats, elapsed_nanos);
+  return Status::OK();
+}
+
 Status RunPerformanceTest(const int port) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
@@ -156,23 +245,14 @@ Status RunPerformanceTest(const int port) {
     RETURN_NOT_OK(task.get());
   }
 
-  // Elapsed time in seconds
   uint64_t elapsed_nanos = timer.Stop();
-  double time_elapsed =
-      static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
-
-  constexpr double kMegabyte = static_cast<double>(1 << 20);
 
   // Check that number of rows read is as expected
   if (stats.total_records != static_cast<int64_t>(plan->total_records())) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
-  std::cout << "Bytes read: " << stats.total_bytes << std::endl;
-  std::cout << "Nanos: " << elapsed_nanos << std::endl;
-  std::cout << "Speed: "
-            << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
-            << " MB/s" << std::endl;
+  PrintPerformanceStats(stats, elapsed_nanos);
   return Status::OK();
 }
 
@@ -186,7 +266,8 @@ int main(int argc, char** argv) {
   arrow::flight::TestServer server("flight-perf-server", port);
   server.Start();
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(port);
+  arrow::Status s = FLAGS_test_put ? arrow::flight::RunDoPutTest(port)
+                                   : arrow::flight::RunPerformanceTest(port);
   server.Stop();
 
   if (!s.ok()) {
@@ -34,7 +34,9 @@
 #include <boost/process.hpp>
 
 #include "arrow/ipc/test-common.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/test-util.h"
 
 #include "arrow/flight/api.h"
@@ -225,6 +227,81 @@ TEST_F(TestFlightClient, DoGet) {
   ASSERT_EQ(nullptr, chunk);
 }
 
+TEST_F(TestFlightClient, ReadAllEndpoints) {
+  // Endpoints without location are read from the connected server
+  const int num_endpoints = 3;
+  std::vector<FlightEndpoint> endpoints(num_endpoints,
+                                        FlightEndpoint{Ticket{"ticket-id-1"}, {}});
+  FlightDescriptor descr{FlightDescriptor::PATH, "", {"foo", "bar"}};
+  FlightInfo::Data data;
+  ASSERT_OK(MakeFlightInfo(*ExampleSchema1(), descr, endpoints, -1, -1, &data));
+  FlightInfo info(data);
+
+  BatchVector expected_batches;
+  const int num_batches = 5;
+  ASSERT_OK(SimpleIntegerBatches(num_batches, &expected_batches));
+
+  FlightReadOptions options = FlightReadOptions::Defaults();
+  options.parallelism = 2;
+  options.max_queued_batches = 2;
+
+  // Batches of the different endpoints may be interleaved
+  std::unique_ptr<RecordBatchReader> stream;
+  ASSERT_OK(client_->DoGet(info, options, &stream));
+  std::vector<int> num_received(num_batches, 0);
+  std::shared_ptr<RecordBatch> chunk;
+  while (true) {
+    ASSERT_OK(stream->ReadNext(&chunk));
+    if (!chunk) {
+      break;
+    }
+    // All the batches have different sizes
+    const int64_t index = chunk->num_rows() - 10;
+    ASSERT_LT(index, num_batches);
+    ASSERT_BATCHES_EQUAL(*expected_batches[index], *chunk);
+    ++num_received[index];
+  }
+  ASSERT_EQ(std::vector<int>(num_batches, num_endpoints), num_received);
+
+  // The Table has the batches in endpoint order
+  std::shared_ptr<Table> table;
+  ASSERT_OK(client_->ReadFlight(info, options, &table));
+  BatchVector all_batches;
+  for (int i = 0; i < num_endpoints; ++i) {
+    all_batches.insert(all_batches.end(), expected_batches.begin(),
+                       expected_batches.end());
+  }
+  std::shared_ptr<Table> expected_table;
+  ASSERT_OK(Table::FromRecordBatches(all_batches, &expected_table));
+  ASSERT_TRUE(expected_table->Equals(*table));
+
+  // Errors of the endpoint streams are returned
+  endpoints.push_back(FlightEndpoint{Ticket{"unknown-ticket"}, {}});
+  ASSERT_OK(MakeFlightInfo(*ExampleSchema1(), descr, endpoints, -1, -1, &data));
+  ASSERT_RAISES(NotImplemented, client_->ReadFlight(FlightInfo(data), options, &table));
+}
+
+TEST_F(TestFlightClient, DoPut) {
+  FlightDescriptor descr{FlightDescriptor::PATH, "", {"integers"}};
+
+  BatchVector batches;
+  const int num_batches = 5;
+  ASSERT_OK(SimpleIntegerBatches(num_batches, &batches));
+
+  std::unique_ptr<ipc::RecordBatchWriter> stream;
+  ASSERT_OK(client_->DoPut(descr, batches[0]->schema(), &stream));
+  for (const auto& batch : batches) {
+    ASSERT_OK(stream->WriteRecordBatch(*batch));
+  }
+  // The server checks the uploaded batches before accepting them
+  ASSERT_OK(stream->Close());
+
+  // Missing batches are rejected
+  ASSERT_OK(client_->DoPut(descr, batches[0]->schema(), &stream));
+  ASSERT_OK(stream->WriteRecordBatch(*batches[0]));
+  ASSERT_RAISES(IOError, stream->Close());
+}
+
 TEST_F(TestFlightClient, ListActions) {
   std::vector<ActionType> actions;
   ASSERT_OK(client_->ListActions(&actions));
@@ -170,6 +170,17 @@ class FlightPerfServer : public FlightServerBase {
     return GetPerfBatches(token, perf_schema_, false, data_stream);
   }
 
+  Status DoPut(std::unique_ptr<FlightMessageReader> reader) override {
+    // Drain the uploaded stream, the client measures the throughput
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (!batch) {
+        return Status::OK();
+      }
+    }
+  }
+
  private:
   Location location_;
   std::shared_ptr<Schema> perf_schema_;
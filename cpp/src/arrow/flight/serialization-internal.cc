@@ -0,0 +1,382 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/serialization-internal.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream.h"
+#include "google/protobuf/wire_format_lite.h"
+#include "grpc/byte_buffer_reader.h"
+
+#include "arrow/ipc/message.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/flight/internal.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+Status FlightData::OpenMessage(std::unique_ptr<ipc::Message>* message) {
+  if (metadata == nullptr) {
+    return Status::IOError("FlightData message is missing its metadata");
+  }
+  return ipc::Message::Open(metadata, body, message);
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
+
+namespace pb = arrow::flight::protocol;
+
+using arrow::flight::internal::FlightData;
+using arrow::flight::internal::FlightPayload;
+
+constexpr int64_t kInt32Max = std::numeric_limits<int32_t>::max();
+
+namespace {
+
+constexpr uint8_t kPaddingBytes[8] = {0};
+
+void ReleaseBuffer(void* buffer) {
+  delete reinterpret_cast<std::shared_ptr<arrow::Buffer>*>(buffer);
+}
+
+// Wrap an Arrow buffer in a gRPC slice without copying. The buffer is kept
+// alive until gRPC releases the slice, once it has been sent
+grpc::Slice SliceFromBuffer(const std::shared_ptr<arrow::Buffer>& buffer) {
+  auto holder = new std::shared_ptr<arrow::Buffer>(buffer);
+  grpc_slice slice = grpc_slice_new_with_user_data(
+      const_cast<uint8_t*>(buffer->data()), static_cast<size_t>(buffer->size()),
+      &ReleaseBuffer, holder);
+  return grpc::Slice(slice, grpc::Slice::STEAL_REF);
+}
+
+}  // namespace
+
+namespace grpc {
+
+// Customizations to gRPC for more efficient (de)serialization of FlightData
+
+using google::protobuf::internal::WireFormatLite;
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+
+bool ReadBytesZeroCopy(const std::shared_ptr<arrow::Buffer>& source_data,
+                       CodedInputStream* input, std::shared_ptr<arrow::Buffer>* out) {
+  uint32_t length;
+  if (!input->ReadVarint32(&length)) {
+    return false;
+  }
+  *out = arrow::SliceBuffer(source_data, input->CurrentPosition(),
+                            static_cast<int64_t>(length));
+  return input->Skip(static_cast<int>(length));
+}
+
+// Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
+// consumers with zero-copy
+class GrpcBuffer : public arrow::MutableBuffer {
+ public:
+  GrpcBuffer(grpc_slice slice, bool incref)
+      : MutableBuffer(GRPC_SLICE_START_PTR(slice),
+                      static_cast<int64_t>(GRPC_SLICE_LENGTH(slice))),
+        slice_(incref ? grpc_slice_ref(slice) : slice) {}
+
+  ~GrpcBuffer() override {
+    // Decref slice
+    grpc_slice_unref(slice_);
+  }
+
+  static arrow::Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<arrow::Buffer>* out) {
+    // These types are guaranteed by static assertions in gRPC to have the same
+    // in-memory representation
+
+    auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
+
+    // This part below is based on the Flatbuffers gRPC SerializationTraits in
+    // flatbuffers/grpc.h
+
+    // Check if this is a single uncompressed slice.
+    if ((buffer->type == GRPC_BB_RAW) &&
+        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
+        (buffer->data.raw.slice_buffer.count == 1)) {
+      // If it is, then we can reference the `grpc_slice` directly.
+      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
+
+      // Increment reference count so this memory remains valid
+      *out = std::make_shared<GrpcBuffer>(slice, true);
+    } else {
+      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
+      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
+      // us back a new slice with the refcount already incremented.
+      grpc_byte_buffer_reader reader;
+      if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
+        return arrow::Status::IOError("Internal gRPC error reading from ByteBuffer");
+      }
+      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+      grpc_byte_buffer_reader_destroy(&reader);
+
+      // Steal the slice reference
+      *out = std::make_shared<GrpcBuffer>(slice, false);
+    }
+
+    return arrow::Status::OK();
+  }
+
+ private:
+  grpc_slice slice_;
+};
+
+// More efficient writing of FlightData to gRPC output buffer
+// Implementation of ZeroCopyOutputStream that writes to a fixed-size buffer
+class FixedSizeProtoWriter : public ::google::protobuf::io::ZeroCopyOutputStream {
+ public:
+  explicit FixedSizeProtoWriter(grpc_slice slice)
+      : slice_(slice),
+        bytes_written_(0),
+        total_size_(static_cast<int>(GRPC_SLICE_LENGTH(slice))) {}
+
+  bool Next(void** data, int* size) override {
+    // Consume the whole slice
+    *data = GRPC_SLICE_START_PTR(slice_) + bytes_written_;
+    *size = total_size_ - bytes_written_;
+    bytes_written_ = total_size_;
+    return true;
+  }
+
+  void BackUp(int count) override { bytes_written_ -= count; }
+
+  int64_t ByteCount() const override { return bytes_written_; }
+
+ private:
+  grpc_slice slice_;
+  int bytes_written_;
+  int total_size_;
+};
+
+// Write FlightData to a grpc::ByteBuffer without extra copying
+template <>
+class SerializationTraits<FlightPayload> {
+ public:
+  static grpc::Status Deserialize(ByteBuffer* buffer, FlightPayload* out) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "FlightPayload deserialization not implemented");
+  }
+
+  static grpc::Status Serialize(const FlightPayload& msg, ByteBuffer* out,
+                                bool* own_buffer) {
+    const arrow::ipc::internal::IpcPayload& ipc_msg = msg.ipc_message;
+
+    DCHECK_LT(ipc_msg.metadata->size(), kInt32Max);
+    const int32_t metadata_size = static_cast<int32_t>(ipc_msg.metadata->size());
+
+    int64_t body_size = 0;
+    for (const auto& buffer : ipc_msg.body_buffers) {
+      body_size += buffer->size();
+
+      const int64_t remainder = buffer->size() % 8;
+      if (remainder) {
+        body_size += 8 - remainder;
+      }
+    }
+
+    // 1 byte for metadata tag, 2 bytes for body tag
+    size_t header_size =
+        1 + WireFormatLite::LengthDelimitedSize(metadata_size) + 2 +
+        CodedOutputStream::VarintSize32(static_cast<uint32_t>(body_size));
+
+    int32_t descriptor_size = 0;
+    if (msg.descriptor != nullptr) {
+      DCHECK_LT(msg.descriptor->size(), kInt32Max);
+      descriptor_size = static_cast<int32_t>(msg.descriptor->size());
+      // 1 byte for descriptor tag
+      header_size += 1 + WireFormatLite::LengthDelimitedSize(descriptor_size);
+    }
+
+    // The body buffers are not copied anymore, but the receiver decodes the
+    // whole message with a protobuf CodedInputStream, which is limited to 2GB
+    if (static_cast<int64_t>(header_size) + body_size > kInt32Max) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "Cannot send record batches exceeding 2GB yet");
+    }
+
+    // The header and the metadata are written into their own slice, then each
+    // body buffer is referenced by a slice, followed by its padding if any
+    std::vector<grpc::Slice> slices;
+    slices.reserve(1 + 2 * ipc_msg.body_buffers.size());
+
+    grpc::Slice header_slice(header_size);
+    {
+      FixedSizeProtoWriter writer(*reinterpret_cast<grpc_slice*>(&header_slice));
+      CodedOutputStream pb_stream(&writer);
+
+      // Write descriptor
+      if (msg.descriptor != nullptr) {
+        WireFormatLite::WriteTag(pb::FlightData::kFlightDescriptorFieldNumber,
+                                 WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &pb_stream);
+        pb_stream.WriteVarint32(descriptor_size);
+        pb_stream.WriteRawMaybeAliased(msg.descriptor->data(), descriptor_size);
+      }
+
+      // Write header
+      WireFormatLite::WriteTag(pb::FlightData::kDataHeaderFieldNumber,
+                               WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &pb_stream);
+      pb_stream.WriteVarint32(metadata_size);
+      pb_stream.WriteRawMaybeAliased(ipc_msg.metadata->data(), metadata_size);
+
+      // Write body tag and length, the body itself follows in the next slices
+      WireFormatLite::WriteTag(pb::FlightData::kDataBodyFieldNumber,
+                               WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &pb_stream);
+      pb_stream.WriteVarint32(static_cast<uint32_t>(body_size));
+
+      DCHECK_EQ(static_cast<int>(header_size), pb_stream.ByteCount());
+    }
+    slices.push_back(std::move(header_slice));
+
+    for (const auto& buffer : ipc_msg.body_buffers) {
+      if (buffer->size() > 0) {
+        slices.push_back(SliceFromBuffer(buffer));
+      }
+
+      // Write padding if not multiple of 8
+      const int remainder = static_cast<int>(buffer->size() % 8);
+      if (remainder) {
+        slices.emplace_back(kPaddingBytes, 8 - remainder, grpc::Slice::STATIC_SLICE);
+      }
+    }
+
+    // Hand off the slices to the returned ByteBuffer
+    grpc::ByteBuffer tmp(slices.data(), slices.size());
+    out->Swap(&tmp);
+    *own_buffer = true;
+    return grpc::Status::OK;
+  }
+};
+
+// Read internal::FlightData from grpc::ByteBuffer containing FlightData
+// protobuf without copying
+template <>
+class SerializationTraits<FlightData> {
+ public:
+  static grpc::Status Serialize(const FlightData& msg, ByteBuffer* out,
+                                bool* own_buffer) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "internal::FlightData serialization not implemented");
+  }
+
+  static grpc::Status Deserialize(ByteBuffer* buffer, FlightData* out) {
+    if (!buffer) {
+      return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
+    }
+
+    std::shared_ptr<arrow::Buffer> wrapped_buffer;
+    GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+
+    auto buffer_length = static_cast<int>(wrapped_buffer->size());
+    CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
+
+    // TODO(wesm): The 2-parameter version of this function is deprecated
+    pb_stream.SetTotalBytesLimit(buffer_length, -1 /* no threshold */);
+
+    // This is the bytes remaining when using CodedInputStream like this
+    while (pb_stream.BytesUntilTotalBytesLimit()) {
+      const uint32_t tag = pb_stream.ReadTag();
+      const int field_number = WireFormatLite::GetTagFieldNumber(tag);
+      switch (field_number) {
+        case pb::FlightData::kFlightDescriptorFieldNumber: {
+          std::shared_ptr<arrow::Buffer> descriptor_buffer;
+          pb::FlightDescriptor pb_descriptor;
+          if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &descriptor_buffer) ||
+              !pb_descriptor.ParseFromArray(
+                  descriptor_buffer->data(),
+                  static_cast<int>(descriptor_buffer->size()))) {
+            return grpc::Status(grpc::StatusCode::INTERNAL,
+                                "Unable to parse FlightDescriptor");
+          }
+          out->descriptor.reset(new arrow::flight::FlightDescriptor);
+          GRPC_RETURN_NOT_OK(
+              arrow::flight::internal::FromProto(pb_descriptor, out->descriptor.get()));
+        } break;
+        case pb::FlightData::kDataHeaderFieldNumber: {
+          if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+            return grpc::Status(grpc::StatusCode::INTERNAL,
+                                "Unable to read FlightData metadata");
+          }
+        } break;
+        case pb::FlightData::kDataBodyFieldNumber: {
+          if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+            return grpc::Status(grpc::StatusCode::INTERNAL,
+                                "Unable to read FlightData body");
+          }
+        } break;
+        default: {
+          // Fields added to the protocol later on are ignored
+          if (!WireFormatLite::SkipField(&pb_stream, tag)) {
+            return grpc::Status(grpc::StatusCode::INTERNAL,
+                                "Unable to read FlightData field");
+          }
+        } break;
+      }
+    }
+    buffer->Clear();
+
+    // TODO(wesm): Where and when should we verify that the FlightData is not
+    // malformed or missing components?
+
+    return grpc::Status::OK;
+  }
+};
+
+}  // namespace grpc
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+// The gRPC stream types only hold pointers to the call, whatever the message
+// type, so they can be reinterpreted to use the customized SerializationTraits
+
+bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
+  return reinterpret_cast<grpc::ClientReader<FlightData>*>(reader)->Read(data);
+}
+
+bool ReadPayload(grpc::ServerReader<pb::FlightData>* reader, FlightData* data) {
+  return reinterpret_cast<grpc::ServerReader<FlightData>*>(reader)->Read(data);
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientWriter<pb::FlightData>* writer) {
+  return reinterpret_cast<grpc::ClientWriter<FlightPayload>*>(writer)->Write(
+      payload, grpc::WriteOptions());
+}
+
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerWriter<pb::FlightData>* writer) {
+  return reinterpret_cast<grpc::ServerWriter<FlightPayload>*>(writer)->Write(
+      payload, grpc::WriteOptions());
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
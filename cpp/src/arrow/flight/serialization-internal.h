@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// (De)serialization of FlightData messages to and from gRPC streams without
+// copying the Arrow buffers. The gRPC customizations all live in
+// serialization-internal.cc so that the client and the server instantiate the
+// readers and writers with the same SerializationTraits
+
+#pragma once
+
+#include <memory>
+
+#include "grpcpp/grpcpp.h"
+
+#include "arrow/buffer.h"
+#include "arrow/ipc/writer.h"
+
+#include "arrow/flight/Flight.grpc.pb.h"
+#include "arrow/flight/Flight.pb.h"
+#include "arrow/flight/types.h"
+
+namespace arrow {
+
+class Status;
+
+namespace ipc {
+
+class Message;
+
+}  // namespace ipc
+
+namespace flight {
+namespace internal {
+
+namespace pb = arrow::flight::protocol;
+
+/// Internal, not user-visible type used for memory-efficient reads from gRPC
+/// stream
+struct FlightData {
+  /// Used only for puts, may be null
+  std::unique_ptr<FlightDescriptor> descriptor;
+
+  /// Non-length-prefixed Message header as described in format/Message.fbs
+  std::shared_ptr<Buffer> metadata;
+
+  /// Message body
+  std::shared_ptr<Buffer> body;
+
+  /// Open IPC message from the metadata and body
+  Status OpenMessage(std::unique_ptr<ipc::Message>* message);
+};
+
+/// Internal type used to write an IPC message to a gRPC stream without
+/// copying its body
+struct FlightPayload {
+  /// Serialized FlightDescriptor protobuf, only sent with the first message
+  /// of a DoPut, may be null
+  std::shared_ptr<Buffer> descriptor;
+
+  ipc::internal::IpcPayload ipc_message;
+};
+
+/// Read a FlightData message from the stream, referencing the received gRPC
+/// slices. Return false when the stream is finished
+bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data);
+bool ReadPayload(grpc::ServerReader<pb::FlightData>* reader, FlightData* data);
+
+/// Write a payload to the stream. Return false if the stream is closed
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientWriter<pb::FlightData>* writer);
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerWriter<pb::FlightData>* writer);
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -18,15 +18,15 @@
 #include "arrow/flight/server.h"
 
 #include <cstdint>
-#include <limits>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/io/zero_copy_stream.h"
-#include "google/protobuf/wire_format_lite.h"
 #include "grpcpp/grpcpp.h"
 
+#include "arrow/buffer.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
@@ -35,6 +35,7 @@
 #include "arrow/flight/Flight.grpc.pb.h"
 #include "arrow/flight/Flight.pb.h"
 #include "arrow/flight/internal.h"
+#include "arrow/flight/serialization-internal.h"
 #include "arrow/flight/types.h"
 
 using FlightService = arrow::flight::protocol::FlightService;
@@ -47,130 +48,41 @@ using ServerWriter = grpc::ServerWriter<T>;
 
 namespace pb = arrow::flight::protocol;
 
-constexpr int64_t kInt32Max = std::numeric_limits<int32_t>::max();
-
-namespace grpc {
-
-using google::protobuf::internal::WireFormatLite;
-using google::protobuf::io::CodedOutputStream;
+namespace arrow {
+namespace flight {
 
-// More efficient writing of FlightData to gRPC output buffer
-// Implementation of ZeroCopyOutputStream that writes to a fixed-size buffer
-class FixedSizeProtoWriter : public ::google::protobuf::io::ZeroCopyOutputStream {
- public:
-  explicit FixedSizeProtoWriter(grpc_slice slice)
-      : slice_(slice),
-        bytes_written_(0),
-        total_size_(static_cast<int>(GRPC_SLICE_LENGTH(slice))) {}
-
-  bool Next(void** data, int* size) override {
-    // Consume the whole slice
-    *data = GRPC_SLICE_START_PTR(slice_) + bytes_written_;
-    *size = total_size_ - bytes_written_;
-    bytes_written_ = total_size_;
-    return true;
+#define CHECK_ARG_NOT_NULL(VAL, MESSAGE)                              \
+  if (VAL == nullptr) {                                               \
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, MESSAGE); \
   }
 
-  void BackUp(int count) override { bytes_written_ -= count; }
-
-  int64_t ByteCount() const override { return bytes_written_; }
-
- private:
-  grpc_slice slice_;
-  int bytes_written_;
-  int total_size_;
-};
-
-// Write FlightData to a grpc::ByteBuffer without extra copying
-template <>
-class SerializationTraits<IpcPayload> {
+// Yields the IPC messages received in a DoPut, the first one having been
+// read already to get the flight descriptor
+class FlightMessageStream : public ipc::MessageReader {
  public:
-  static grpc::Status Deserialize(ByteBuffer* buffer, IpcPayload* out) {
-    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
-                        "IpcPayload deserialization not implemented");
-  }
-
-  static grpc::Status Serialize(const IpcPayload& msg, ByteBuffer* out,
-                                bool* own_buffer) {
-    size_t total_size = 0;
-
-    DCHECK_LT(msg.metadata->size(), kInt32Max);
-    const int32_t metadata_size = static_cast<int32_t>(msg.metadata->size());
-
-    // 1 byte for metadata tag
-    total_size += 1 + WireFormatLite::LengthDelimitedSize(metadata_size);
-
-    int64_t body_size = 0;
-    for (const auto& buffer : msg.body_buffers) {
-      body_size += buffer->size();
-
-      const int64_t remainder = buffer->size() % 8;
-      if (remainder) {
-        body_size += 8 - remainder;
-      }
-    }
-
-    // 2 bytes for body tag
-    total_size += 2 + WireFormatLite::LengthDelimitedSize(static_cast<size_t>(body_size));
-
-    // TODO(wesm): messages over 2GB unlikely to be yet supported
-    if (total_size > kInt32Max) {
-      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
-                          "Cannot send record batches exceeding 2GB yet");
+  FlightMessageStream(std::unique_ptr<ipc::Message> first_message,
+                      grpc::ServerReader<pb::FlightData>* reader)
+      : first_message_(std::move(first_message)), reader_(reader) {}
+
+  Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
+    if (first_message_ != nullptr) {
+      *out = std::move(first_message_);
+      return Status::OK();
     }
-
-    // Allocate slice, assign to output buffer
-    grpc::Slice slice(total_size);
-
-    // XXX(wesm): for debugging
-    // std::cout << "Writing record batch with total size " << total_size << std::endl;
-
-    FixedSizeProtoWriter writer(*reinterpret_cast<grpc_slice*>(&slice));
-    CodedOutputStream pb_stream(&writer);
-
-    // Write header
-    WireFormatLite::WriteTag(pb::FlightData::kDataHeaderFieldNumber,
-                             WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &pb_stream);
-    pb_stream.WriteVarint32(metadata_size);
-    pb_stream.WriteRawMaybeAliased(msg.metadata->data(),
-                                   static_cast<int>(msg.metadata->size()));
-
-    // Write body
-    WireFormatLite::WriteTag(pb::FlightData::kDataBodyFieldNumber,
-                             WireFormatLite::WIRETYPE_LENGTH_DELIMITED, &pb_stream);
-    pb_stream.WriteVarint32(static_cast<uint32_t>(body_size));
-
-    constexpr uint8_t kPaddingBytes[8] = {0};
-
-    for (const auto& buffer : msg.body_buffers) {
-      pb_stream.WriteRawMaybeAliased(buffer->data(), static_cast<int>(buffer->size()));
-
-      // Write padding if not multiple of 8
-      const int remainder = static_cast<int>(buffer->size() % 8);
-      if (remainder) {
-        pb_stream.WriteRawMaybeAliased(kPaddingBytes, 8 - remainder);
-      }
+    internal::FlightData data;
+    // Customized read path so the message body references the gRPC slices
+    if (!internal::ReadPayload(reader_, &data)) {
+      // Stream is completed
+      *out = nullptr;
+      return Status::OK();
     }
-
-    DCHECK_EQ(static_cast<int>(total_size), pb_stream.ByteCount());
-
-    // Hand off the slice to the returned ByteBuffer
-    grpc::ByteBuffer tmp(&slice, 1);
-    out->Swap(&tmp);
-    *own_buffer = true;
-    return grpc::Status::OK;
+    return data.OpenMessage(out);
   }
-};
-
-}  // namespace grpc
-
-namespace arrow {
-namespace flight {
 
-#define CHECK_ARG_NOT_NULL(VAL, MESSAGE)                              \
-  if (VAL == nullptr) {                                               \
-    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, MESSAGE); \
-  }
+ private:
+  std::unique_ptr<ipc::Message> first_message_;
+  grpc::ServerReader<pb::FlightData>* reader_;
+};
 
 // This class glues an implementation of FlightServerBase together with the
 // gRPC service definition, so the latter is not exposed in the public API
@@ -252,14 +164,12 @@ class FlightServiceImpl : public FlightService::Service {
     std::unique_ptr<FlightDataStream> data_stream;
     GRPC_RETURN_NOT_OK(server_->DoGet(ticket, &data_stream));
 
-    // Requires ServerWriter customization in grpc_customizations.h
-    auto custom_writer = reinterpret_cast<ServerWriter<IpcPayload>*>(writer);
-
     while (true) {
-      IpcPayload payload;
-      GRPC_RETURN_NOT_OK(data_stream->Next(&payload));
-      if (payload.metadata == nullptr ||
-          !custom_writer->Write(payload, grpc::WriteOptions())) {
+      internal::FlightPayload payload;
+      GRPC_RETURN_NOT_OK(data_stream->Next(&payload.ipc_message));
+      // Customized write path so the body buffers are not copied
+      if (payload.ipc_message.metadata == nullptr ||
+          !internal::WritePayload(payload, writer)) {
         // No more messages to write, or connection terminated for some other
         // reason
         break;
@@ -270,7 +180,31 @@ class FlightServiceImpl : public FlightService::Service {
 
   grpc::Status DoPut(ServerContext* context, grpc::ServerReader<pb::FlightData>* reader,
                      pb::PutResult* response) {
-    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "");
+    // The first message carries the descriptor along with the schema
+    internal::FlightData data;
+    if (!internal::ReadPayload(reader, &data)) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "DoPut stream must start with a schema message");
+    }
+    if (data.descriptor == nullptr) {
+      return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                          "DoPut must start with a FlightDescriptor");
+    }
+    std::unique_ptr<FlightDescriptor> descriptor = std::move(data.descriptor);
+
+    std::unique_ptr<ipc::Message> first_message;
+    GRPC_RETURN_NOT_OK(data.OpenMessage(&first_message));
+
+    std::unique_ptr<ipc::MessageReader> message_reader(
+        new FlightMessageStream(std::move(first_message), reader));
+    std::shared_ptr<RecordBatchReader> batch_reader;
+    GRPC_RETURN_NOT_OK(
+        ipc::RecordBatchStreamReader::Open(std::move(message_reader), &batch_reader));
+
+    std::unique_ptr<FlightMessageReader> flight_reader(
+        new FlightMessageReader(*descriptor, batch_reader));
+    GRPC_RETURN_NOT_OK(server_->DoPut(std::move(flight_reader)));
+    return grpc::Status::OK;
   }
 
   grpc::Status ListActions(ServerContext* context, const pb::Empty* request,
@@ -353,6 +287,10 @@ Status FlightServerBase::DoGet(const Ticket& request,
   return Status::NotImplemented("NYI");
 }
 
+Status FlightServerBase::DoPut(std::unique_ptr<FlightMessageReader> reader) {
+  return Status::NotImplemented("NYI");
+}
+
 Status FlightServerBase::DoAction(const Action& action,
                                   std::unique_ptr<ResultStream>* result) {
   return Status::NotImplemented("NYI");
@@ -362,6 +300,19 @@ Status FlightServerBase::ListActions(std::vector<ActionType>* actions) {
   return Status::NotImplemented("NYI");
 }
 
+// ----------------------------------------------------------------------
+// Implement FlightMessageReader
+
+FlightMessageReader::FlightMessageReader(const FlightDescriptor& descriptor,
+                                         const std::shared_ptr<RecordBatchReader>& reader)
+    : descriptor_(descriptor), reader_(reader) {}
+
+std::shared_ptr<Schema> FlightMessageReader::schema() const { return reader_->schema(); }
+
+Status FlightMessageReader::ReadNext(std::shared_ptr<RecordBatch>* out) {
+  return reader_->ReadNext(out);
+}
+
 // ----------------------------------------------------------------------
 // Implement RecordBatchStream
 
@@ -25,6 +25,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/record_batch.h"
 #include "arrow/util/visibility.h"
 
 #include "arrow/flight/types.h"
@@ -32,7 +33,7 @@
 namespace arrow {
 
 class MemoryPool;
-class RecordBatchReader;
+class Schema;
 class Status;
 
 namespace ipc {
@@ -76,6 +77,25 @@ class ARROW_EXPORT RecordBatchStream : public FlightDataStream {
   std::shared_ptr<RecordBatchReader> reader_;
 };
 
+/// \brief A reader for the record batches uploaded by a client with DoPut.
+/// Their buffers reference the messages received by gRPC without copying
+class ARROW_EXPORT FlightMessageReader : public RecordBatchReader {
+ public:
+  FlightMessageReader(const FlightDescriptor& descriptor,
+                      const std::shared_ptr<RecordBatchReader>& reader);
+
+  /// \brief The descriptor sent by the client with the first message
+  const FlightDescriptor& descriptor() const { return descriptor_; }
+
+  std::shared_ptr<Schema> schema() const override;
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override;
+
+ private:
+  FlightDescriptor descriptor_;
+  std::shared_ptr<RecordBatchReader> reader_;
+};
+
 /// \brief Skeleton RPC server implementation which can be used to create
 /// custom servers by implementing its abstract methods
 class ARROW_EXPORT FlightServerBase {
@@ -120,7 +140,11 @@ class ARROW_EXPORT FlightServerBase {
   /// \return Status
   virtual Status DoGet(const Ticket& request, std::unique_ptr<FlightDataStream>* stream);
 
-  // virtual Status DoPut(std::unique_ptr<FlightMessageReader>* reader) = 0;
+  /// \brief Process a stream of IPC payloads sent from a client
+  /// \param[in] reader a sequence of uploaded record batches, to be consumed
+  /// before returning. The status returned is sent back to the client
+  /// \return Status
+  virtual Status DoPut(std::unique_ptr<FlightMessageReader> reader);
 
   /// \brief Execute an action, return stream of zero or more results
   /// \param[in] action the action to execute, with type and body
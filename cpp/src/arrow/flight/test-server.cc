@@ -22,6 +22,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gflags/gflags.h>
 
@@ -81,6 +82,34 @@ class FlightTestServer : public FlightServerBase {
     return Status::OK();
   }
 
+  Status DoPut(std::unique_ptr<FlightMessageReader> reader) override {
+    // Only accept the batches served for ticket-id-1
+    if (reader->descriptor().type != FlightDescriptor::PATH ||
+        reader->descriptor().path != std::vector<std::string>{"integers"}) {
+      return Status::Invalid("unexpected descriptor");
+    }
+
+    BatchVector expected_batches;
+    RETURN_NOT_OK(SimpleIntegerBatches(5, &expected_batches));
+    size_t num_batches = 0;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (!batch) {
+        break;
+      }
+      if (num_batches >= expected_batches.size() ||
+          !batch->Equals(*expected_batches[num_batches])) {
+        return Status::Invalid("unexpected record batch");
+      }
+      ++num_batches;
+    }
+    if (num_batches != expected_batches.size()) {
+      return Status::Invalid("unexpected number of record batches");
+    }
+    return Status::OK();
+  }
+
   Status RunAction1(const Action& action, std::unique_ptr<ResultStream>* out) {
     std::vector<Result> results;
     for (int i = 0; i < 3; ++i) {
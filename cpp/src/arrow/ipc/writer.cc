@@ -524,10 +524,26 @@ Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
 
 Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
                              IpcPayload* out) {
+  out->type = Message::RECORD_BATCH;
   RecordBatchSerializer writer(pool, 0, kMaxNestingDepth, true, out);
   return writer.Assemble(batch);
 }
 
+Status GetSchemaPayload(const Schema& schema, DictionaryMemo* dictionary_memo,
+                        IpcPayload* out) {
+  out->type = Message::SCHEMA;
+  out->body_buffers.clear();
+  out->body_length = 0;
+  return WriteSchemaMessage(schema, dictionary_memo, &out->metadata);
+}
+
+Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
+                            MemoryPool* pool, IpcPayload* out) {
+  out->type = Message::DICTIONARY_BATCH;
+  DictionaryWriter writer(id, pool, 0, kMaxNestingDepth, true, out);
+  return writer.Assemble(dictionary);
+}
+
 }  // namespace internal
 
 Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
@@ -29,6 +29,7 @@
 
 namespace arrow {
 
+class Array;
 class Buffer;
 class MemoryPool;
 class RecordBatch;
@@ -45,6 +46,8 @@ class OutputStream;
 
 namespace ipc {
 
+class DictionaryMemo;
+
 /// \class RecordBatchWriter
 /// \brief Abstract interface for writing a stream of record batches
 class ARROW_EXPORT RecordBatchWriter {
@@ -297,6 +300,26 @@ Status GetDictionaryPayloads(const Schema& schema,
 ARROW_EXPORT
 Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool, IpcPayload* out);
 
+/// \brief Compute IpcPayload for the given schema
+/// \param[in] schema the Schema that is being serialized
+/// \param[in,out] dictionary_memo populated with the dictionaries of the
+/// schema, whose payloads must follow the schema in a stream
+/// \param[out] out the returned IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetSchemaPayload(const Schema& schema, DictionaryMemo* dictionary_memo,
+                        IpcPayload* out);
+
+/// \brief Compute IpcPayload for a dictionary
+/// \param[in] id the dictionary id assigned by a DictionaryMemo
+/// \param[in] dictionary the dictionary values
+/// \param[in,out] pool for any required temporary memory allocations
+/// \param[out] out the returned IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
+                            MemoryPool* pool, IpcPayload* out);
+
 }  // namespace internal
 
 }  // namespace ipc
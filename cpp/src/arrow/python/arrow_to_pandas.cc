@@ -21,6 +21,7 @@
 
 #include "arrow/python/arrow_to_pandas.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <memory>
@@ -35,10 +36,13 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/api.h"
@@ -396,11 +400,53 @@ static Status ConvertIntegerObjects(PandasOptions options, const ChunkedArray& d
   return Status::OK();
 }
 
+// Wrap binary values as Python objects. With deduplication, the values are
+// memoized and a single object is created for all the occurrences of a value.
+// The column conversions are not given a pool, so the memo table is allocated
+// from the PyArrow one.
+template <typename ArrayType>
+class BinaryValueWrapper {
+ public:
+  explicit BinaryValueWrapper(bool deduplicate)
+      : deduplicate_(deduplicate), memo_table_(get_memory_pool(), 0) {}
+
+  Status Wrap(const uint8_t* data, int32_t length, PyObject** out) {
+    int32_t memo_index = -1;
+    if (deduplicate_) {
+      RETURN_NOT_OK(memo_table_.GetOrInsert(data, length, &memo_index));
+      if (memo_index < static_cast<int32_t>(unique_values_.size())) {
+        Py_INCREF(unique_values_[memo_index]);
+        *out = unique_values_[memo_index];
+        return Status::OK();
+      }
+    }
+    *out = WrapBytes<ArrayType>::Wrap(data, length);
+    if (*out == nullptr) {
+      PyErr_Clear();
+      std::stringstream ss;
+      ss << "Wrapping " << std::string(reinterpret_cast<const char*>(data), length)
+         << " failed";
+      return Status::UnknownError(ss.str());
+    }
+    if (deduplicate_) {
+      unique_values_.push_back(*out);
+    }
+    return Status::OK();
+  }
+
+ private:
+  bool deduplicate_;
+  ::arrow::internal::BinaryMemoTable memo_table_;
+  // Borrowed references, owned by the converted values
+  std::vector<PyObject*> unique_values_;
+};
+
 template <typename Type>
 inline Status ConvertBinaryLike(PandasOptions options, const ChunkedArray& data,
                                 PyObject** out_values) {
   using ArrayType = typename TypeTraits<Type>::ArrayType;
   PyAcquireGIL lock;
+  BinaryValueWrapper<ArrayType> wrapper(options.deduplicate_objects);
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = checked_cast<const ArrayType&>(*data.chunk(c));
 
@@ -413,14 +459,7 @@ inline Status ConvertBinaryLike(PandasOptions options, const ChunkedArray& data,
         *out_values = Py_None;
       } else {
         data_ptr = arr.GetValue(i, &length);
-        *out_values = WrapBytes<ArrayType>::Wrap(data_ptr, length);
-        if (*out_values == nullptr) {
-          PyErr_Clear();
-          std::stringstream ss;
-          ss << "Wrapping "
-             << std::string(reinterpret_cast<const char*>(data_ptr), length) << " failed";
-          return Status::UnknownError(ss.str());
-        }
+        RETURN_NOT_OK(wrapper.Wrap(data_ptr, length, out_values));
       }
       ++out_values;
     }
@@ -447,6 +486,7 @@ inline Status ConvertNulls(PandasOptions options, const ChunkedArray& data,
 inline Status ConvertFixedSizeBinary(PandasOptions options, const ChunkedArray& data,
                                      PyObject** out_values) {
   PyAcquireGIL lock;
+  BinaryValueWrapper<FixedSizeBinaryArray> wrapper(options.deduplicate_objects);
   for (int c = 0; c < data.num_chunks(); c++) {
     auto arr = checked_cast<FixedSizeBinaryArray*>(data.chunk(c).get());
 
@@ -460,14 +500,7 @@ inline Status ConvertFixedSizeBinary(PandasOptions options, const ChunkedArray&
         *out_values = Py_None;
       } else {
         data_ptr = arr->GetValue(i);
-        *out_values = WrapBytes<FixedSizeBinaryArray>::Wrap(data_ptr, length);
-        if (*out_values == nullptr) {
-          PyErr_Clear();
-          std::stringstream ss;
-          ss << "Wrapping "
-             << std::string(reinterpret_cast<const char*>(data_ptr), length) << " failed";
-          return Status::UnknownError(ss.str());
-        }
+        RETURN_NOT_OK(wrapper.Wrap(data_ptr, length, out_values));
       }
       ++out_values;
     }
@@ -826,20 +859,45 @@ class ObjectBlock : public PandasBlock {
   }
 };
 
-template <int ARROW_TYPE, typename C_TYPE>
-class IntBlock : public PandasBlock {
+// A block of fixed-width values, which can be written by row slices. The
+// slices of a column are disjoint ranges of the block and may be written
+// concurrently.
+class FixedWidthPandasBlock : public PandasBlock {
  public:
   using PandasBlock::PandasBlock;
+
+  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
+               int64_t rel_placement) override {
+    return WriteSlice(col, abs_placement, rel_placement, 0);
+  }
+
+  // Write col, a slice of the column starting at row row_offset
+  Status WriteSlice(const std::shared_ptr<Column>& col, int64_t abs_placement,
+                    int64_t rel_placement, int64_t row_offset) {
+    RETURN_NOT_OK(WriteValues(col, rel_placement * num_rows_ + row_offset));
+    if (row_offset == 0) {
+      placement_data_[rel_placement] = abs_placement;
+    }
+    return Status::OK();
+  }
+
+ protected:
+  // Write the values of col starting at the given value index of the block
+  virtual Status WriteValues(const std::shared_ptr<Column>& col, int64_t position) = 0;
+};
+
+template <int ARROW_TYPE, typename C_TYPE>
+class IntBlock : public FixedWidthPandasBlock {
+ public:
+  using FixedWidthPandasBlock::FixedWidthPandasBlock;
   Status Allocate() override {
     return AllocateNDArray(internal::arrow_traits<ARROW_TYPE>::npy_type);
   }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteValues(const std::shared_ptr<Column>& col, int64_t position) override {
     Type::type type = col->type()->id();
 
-    C_TYPE* out_buffer =
-        reinterpret_cast<C_TYPE*>(block_data_) + rel_placement * num_rows_;
+    C_TYPE* out_buffer = reinterpret_cast<C_TYPE*>(block_data_) + position;
 
     const ChunkedArray& data = *col->data().get();
 
@@ -851,7 +909,6 @@ class IntBlock : public PandasBlock {
     }
 
     ConvertIntegerNoNullsSameType<C_TYPE>(options_, data, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
@@ -865,13 +922,12 @@ using Int32Block = IntBlock<Type::INT32, int32_t>;
 using UInt64Block = IntBlock<Type::UINT64, uint64_t>;
 using Int64Block = IntBlock<Type::INT64, int64_t>;
 
-class Float16Block : public PandasBlock {
+class Float16Block : public FixedWidthPandasBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using FixedWidthPandasBlock::FixedWidthPandasBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT16); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteValues(const std::shared_ptr<Column>& col, int64_t position) override {
     Type::type type = col->type()->id();
 
     if (type != Type::HALF_FLOAT) {
@@ -881,22 +937,19 @@ class Float16Block : public PandasBlock {
       return Status::NotImplemented(ss.str());
     }
 
-    npy_half* out_buffer =
-        reinterpret_cast<npy_half*>(block_data_) + rel_placement * num_rows_;
+    npy_half* out_buffer = reinterpret_cast<npy_half*>(block_data_) + position;
 
     ConvertNumericNullable<npy_half>(*col->data().get(), NPY_HALF_NAN, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class Float32Block : public PandasBlock {
+class Float32Block : public FixedWidthPandasBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using FixedWidthPandasBlock::FixedWidthPandasBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT32); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteValues(const std::shared_ptr<Column>& col, int64_t position) override {
     Type::type type = col->type()->id();
 
     if (type != Type::FLOAT) {
@@ -906,25 +959,22 @@ class Float32Block : public PandasBlock {
       return Status::NotImplemented(ss.str());
     }
 
-    float* out_buffer = reinterpret_cast<float*>(block_data_) + rel_placement * num_rows_;
+    float* out_buffer = reinterpret_cast<float*>(block_data_) + position;
 
     ConvertNumericNullable<float>(*col->data().get(), NAN, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class Float64Block : public PandasBlock {
+class Float64Block : public FixedWidthPandasBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using FixedWidthPandasBlock::FixedWidthPandasBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT64); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteValues(const std::shared_ptr<Column>& col, int64_t position) override {
     Type::type type = col->type()->id();
 
-    double* out_buffer =
-        reinterpret_cast<double*>(block_data_) + rel_placement * num_rows_;
+    double* out_buffer = reinterpret_cast<double*>(block_data_) + position;
 
     const ChunkedArray& data = *col->data().get();
 
@@ -964,18 +1014,16 @@ class Float64Block : public PandasBlock {
 
 #undef INTEGER_CASE
 
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class BoolBlock : public PandasBlock {
+class BoolBlock : public FixedWidthPandasBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using FixedWidthPandasBlock::FixedWidthPandasBlock;
   Status Allocate() override { return AllocateNDArray(NPY_BOOL); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteValues(const std::shared_ptr<Column>& col, int64_t position) override {
     Type::type type = col->type()->id();
 
     if (type != Type::BOOL) {
@@ -985,18 +1033,16 @@ class BoolBlock : public PandasBlock {
       return Status::NotImplemented(ss.str());
     }
 
-    uint8_t* out_buffer =
-        reinterpret_cast<uint8_t*>(block_data_) + rel_placement * num_rows_;
+    uint8_t* out_buffer = reinterpret_cast<uint8_t*>(block_data_) + position;
 
     ConvertBooleanNoNulls(options_, *col->data(), out_buffer);
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class DatetimeBlock : public PandasBlock {
+class DatetimeBlock : public FixedWidthPandasBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using FixedWidthPandasBlock::FixedWidthPandasBlock;
   Status AllocateDatetime(int ndim) {
     RETURN_NOT_OK(AllocateNDArray(NPY_DATETIME, ndim));
 
@@ -1009,12 +1055,10 @@ class DatetimeBlock : public PandasBlock {
 
   Status Allocate() override { return AllocateDatetime(2); }
 
-  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
-               int64_t rel_placement) override {
+  Status WriteValues(const std::shared_ptr<Column>& col, int64_t position) override {
     Type::type type = col->type()->id();
 
-    int64_t* out_buffer =
-        reinterpret_cast<int64_t*>(block_data_) + rel_placement * num_rows_;
+    int64_t* out_buffer = reinterpret_cast<int64_t*>(block_data_) + position;
 
     const ChunkedArray& data = *col->data();
 
@@ -1046,7 +1090,6 @@ class DatetimeBlock : public PandasBlock {
       return Status::NotImplemented(ss.str());
     }
 
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
@@ -1316,6 +1359,9 @@ Status MakeBlock(PandasOptions options, PandasBlock::type type, int64_t num_rows
 
 using BlockMap = std::unordered_map<int, std::shared_ptr<PandasBlock>>;
 
+// Minimum number of rows of the slices of a column written in parallel
+static constexpr int64_t kMinRowsPerSlice = 1 << 16;
+
 static Status GetPandasBlockType(const Column& col, const PandasOptions& options,
                                  PandasBlock::type* output_type) {
 #define INTEGER_CASE(NAME)                                                           \
@@ -1502,14 +1548,48 @@ class DataFrameBlockCreator {
       return block->Write(this->table_->column(i), i, this->column_block_placement_[i]);
     };
 
-    if (options_.use_threads) {
-      return ParallelFor(table_->num_columns(), WriteColumn);
-    } else {
+    if (!options_.use_threads) {
       for (int i = 0; i < table_->num_columns(); ++i) {
         RETURN_NOT_OK(WriteColumn(i));
       }
       return Status::OK();
     }
+
+    // Split the fixed-width columns in row slices, so that a table with few
+    // tall columns still uses all the threads. Object and categorical columns
+    // are written whole, their conversion is serialized by the GIL anyway.
+    struct WriteTask {
+      int column;
+      int64_t offset;
+      int64_t length;
+    };
+    const int64_t num_rows = table_->num_rows();
+    const int64_t slice_rows = std::max(
+        kMinRowsPerSlice, BitUtil::CeilDiv(num_rows, GetCpuThreadPoolCapacity()));
+    std::vector<WriteTask> tasks;
+    for (int i = 0; i < table_->num_columns(); ++i) {
+      if (column_types_[i] == PandasBlock::OBJECT ||
+          column_types_[i] == PandasBlock::CATEGORICAL || num_rows <= slice_rows) {
+        tasks.push_back({i, 0, num_rows});
+        continue;
+      }
+      for (int64_t offset = 0; offset < num_rows; offset += slice_rows) {
+        tasks.push_back({i, offset, std::min(slice_rows, num_rows - offset)});
+      }
+    }
+
+    auto WriteSlice = [this, &tasks, &WriteColumn, num_rows](int task_index) -> Status {
+      const WriteTask& task = tasks[task_index];
+      if (task.length == num_rows) {
+        return WriteColumn(task.column);
+      }
+      std::shared_ptr<PandasBlock> block;
+      RETURN_NOT_OK(this->GetBlock(task.column, &block));
+      return checked_cast<FixedWidthPandasBlock&>(*block).WriteSlice(
+          this->table_->column(task.column)->Slice(task.offset, task.length),
+          task.column, this->column_block_placement_[task.column], task.offset);
+    };
+    return ParallelFor(static_cast<int>(tasks.size()), WriteSlice);
   }
 
   Status AppendBlocks(const BlockMap& blocks, PyObject* list) {
@@ -48,13 +48,17 @@ struct PandasOptions {
   bool integer_object_nulls;
   bool date_as_object;
   bool use_threads;
+  /// If true, create a single Python object for equal string and binary
+  /// values, instead of one per value
+  bool deduplicate_objects;
 
   PandasOptions()
       : strings_to_categorical(false),
         zero_copy_only(false),
         integer_object_nulls(false),
         date_as_object(false),
-        use_threads(false) {}
+        use_threads(false),
+        deduplicate_objects(false) {}
 };
 
 ARROW_EXPORT
@@ -16,7 +16,17 @@
 // under the License.
 
 #include <arrow/python/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <arrow/memory_pool.h>
+#include <arrow/status.h>
+#include <arrow/table.h>
+#include <arrow/util/parallel.h>
+
 #include <arrow/python/helpers.h>
+#include <arrow/python/numpy_to_arrow.h>
 
 namespace arrow {
 namespace py {
@@ -33,6 +43,40 @@ void Benchmark_PandasObjectIsNull(PyObject* list) {
   }
 }
 
+void Benchmark_NdarraysToArrow(PyObject* list, bool use_threads) {
+  if (!PyList_CheckExact(list)) {
+    PyErr_SetString(PyExc_TypeError, "expected a list");
+    return;
+  }
+  std::vector<PyObject*> arrays;
+  for (Py_ssize_t i = 0; i < PyList_GET_SIZE(list); i++) {
+    arrays.push_back(PyList_GET_ITEM(list, i));
+  }
+
+  auto Convert = [&arrays](int i) {
+    std::shared_ptr<ChunkedArray> out;
+    return NdarrayToArrow(default_memory_pool(), arrays[i], nullptr, true, nullptr,
+                          &out);
+  };
+  const int num_arrays = static_cast<int>(arrays.size());
+
+  // The conversions acquire the GIL when they need it
+  Status st;
+  Py_BEGIN_ALLOW_THREADS;
+  if (use_threads) {
+    st = ::arrow::internal::ParallelFor(num_arrays, Convert);
+  } else {
+    for (int i = 0; i < num_arrays && st.ok(); i++) {
+      st = Convert(i);
+    }
+  }
+  Py_END_ALLOW_THREADS;
+
+  if (!st.ok() && !PyErr_Occurred()) {
+    PyErr_SetString(PyExc_RuntimeError, st.ToString().c_str());
+  }
+}
+
 }  // namespace benchmark
 }  // namespace py
 }  // namespace arrow
@@ -32,6 +32,11 @@ namespace benchmark {
 ARROW_EXPORT
 void Benchmark_PandasObjectIsNull(PyObject* list);
 
+// Convert every ndarray in *list* to Arrow, concurrently on the CPU thread
+// pool if use_threads is true, like the columns of a pandas DataFrame
+ARROW_EXPORT
+void Benchmark_NdarraysToArrow(PyObject* list, bool use_threads);
+
 }  // namespace benchmark
 }  // namespace py
 }  // namespace arrow
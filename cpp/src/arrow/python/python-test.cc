@@ -29,6 +29,7 @@
 #include "arrow/python/arrow_to_pandas.h"
 #include "arrow/python/decimal.h"
 #include "arrow/python/helpers.h"
+#include "arrow/python/numpy_interop.h"
 #include "arrow/python/python_to_arrow.h"
 #include "arrow/util/checked_cast.h"
 
@@ -274,6 +275,50 @@ TEST(BuiltinConversionTest, TestMixedTypeFails) {
   ASSERT_RAISES(TypeError, ConvertPySequence(list, {}, &arr));
 }
 
+TEST(BuiltinConversionTest, TestObjectNdarrayStrings) {
+  PyAcquireGIL lock;
+
+  // More values than a conversion batch, with all the str representations
+  const std::vector<const char*> values = {"abc", "ma\xc3\xb1" "ana", "\xe6\x97\xa5",
+                                           "\xf0\x9f\x98\x80", nullptr};
+  const int64_t length = 10000;
+  npy_intp dims[1] = {length};
+  OwnedRef arr_ref(PyArray_SimpleNew(1, dims, NPY_OBJECT));
+  ASSERT_NE(arr_ref.obj(), nullptr);
+  auto ndarray = reinterpret_cast<PyArrayObject*>(arr_ref.obj());
+  auto items = reinterpret_cast<PyObject**>(PyArray_DATA(ndarray));
+
+  StringBuilder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    const char* value = values[i % values.size()];
+    if (value == nullptr) {
+      Py_INCREF(Py_None);
+      items[i] = Py_None;
+      ASSERT_OK(builder.AppendNull());
+    } else {
+      items[i] = PyUnicode_FromString(value);
+      ASSERT_NE(items[i], nullptr);
+      ASSERT_OK(builder.Append(value));
+    }
+  }
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(builder.Finish(&expected));
+
+  PyConversionOptions options;
+  options.type = utf8();
+  std::shared_ptr<ChunkedArray> result;
+  ASSERT_OK(ConvertPySequence(arr_ref.obj(), options, &result));
+  ASSERT_EQ(1, result->num_chunks());
+  ASSERT_ARRAYS_EQUAL(*expected, *result->chunk(0));
+
+  // Surrogates cannot be encoded to UTF-8
+  Py_DECREF(items[1]);
+  items[1] = PyUnicode_FromOrdinal(0xD800);
+  ASSERT_NE(items[1], nullptr);
+  ASSERT_FALSE(ConvertPySequence(arr_ref.obj(), options, &result).ok());
+  PyErr_Clear();
+}
+
 TEST_F(DecimalTest, FromPythonDecimalRescaleNotTruncateable) {
   // We fail when truncating values that would lose data if cast to a decimal type with
   // lower scale
@@ -475,6 +475,42 @@ inline Status BuilderAppend(FixedSizeBinaryBuilder* builder, PyObject* obj,
       [&builder](const char* bytes, int32_t length) { return builder->Append(bytes); });
 }
 
+#if PY_MAJOR_VERSION >= 3
+
+// Encode UCS-1, UCS-2 or UCS-4 code units (the PEP 393 representations of
+// str) to UTF-8. This does not use the Python C API and may run without the
+// GIL. Surrogates cannot be encoded and are reported as an error.
+template <typename CodeUnit>
+inline Status EncodeUTF8(const CodeUnit* data, int64_t length, std::string* out) {
+  out->resize(static_cast<size_t>(length) * 4);
+  auto dest = reinterpret_cast<uint8_t*>(&(*out)[0]);
+  for (int64_t i = 0; i < length; ++i) {
+    const uint32_t c = data[i];
+    if (c < 0x80) {
+      *dest++ = static_cast<uint8_t>(c);
+    } else if (c < 0x800) {
+      *dest++ = static_cast<uint8_t>(0xC0 | (c >> 6));
+      *dest++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+    } else if (c < 0x10000) {
+      if (ARROW_PREDICT_FALSE(c >= 0xD800 && c <= 0xDFFF)) {
+        return Status::Invalid("surrogates not allowed");
+      }
+      *dest++ = static_cast<uint8_t>(0xE0 | (c >> 12));
+      *dest++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+      *dest++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+    } else {
+      *dest++ = static_cast<uint8_t>(0xF0 | (c >> 18));
+      *dest++ = static_cast<uint8_t>(0x80 | ((c >> 12) & 0x3F));
+      *dest++ = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+      *dest++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+    }
+  }
+  out->resize(dest - reinterpret_cast<uint8_t*>(&(*out)[0]));
+  return Status::OK();
+}
+
+#endif
+
 }  // namespace detail
 
 template <typename Type>
@@ -507,8 +543,42 @@ class FixedWidthBytesConverter : public BinaryLikeConverter<FixedSizeBinaryType>
 template <bool STRICT>
 class StringConverter : public TypedConverter<StringType, StringConverter<STRICT>> {
  public:
+  using Base = TypedConverter<StringType, StringConverter<STRICT>>;
+
   StringConverter() : binary_count_(0) {}
 
+#if PY_MAJOR_VERSION >= 3
+  // Object ndarrays (e.g. pandas columns) are converted by batches: the
+  // values are looked up with the GIL held, then encoded to UTF-8 and
+  // appended with the GIL released, so that other threads can convert other
+  // columns meanwhile. Holding references to the batched objects keeps them
+  // alive even if the ndarray is modified while the GIL is released.
+  Status AppendMultiple(PyObject* obj, int64_t size) override {
+    if (!IsObjectNdarray(obj)) {
+      return Base::AppendMultiple(obj, size);
+    }
+    RETURN_NOT_OK(this->typed_builder_->Reserve(size));
+    RETURN_NOT_OK(internal::VisitSequence(
+        obj, [this](PyObject* item, bool* keep_going /* unused */) {
+          return BatchValue(item, this->CheckNull(item));
+        }));
+    return FlushBatch();
+  }
+
+  Status AppendMultipleMasked(PyObject* obj, PyObject* mask, int64_t size) override {
+    if (!IsObjectNdarray(obj)) {
+      return Base::AppendMultipleMasked(obj, mask, size);
+    }
+    RETURN_NOT_OK(this->typed_builder_->Reserve(size));
+    RETURN_NOT_OK(internal::VisitSequenceMasked(
+        obj, mask,
+        [this](PyObject* item, bool is_masked, bool* keep_going /* unused */) {
+          return BatchValue(item, is_masked || this->CheckNull(item));
+        }));
+    return FlushBatch();
+  }
+#endif
+
   Status Append(PyObject* obj, bool* is_full) {
     if (STRICT) {
       // Force output to be unicode / utf8 and validate that any binary values
@@ -570,6 +640,113 @@ class StringConverter : public TypedConverter<StringType, StringConverter<STRICT
   }
 
  private:
+#if PY_MAJOR_VERSION >= 3
+  static constexpr size_t kBatchSize = 4096;
+
+  // A batched value, which is a null if obj is null. kind is the code unit
+  // size of a str to encode, or 0 for data which is already UTF-8 or binary
+  struct BatchedValue {
+    PyObject* obj;
+    const void* data;
+    int64_t length;
+    int kind;
+  };
+
+  static bool IsObjectNdarray(PyObject* obj) {
+    return PyArray_Check(obj) &&
+           PyArray_DESCR(reinterpret_cast<PyArrayObject*>(obj))->type_num == NPY_OBJECT;
+  }
+
+  Status BatchValue(PyObject* obj, bool is_null) {
+    if (is_null) {
+      batch_.push_back({nullptr, nullptr, 0, 0});
+    } else if (PyUnicode_Check(obj)) {
+      if (PyUnicode_READY(obj) < 0) {
+        RETURN_IF_PYERROR();
+      }
+      Py_INCREF(obj);
+      const int kind =
+          PyUnicode_IS_ASCII(obj) ? 0 : static_cast<int>(PyUnicode_KIND(obj));
+      batch_.push_back({obj, PyUnicode_DATA(obj), PyUnicode_GET_LENGTH(obj), kind});
+    } else if (!STRICT && PyBytes_Check(obj)) {
+      Py_INCREF(obj);
+      batch_.push_back({obj, PyBytes_AS_STRING(obj), PyBytes_GET_SIZE(obj), 0});
+      ++binary_count_;
+    } else {
+      // Other objects are converted right away, with the GIL held
+      RETURN_NOT_OK(FlushBatch());
+      return AppendItem(obj);
+    }
+    return batch_.size() < kBatchSize ? Status::OK() : FlushBatch();
+  }
+
+  Status FlushBatch() {
+    if (batch_.empty()) {
+      return Status::OK();
+    }
+    size_t num_appended = 0;
+    Status st;
+    Py_BEGIN_ALLOW_THREADS;
+    st = AppendBatch(&num_appended);
+    Py_END_ALLOW_THREADS;
+    if (!st.ok() && num_appended < batch_.size() && batch_[num_appended].kind != 0) {
+      // Raise the same error as the regular conversion, e.g. for surrogates
+      Status py_status = string_view_.FromUnicode(batch_[num_appended].obj);
+      if (!py_status.ok()) {
+        st = py_status;
+      }
+    }
+    for (const auto& value : batch_) {
+      Py_XDECREF(value.obj);
+    }
+    batch_.clear();
+    return st;
+  }
+
+  // Append the batched values to the builder, without the GIL
+  Status AppendBatch(size_t* num_appended) {
+    for (const auto& value : batch_) {
+      if (value.obj == nullptr) {
+        RETURN_NOT_OK(this->typed_builder_->AppendNull());
+      } else if (value.kind == 0) {
+        RETURN_NOT_OK(AppendBytes(static_cast<const char*>(value.data), value.length));
+      } else {
+        if (value.kind == PyUnicode_1BYTE_KIND) {
+          RETURN_NOT_OK(detail::EncodeUTF8(static_cast<const Py_UCS1*>(value.data),
+                                           value.length, &encoded_));
+        } else if (value.kind == PyUnicode_2BYTE_KIND) {
+          RETURN_NOT_OK(detail::EncodeUTF8(static_cast<const Py_UCS2*>(value.data),
+                                           value.length, &encoded_));
+        } else {
+          RETURN_NOT_OK(detail::EncodeUTF8(static_cast<const Py_UCS4*>(value.data),
+                                           value.length, &encoded_));
+        }
+        RETURN_NOT_OK(AppendBytes(encoded_.data(), encoded_.size()));
+      }
+      ++*num_appended;
+    }
+    return Status::OK();
+  }
+
+  Status AppendBytes(const char* bytes, int64_t length) {
+    if (ARROW_PREDICT_FALSE(length > kBinaryMemoryLimit)) {
+      return Status::CapacityError("String value exceeds maximum size (2GB)");
+    }
+    // Start a new chunk when the builder is full
+    if (ARROW_PREDICT_FALSE(this->typed_builder_->value_data_length() + length >
+                            kBinaryMemoryLimit)) {
+      std::shared_ptr<Array> chunk;
+      RETURN_NOT_OK(this->typed_builder_->Finish(&chunk));
+      this->chunks_.emplace_back(std::move(chunk));
+    }
+    return this->typed_builder_->Append(bytes, static_cast<int32_t>(length));
+  }
+
+  std::vector<BatchedValue> batch_;
+  // Scratch space for encoding values to UTF-8
+  std::string encoded_;
+#endif
+
   // Create a single instance of PyBytesView here to prevent unnecessary object
   // creation/destruction
   PyBytesView string_view_;
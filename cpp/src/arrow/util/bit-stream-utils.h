@@ -303,35 +303,39 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
     }
   }
 
-  if (sizeof(T) == 4) {
-    int num_unpacked =
-        internal::unpack32(reinterpret_cast<const uint32_t*>(buffer + byte_offset),
-                           reinterpret_cast<uint32_t*>(v + i), batch_size - i, num_bits);
-    i += num_unpacked;
-    byte_offset += num_unpacked * num_bits / 8;
-  } else {
-    const int buffer_size = 1024;
-    uint32_t unpack_buffer[buffer_size];
-    while (i < batch_size) {
-      int unpack_size = std::min(buffer_size, batch_size - i);
-      int num_unpacked =
-          internal::unpack32(reinterpret_cast<const uint32_t*>(buffer + byte_offset),
-                             unpack_buffer, unpack_size, num_bits);
-      if (num_unpacked == 0) {
-        break;
-      }
-      for (int k = 0; k < num_unpacked; ++k) {
+  // unpack32 decodes whole blocks of 32 values, smaller batches are handled below
+  // without the function call overhead
+  if (batch_size - i >= 32) {
+    if (sizeof(T) == 4) {
+      int num_unpacked = internal::unpack32(
+          reinterpret_cast<const uint32_t*>(buffer + byte_offset),
+          reinterpret_cast<uint32_t*>(v + i), batch_size - i, num_bits);
+      i += num_unpacked;
+      byte_offset += num_unpacked * num_bits / 8;
+    } else {
+      const int buffer_size = 1024;
+      uint32_t unpack_buffer[buffer_size];
+      while (i < batch_size) {
+        int unpack_size = std::min(buffer_size, batch_size - i);
+        int num_unpacked =
+            internal::unpack32(reinterpret_cast<const uint32_t*>(buffer + byte_offset),
+                               unpack_buffer, unpack_size, num_bits);
+        if (num_unpacked == 0) {
+          break;
+        }
+        for (int k = 0; k < num_unpacked; ++k) {
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4800)
 #endif
-        v[i + k] = static_cast<T>(unpack_buffer[k]);
+          v[i + k] = static_cast<T>(unpack_buffer[k]);
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
+        }
+        i += num_unpacked;
+        byte_offset += num_unpacked * num_bits / 8;
       }
-      i += num_unpacked;
-      byte_offset += num_unpacked * num_bits / 8;
     }
   }
 
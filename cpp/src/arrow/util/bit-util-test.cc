@@ -734,6 +734,16 @@ TEST(BitUtil, CountLeadingZeros) {
   EXPECT_EQ(BitUtil::CountLeadingZeros(U64(ULLONG_MAX)), 0);
 }
 
+TEST(BitUtil, CountTrailingZeros) {
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U32(0)), 32);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U32(1)), 0);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U32(2)), 1);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U32(3)), 0);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U32(12)), 2);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U32(UINT_MAX / 2 + 1)), 31);
+  EXPECT_EQ(BitUtil::CountTrailingZeros(U32(UINT_MAX)), 0);
+}
+
 #undef U32
 #undef U64
 
@@ -45,6 +45,7 @@
 #if defined(_MSC_VER)
 #include <intrin.h>
 #pragma intrinsic(_BitScanReverse)
+#pragma intrinsic(_BitScanForward)
 #define ARROW_BYTE_SWAP64 _byteswap_uint64
 #define ARROW_BYTE_SWAP32 _byteswap_ulong
 #else
@@ -188,6 +189,29 @@ static inline int CountLeadingZeros(uint64_t value) {
 #endif
 }
 
+/// \brief Count the number of trailing zeros in an unsigned integer.
+static inline int CountTrailingZeros(uint32_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  if (value == 0) return 32;
+  return static_cast<int>(__builtin_ctz(value));
+#elif defined(_MSC_VER)
+  unsigned long index;                                              // NOLINT
+  if (_BitScanForward(&index, static_cast<unsigned long>(value))) {  // NOLINT
+    return static_cast<int>(index);
+  } else {
+    return 32;
+  }
+#else
+  if (value == 0) return 32;
+  int bitpos = 0;
+  while ((value & 1) == 0) {
+    value >>= 1;
+    ++bitpos;
+  }
+  return bitpos;
+#endif
+}
+
 // Returns the minimum number of bits needed to represent an unsigned value
 static inline int NumRequiredBits(uint64_t x) { return 64 - CountLeadingZeros(x); }
 
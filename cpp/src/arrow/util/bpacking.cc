@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking.h"
+
+#include "arrow/util/bpacking_simd.h"
+#include "arrow/util/cpu-info.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+typedef int (*UnpackFunc)(const uint32_t*, uint32_t*, int, int);
+typedef void (*Gather32Func)(const uint32_t*, const int32_t*, int, uint32_t*);
+typedef void (*Gather64Func)(const uint64_t*, const int32_t*, int, uint64_t*);
+
+void gather32_default(const uint32_t* dictionary, const int32_t* indices,
+                      int num_values, uint32_t* out) {
+  for (int i = 0; i < num_values; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+void gather64_default(const uint64_t* dictionary, const int32_t* indices,
+                      int num_values, uint64_t* out) {
+  for (int i = 0; i < num_values; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+// Unpack as many blocks as the SIMD kernel can handle without reading past the
+// end of the input, then finish with the scalar implementation
+template <int (*UnpackBlocks)(const uint32_t*, uint32_t*, int, int)>
+int UnpackWithKernel(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  const int num_blocks = batch_size / 32;
+  const int simd_blocks = num_bits == 0 ? 0 : UnpackBlocks(in, out, num_blocks, num_bits);
+  const int simd_values = simd_blocks * 32;
+  return simd_values + unpack32_default(in + simd_blocks * num_bits, out + simd_values,
+                                        (num_blocks - simd_blocks) * 32, num_bits);
+}
+
+UnpackFunc ResolveUnpack32() {
+  auto cpu_info = CpuInfo::GetInstance();
+#ifdef ARROW_HAVE_AVX512
+  if (cpu_info->IsSupported(CpuInfo::AVX512)) {
+    return unpack32_avx512;
+  }
+#endif
+#ifdef ARROW_HAVE_AVX2
+  if (cpu_info->IsSupported(CpuInfo::AVX2)) {
+    return unpack32_avx2;
+  }
+#endif
+  ARROW_UNUSED(cpu_info);
+  return unpack32_default;
+}
+
+Gather32Func ResolveGather32() {
+  auto cpu_info = CpuInfo::GetInstance();
+#ifdef ARROW_HAVE_AVX512
+  if (cpu_info->IsSupported(CpuInfo::AVX512)) {
+    return detail::gather32_avx512;
+  }
+#endif
+#ifdef ARROW_HAVE_AVX2
+  if (cpu_info->IsSupported(CpuInfo::AVX2)) {
+    return detail::gather32_avx2;
+  }
+#endif
+  ARROW_UNUSED(cpu_info);
+  return gather32_default;
+}
+
+Gather64Func ResolveGather64() {
+  auto cpu_info = CpuInfo::GetInstance();
+#ifdef ARROW_HAVE_AVX512
+  if (cpu_info->IsSupported(CpuInfo::AVX512)) {
+    return detail::gather64_avx512;
+  }
+#endif
+#ifdef ARROW_HAVE_AVX2
+  if (cpu_info->IsSupported(CpuInfo::AVX2)) {
+    return detail::gather64_avx2;
+  }
+#endif
+  ARROW_UNUSED(cpu_info);
+  return gather64_default;
+}
+
+}  // namespace
+
+#ifdef ARROW_HAVE_AVX2
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  return UnpackWithKernel<detail::unpack32_blocks_avx2>(in, out, batch_size, num_bits);
+}
+#endif
+
+#ifdef ARROW_HAVE_AVX512
+int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  return UnpackWithKernel<detail::unpack32_blocks_avx512>(in, out, batch_size,
+                                                          num_bits);
+}
+#endif
+
+// The implementation is resolved once, on first use
+
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  static const UnpackFunc func = ResolveUnpack32();
+  return func(in, out, batch_size, num_bits);
+}
+
+void gather32(const uint32_t* dictionary, const int32_t* indices, int num_values,
+              uint32_t* out) {
+  static const Gather32Func func = ResolveGather32();
+  func(dictionary, indices, num_values, out);
+}
+
+void gather64(const uint64_t* dictionary, const int32_t* indices, int num_values,
+              uint64_t* out) {
+  static const Gather64Func func = ResolveGather64();
+  func(dictionary, indices, num_values, out);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -28,6 +28,7 @@
 #define ARROW_UTIL_BPACKING_H
 
 #include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace internal {
@@ -3191,7 +3192,9 @@ inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
   return in;
 }
 
-inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+/// \brief Scalar bit unpacking of batch_size / 32 * 32 values of width num_bits
+inline int unpack32_default(const uint32_t* in, uint32_t* out, int batch_size,
+                            int num_bits) {
   batch_size = batch_size / 32 * 32;
   int num_loops = batch_size / 32;
 
@@ -3302,6 +3305,33 @@ inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_b
   return batch_size;
 }
 
+/// \brief Unpack batch_size / 32 * 32 values of width num_bits using the fastest
+/// implementation supported by the host CPU. Returns the number of values unpacked
+ARROW_EXPORT int unpack32(const uint32_t* in, uint32_t* out, int batch_size,
+                          int num_bits);
+
+/// \brief Gather out[i] = dictionary[indices[i]] for 4-byte values, using SIMD
+/// gathers when supported by the host CPU
+ARROW_EXPORT void gather32(const uint32_t* dictionary, const int32_t* indices,
+                           int num_values, uint32_t* out);
+
+/// \brief Gather out[i] = dictionary[indices[i]] for 8-byte values, using SIMD
+/// gathers when supported by the host CPU
+ARROW_EXPORT void gather64(const uint64_t* dictionary, const int32_t* indices,
+                           int num_values, uint64_t* out);
+
+// Explicit SIMD variants, exposed for testing and benchmarking. The caller is
+// responsible for checking CpuInfo before calling them.
+#ifdef ARROW_HAVE_AVX2
+ARROW_EXPORT int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size,
+                               int num_bits);
+#endif
+
+#ifdef ARROW_HAVE_AVX512
+ARROW_EXPORT int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size,
+                                 int num_bits);
+#endif
+
 }  // namespace internal
 }  // namespace arrow
 
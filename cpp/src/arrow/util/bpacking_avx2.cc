@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// AVX2 bit unpacking and dictionary gather kernels. This file is compiled with
+// -mavx2, so it must not include headers with inline functions that may also be
+// instantiated by translation units compiled for the baseline instruction set.
+
+#include "arrow/util/bpacking_simd.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace internal {
+namespace detail {
+
+namespace {
+
+// Bit offset of lane j within a group of 8 packed values
+constexpr int LaneBit(int num_bits, int lane) { return lane * num_bits; }
+
+// Index of the 32-bit word holding the low bits of lane j
+constexpr int LowWord(int num_bits, int lane) { return LaneBit(num_bits, lane) / 32; }
+
+// Index of the 32-bit word holding the bits of lane j that straddle into the
+// next word, if any
+constexpr int HighWord(int num_bits, int lane) {
+  return LowWord(num_bits, lane) < 7 ? LowWord(num_bits, lane) + 1 : 7;
+}
+
+constexpr int RightShift(int num_bits, int lane) { return LaneBit(num_bits, lane) % 32; }
+
+// A left shift by 32 yields zero with the AVX2 variable shifts, which is what we
+// want for lanes that do not straddle two words
+constexpr int LeftShift(int num_bits, int lane) {
+  return 32 - RightShift(num_bits, lane);
+}
+
+#define LANES_8(FUNC, BITS)                                                    \
+  FUNC(BITS, 0), FUNC(BITS, 1), FUNC(BITS, 2), FUNC(BITS, 3), FUNC(BITS, 4), \
+      FUNC(BITS, 5), FUNC(BITS, 6), FUNC(BITS, 7)
+
+// A block of 32 values of width kNumBits occupies kNumBits 32-bit words and is
+// unpacked as 4 groups of 8 values. Each group starts on a byte boundary
+// (kNumBits bytes after the previous one) and spans at most 32 bytes, so it can
+// be decoded from a single unaligned 256-bit load by permuting the words each
+// lane needs and shifting them into place.
+template <int kNumBits>
+int UnpackBlocks(const uint32_t* in, uint32_t* out, int num_blocks) {
+  const uint32_t kMask = kNumBits == 32 ? 0xFFFFFFFFU : ((1U << kNumBits) - 1);
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>(kMask));
+  const __m256i low_index = _mm256_setr_epi32(LANES_8(LowWord, kNumBits));
+  const __m256i high_index = _mm256_setr_epi32(LANES_8(HighWord, kNumBits));
+  const __m256i right_shift = _mm256_setr_epi32(LANES_8(RightShift, kNumBits));
+  const __m256i left_shift = _mm256_setr_epi32(LANES_8(LeftShift, kNumBits));
+
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(in);
+  const int64_t block_bytes = 4 * kNumBits;
+  const int64_t total_bytes = block_bytes * num_blocks;
+
+  int block = 0;
+  // The last group of a block is loaded at byte offset 3 * kNumBits, make sure
+  // that the 32-byte load stays within the input
+  for (; block < num_blocks && block * block_bytes + 3 * kNumBits + 32 <= total_bytes;
+       ++block) {
+    const uint8_t* block_in = bytes + block * block_bytes;
+    uint32_t* block_out = out + block * 32;
+    for (int group = 0; group < 4; ++group) {
+      const __m256i words = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(block_in + group * kNumBits));
+      const __m256i low = _mm256_permutevar8x32_epi32(words, low_index);
+      const __m256i high = _mm256_permutevar8x32_epi32(words, high_index);
+      const __m256i values =
+          _mm256_and_si256(_mm256_or_si256(_mm256_srlv_epi32(low, right_shift),
+                                           _mm256_sllv_epi32(high, left_shift)),
+                           mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(block_out + group * 8), values);
+    }
+  }
+  return block;
+}
+
+#undef LANES_8
+
+}  // namespace
+
+#define UNPACK_CASE(BITS) \
+  case BITS:              \
+    return UnpackBlocks<BITS>(in, out, num_blocks);
+
+int unpack32_blocks_avx2(const uint32_t* in, uint32_t* out, int num_blocks,
+                         int num_bits) {
+  switch (num_bits) {
+    UNPACK_CASE(1)
+    UNPACK_CASE(2)
+    UNPACK_CASE(3)
+    UNPACK_CASE(4)
+    UNPACK_CASE(5)
+    UNPACK_CASE(6)
+    UNPACK_CASE(7)
+    UNPACK_CASE(8)
+    UNPACK_CASE(9)
+    UNPACK_CASE(10)
+    UNPACK_CASE(11)
+    UNPACK_CASE(12)
+    UNPACK_CASE(13)
+    UNPACK_CASE(14)
+    UNPACK_CASE(15)
+    UNPACK_CASE(16)
+    UNPACK_CASE(17)
+    UNPACK_CASE(18)
+    UNPACK_CASE(19)
+    UNPACK_CASE(20)
+    UNPACK_CASE(21)
+    UNPACK_CASE(22)
+    UNPACK_CASE(23)
+    UNPACK_CASE(24)
+    UNPACK_CASE(25)
+    UNPACK_CASE(26)
+    UNPACK_CASE(27)
+    UNPACK_CASE(28)
+    UNPACK_CASE(29)
+    UNPACK_CASE(30)
+    UNPACK_CASE(31)
+    UNPACK_CASE(32)
+    default:
+      return 0;
+  }
+}
+
+#undef UNPACK_CASE
+
+void gather32_avx2(const uint32_t* dictionary, const int32_t* indices, int num_values,
+                   uint32_t* out) {
+  const int* base = reinterpret_cast<const int*>(dictionary);
+  int i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    const __m256i index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi32(base, index, 4));
+  }
+  for (; i < num_values; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+void gather64_avx2(const uint64_t* dictionary, const int32_t* indices, int num_values,
+                   uint64_t* out) {
+  const long long* base = reinterpret_cast<const long long*>(dictionary);  // NOLINT
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    const __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_i32gather_epi64(base, index, 8));
+  }
+  for (; i < num_values; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+}  // namespace detail
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// AVX-512 bit unpacking and dictionary gather kernels. This file is compiled
+// with -mavx512f, so it must not include headers with inline functions that may
+// also be instantiated by translation units compiled for the baseline
+// instruction set.
+
+#include "arrow/util/bpacking_simd.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace internal {
+namespace detail {
+
+namespace {
+
+constexpr int LaneBit(int num_bits, int lane) { return lane * num_bits; }
+
+constexpr int LowWord(int num_bits, int lane) { return LaneBit(num_bits, lane) / 32; }
+
+constexpr int HighWord(int num_bits, int lane) {
+  return LowWord(num_bits, lane) < 15 ? LowWord(num_bits, lane) + 1 : 15;
+}
+
+constexpr int RightShift(int num_bits, int lane) { return LaneBit(num_bits, lane) % 32; }
+
+constexpr int LeftShift(int num_bits, int lane) {
+  return 32 - RightShift(num_bits, lane);
+}
+
+// Lanes in reverse order, as expected by _mm512_set_epi32 (_mm512_setr_epi32 is
+// not available with all compilers)
+#define LANES_16_REVERSED(FUNC, BITS)                                              \
+  FUNC(BITS, 15), FUNC(BITS, 14), FUNC(BITS, 13), FUNC(BITS, 12), FUNC(BITS, 11), \
+      FUNC(BITS, 10), FUNC(BITS, 9), FUNC(BITS, 8), FUNC(BITS, 7), FUNC(BITS, 6), \
+      FUNC(BITS, 5), FUNC(BITS, 4), FUNC(BITS, 3), FUNC(BITS, 2), FUNC(BITS, 1),  \
+      FUNC(BITS, 0)
+
+// Same scheme as the AVX2 kernel, with 2 groups of 16 values per block of 32.
+// Each group starts 2 * kNumBits bytes after the previous one and spans at most
+// 64 bytes.
+template <int kNumBits>
+int UnpackBlocks(const uint32_t* in, uint32_t* out, int num_blocks) {
+  const uint32_t kMask = kNumBits == 32 ? 0xFFFFFFFFU : ((1U << kNumBits) - 1);
+  const __m512i mask = _mm512_set1_epi32(static_cast<int>(kMask));
+  const __m512i low_index = _mm512_set_epi32(LANES_16_REVERSED(LowWord, kNumBits));
+  const __m512i high_index = _mm512_set_epi32(LANES_16_REVERSED(HighWord, kNumBits));
+  const __m512i right_shift = _mm512_set_epi32(LANES_16_REVERSED(RightShift, kNumBits));
+  const __m512i left_shift = _mm512_set_epi32(LANES_16_REVERSED(LeftShift, kNumBits));
+
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(in);
+  const int64_t block_bytes = 4 * kNumBits;
+  const int64_t total_bytes = block_bytes * num_blocks;
+
+  int block = 0;
+  for (; block < num_blocks && block * block_bytes + 2 * kNumBits + 64 <= total_bytes;
+       ++block) {
+    const uint8_t* block_in = bytes + block * block_bytes;
+    uint32_t* block_out = out + block * 32;
+    for (int group = 0; group < 2; ++group) {
+      const __m512i words = _mm512_loadu_si512(block_in + group * 2 * kNumBits);
+      const __m512i low = _mm512_permutexvar_epi32(low_index, words);
+      const __m512i high = _mm512_permutexvar_epi32(high_index, words);
+      const __m512i values =
+          _mm512_and_si512(_mm512_or_si512(_mm512_srlv_epi32(low, right_shift),
+                                           _mm512_sllv_epi32(high, left_shift)),
+                           mask);
+      _mm512_storeu_si512(block_out + group * 16, values);
+    }
+  }
+  return block;
+}
+
+#undef LANES_16_REVERSED
+
+}  // namespace
+
+#define UNPACK_CASE(BITS) \
+  case BITS:              \
+    return UnpackBlocks<BITS>(in, out, num_blocks);
+
+int unpack32_blocks_avx512(const uint32_t* in, uint32_t* out, int num_blocks,
+                           int num_bits) {
+  switch (num_bits) {
+    UNPACK_CASE(1)
+    UNPACK_CASE(2)
+    UNPACK_CASE(3)
+    UNPACK_CASE(4)
+    UNPACK_CASE(5)
+    UNPACK_CASE(6)
+    UNPACK_CASE(7)
+    UNPACK_CASE(8)
+    UNPACK_CASE(9)
+    UNPACK_CASE(10)
+    UNPACK_CASE(11)
+    UNPACK_CASE(12)
+    UNPACK_CASE(13)
+    UNPACK_CASE(14)
+    UNPACK_CASE(15)
+    UNPACK_CASE(16)
+    UNPACK_CASE(17)
+    UNPACK_CASE(18)
+    UNPACK_CASE(19)
+    UNPACK_CASE(20)
+    UNPACK_CASE(21)
+    UNPACK_CASE(22)
+    UNPACK_CASE(23)
+    UNPACK_CASE(24)
+    UNPACK_CASE(25)
+    UNPACK_CASE(26)
+    UNPACK_CASE(27)
+    UNPACK_CASE(28)
+    UNPACK_CASE(29)
+    UNPACK_CASE(30)
+    UNPACK_CASE(31)
+    UNPACK_CASE(32)
+    default:
+      return 0;
+  }
+}
+
+#undef UNPACK_CASE
+
+void gather32_avx512(const uint32_t* dictionary, const int32_t* indices,
+                     int num_values, uint32_t* out) {
+  int i = 0;
+  for (; i + 16 <= num_values; i += 16) {
+    const __m512i index = _mm512_loadu_si512(indices + i);
+    _mm512_storeu_si512(out + i, _mm512_i32gather_epi32(index, dictionary, 4));
+  }
+  for (; i < num_values; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+void gather64_avx512(const uint64_t* dictionary, const int32_t* indices,
+                     int num_values, uint64_t* out) {
+  int i = 0;
+  for (; i + 8 <= num_values; i += 8) {
+    const __m256i index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    _mm512_storeu_si512(out + i, _mm512_i32gather_epi64(index, dictionary, 8));
+  }
+  for (; i < num_values; ++i) {
+    out[i] = dictionary[indices[i]];
+  }
+}
+
+}  // namespace detail
+}  // namespace internal
+}  // namespace arrow
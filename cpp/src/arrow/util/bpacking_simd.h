@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Declarations of the SIMD bit unpacking and dictionary gather kernels. Each
+// kernel lives in its own translation unit compiled with the matching
+// instruction set flags, so it must only be called after checking CpuInfo.
+// Use the dispatching functions in bpacking.h instead of including this header.
+
+#ifndef ARROW_UTIL_BPACKING_SIMD_H
+#define ARROW_UTIL_BPACKING_SIMD_H
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+namespace detail {
+
+#ifdef ARROW_HAVE_AVX2
+/// \brief Unpack up to num_blocks blocks of 32 values of width num_bits (1 to
+/// 32), never reading past the end of the num_blocks * num_bits input words.
+/// Returns the number of blocks unpacked; the remaining ones are left to the
+/// scalar implementation.
+int unpack32_blocks_avx2(const uint32_t* in, uint32_t* out, int num_blocks,
+                         int num_bits);
+
+void gather32_avx2(const uint32_t* dictionary, const int32_t* indices, int num_values,
+                   uint32_t* out);
+
+void gather64_avx2(const uint64_t* dictionary, const int32_t* indices, int num_values,
+                   uint64_t* out);
+#endif
+
+#ifdef ARROW_HAVE_AVX512
+int unpack32_blocks_avx512(const uint32_t* in, uint32_t* out, int num_blocks,
+                           int num_bits);
+
+void gather32_avx512(const uint32_t* dictionary, const int32_t* indices,
+                     int num_values, uint32_t* out);
+
+void gather64_avx512(const uint64_t* dictionary, const int32_t* indices,
+                     int num_values, uint64_t* out);
+#endif
+
+}  // namespace detail
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BPACKING_SIMD_H
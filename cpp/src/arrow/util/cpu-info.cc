@@ -65,6 +65,8 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
+    {"avx512f", CpuInfo::AVX512},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -139,7 +141,9 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   const int register_ECX_id = 1;
   int highest_valid_id = 0;
   int highest_extended_valid_id = 0;
+  const int register_extended_features_id = 7;
   std::bitset<32> features_ECX;
+  std::bitset<32> features_EBX;
   std::array<int, 4> cpu_info;
 
   // Get highest valid id
@@ -151,6 +155,12 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  // Extended features (AVX2, AVX-512) are reported in EBX of leaf 7
+  if (highest_valid_id >= register_extended_features_id) {
+    __cpuidex(cpu_info.data(), register_extended_features_id, 0);
+    features_EBX = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -169,6 +179,8 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+  if (features_EBX[16]) *hardware_flags |= CpuInfo::AVX512;
   return true;
 }
 #endif
@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+namespace internal {
+
+template <class Integer>
+static std::vector<Integer> MakeIntegers(int32_t n_values, int32_t cardinality) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int32_t> value_dist(0, cardinality - 1);
+
+  std::vector<Integer> values;
+  values.reserve(n_values);
+  for (int32_t i = 0; i < n_values; ++i) {
+    // Spread the distinct values over the whole range of the type
+    values.push_back(static_cast<Integer>(value_dist(gen)) *
+                     static_cast<Integer>(0x9E3779B97F4A7C15ULL));
+  }
+  return values;
+}
+
+static std::vector<std::string> MakeStrings(int32_t n_values, int32_t cardinality,
+                                            int32_t min_length, int32_t max_length) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int32_t> length_dist(min_length, max_length);
+  std::uniform_int_distribution<int32_t> char_dist('A', 'z');
+
+  std::vector<std::string> uniques;
+  uniques.reserve(cardinality);
+  for (int32_t i = 0; i < cardinality; ++i) {
+    std::string s(static_cast<size_t>(length_dist(gen)), 'x');
+    for (auto& c : s) {
+      c = static_cast<char>(char_dist(gen));
+    }
+    uniques.push_back(std::move(s));
+  }
+
+  std::uniform_int_distribution<int32_t> index_dist(0, cardinality - 1);
+  std::vector<std::string> values;
+  values.reserve(n_values);
+  for (int32_t i = 0; i < n_values; ++i) {
+    values.push_back(uniques[index_dist(gen)]);
+  }
+  return values;
+}
+
+static void BM_HashIntegers(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values = MakeIntegers<int64_t>(10000, 10000);
+
+  while (state.KeepRunning()) {
+    hash_t total = 0;
+    for (const int64_t v : values) {
+      total += ComputeIntegerHash(v);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_HashSmallStrings(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string> values = MakeStrings(10000, 10000, 2, 20);
+  int64_t total_size = 0;
+  for (const auto& v : values) {
+    total_size += static_cast<int64_t>(v.size());
+  }
+
+  while (state.KeepRunning()) {
+    hash_t total = 0;
+    for (const auto& v : values) {
+      total += ComputeStringHash(v.data(), static_cast<int64_t>(v.size()));
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// The cardinality is the first argument
+static void BM_MemoTableInt64(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int64_t> values =
+      MakeIntegers<int64_t>(100000, static_cast<int32_t>(state.range(0)));
+
+  while (state.KeepRunning()) {
+    ScalarMemoTable<int64_t> table(default_memory_pool());
+    for (const int64_t v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_MemoTableInt8(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<int8_t> values = MakeIntegers<int8_t>(100000, 256);
+
+  while (state.KeepRunning()) {
+    SmallScalarMemoTable<int8_t> table(default_memory_pool());
+    for (const int8_t v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int8_t));
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// The cardinality and the maximum string length are the arguments
+static void BM_MemoTableString(benchmark::State& state) {  // NOLINT non-const reference
+  const std::vector<std::string> values =
+      MakeStrings(100000, static_cast<int32_t>(state.range(0)), 2,
+                  static_cast<int32_t>(state.range(1)));
+  int64_t total_size = 0;
+  for (const auto& v : values) {
+    total_size += static_cast<int64_t>(v.size());
+  }
+
+  while (state.KeepRunning()) {
+    BinaryMemoTable table(default_memory_pool());
+    for (const auto& v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetBytesProcessed(state.iterations() * total_size);
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK(BM_HashIntegers)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_HashSmallStrings)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_MemoTableInt64)
+    ->Arg(100)
+    ->Arg(100000)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_MemoTableInt8)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_MemoTableString)
+    ->Args({100, 20})
+    ->Args({100, 200})
+    ->Args({100000, 20})
+    ->Args({100000, 200})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,360 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+#include "arrow/test-util.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+namespace internal {
+
+template <typename Integer>
+static std::unordered_set<Integer> MakeDistinctIntegers(int32_t n_values) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<Integer> values_dist(0,
+                                                     std::numeric_limits<Integer>::max());
+
+  std::unordered_set<Integer> values;
+  values.reserve(n_values);
+
+  while (values.size() < static_cast<uint32_t>(n_values)) {
+    values.insert(static_cast<Integer>(values_dist(gen)));
+  }
+  return values;
+}
+
+template <typename T>
+static void AssertGet(const ScalarMemoTable<T>& table, T value, int32_t expected) {
+  ASSERT_EQ(table.Get(value), expected);
+}
+
+template <typename MemoTableType, typename Value>
+static void AssertGetOrInsert(MemoTableType& table, const Value& value,
+                              int32_t expected) {
+  int32_t memo_index = -1;
+  ASSERT_OK(table.GetOrInsert(value, &memo_index));
+  ASSERT_EQ(memo_index, expected);
+}
+
+TEST(HashTable, Lookup) {
+  HashTable<int32_t> table(default_memory_pool());
+  const auto cmp_func = [](const int32_t* payload) { return *payload == 42; };
+
+  auto p = table.Lookup(1234, cmp_func);
+  ASSERT_FALSE(p.second);
+  ASSERT_OK(table.Insert(p.first, 1234, 42));
+  ASSERT_EQ(table.size(), 1U);
+
+  p = table.Lookup(1234, cmp_func);
+  ASSERT_TRUE(p.second);
+  ASSERT_EQ(p.first->h, 1234U);
+  ASSERT_EQ(p.first->payload, 42);
+
+  // Same hash, different key
+  p = table.Lookup(1234, [](const int32_t* payload) { return *payload == 43; });
+  ASSERT_FALSE(p.second);
+}
+
+TEST(HashTable, CollidingHashes) {
+  // All the hashes have the same low bits and control byte, so that all the
+  // entries compete for the same groups.
+  HashTable<int32_t> table(default_memory_pool());
+  const int32_t n_values = 1000;
+  for (int32_t i = 0; i < n_values; ++i) {
+    const hash_t h = static_cast<hash_t>(i) << 32;
+    auto p = table.Lookup(h, [i](const int32_t* payload) { return *payload == i; });
+    ASSERT_FALSE(p.second);
+    ASSERT_OK(table.Insert(p.first, h, i));
+  }
+  ASSERT_EQ(table.size(), static_cast<uint64_t>(n_values));
+  ASSERT_GE(table.capacity() * 7, table.size() * 8);
+  for (int32_t i = 0; i < n_values; ++i) {
+    const hash_t h = static_cast<hash_t>(i) << 32;
+    auto p = table.Lookup(h, [i](const int32_t* payload) { return *payload == i; });
+    ASSERT_TRUE(p.second);
+    ASSERT_EQ(p.first->payload, i);
+  }
+
+  int64_t n_visited = 0;
+  table.VisitEntries([&](const HashTable<int32_t>::Entry*) { ++n_visited; });
+  ASSERT_EQ(n_visited, n_values);
+}
+
+TEST(HashTable, MemoryPool) {
+  ProxyMemoryPool pool(default_memory_pool());
+  {
+    HashTable<int32_t> table(&pool, 1000);
+    // The slots are allocated on the first insertion
+    ASSERT_EQ(pool.bytes_allocated(), 0);
+    for (int32_t i = 0; i < 1000; ++i) {
+      const hash_t h = ComputeStringHash(&i, sizeof(i));
+      auto p = table.Lookup(h, [i](const int32_t* payload) { return *payload == i; });
+      ASSERT_FALSE(p.second);
+      ASSERT_OK(table.Insert(p.first, h, i));
+    }
+    // All the entries fit in the slots asked for at construction
+    ASSERT_EQ(table.capacity(), 2048U);
+    ASSERT_GE(pool.bytes_allocated(),
+              static_cast<int64_t>(table.capacity() * sizeof(HashTable<int32_t>::Entry)));
+  }
+  ASSERT_EQ(pool.bytes_allocated(), 0);
+}
+
+TEST(ScalarMemoTable, Int64) {
+  const int64_t A = 1234, B = 0, C = -98765321, D = 12345678901234LL, E = -1, F = 1,
+                G = 9223372036854775807LL, H = -9223372036854775807LL - 1;
+
+  ScalarMemoTable<int64_t> table(default_memory_pool());
+  ASSERT_EQ(table.size(), 0);
+  AssertGet(table, A, kKeyNotFound);
+  AssertGetOrInsert(table, A, 0);
+  AssertGet(table, B, kKeyNotFound);
+  AssertGetOrInsert(table, B, 1);
+  AssertGetOrInsert(table, C, 2);
+  AssertGetOrInsert(table, D, 3);
+  AssertGetOrInsert(table, E, 4);
+
+  AssertGet(table, A, 0);
+  AssertGetOrInsert(table, A, 0);
+  AssertGet(table, E, 4);
+  AssertGetOrInsert(table, E, 4);
+
+  AssertGetOrInsert(table, F, 5);
+  AssertGetOrInsert(table, G, 6);
+  AssertGetOrInsert(table, H, 7);
+
+  AssertGetOrInsert(table, G, 6);
+  AssertGetOrInsert(table, F, 5);
+
+  ASSERT_EQ(table.size(), 8);
+  std::vector<int64_t> values(table.size());
+  table.CopyValues(values.data());
+  ASSERT_EQ(values, std::vector<int64_t>({A, B, C, D, E, F, G, H}));
+
+  values.resize(3);
+  table.CopyValues(5, values.data());
+  ASSERT_EQ(values, std::vector<int64_t>({F, G, H}));
+}
+
+TEST(ScalarMemoTable, Callbacks) {
+  ScalarMemoTable<int32_t> table(default_memory_pool());
+  int32_t found = -1, not_found = -1;
+  auto on_found = [&](int32_t memo_index) { found = memo_index; };
+  auto on_not_found = [&](int32_t memo_index) { not_found = memo_index; };
+
+  int32_t memo_index;
+  ASSERT_OK(table.GetOrInsert(42, on_found, on_not_found, &memo_index));
+  ASSERT_EQ(memo_index, 0);
+  ASSERT_EQ(found, -1);
+  ASSERT_EQ(not_found, 0);
+  ASSERT_OK(table.GetOrInsert(43, on_found, on_not_found, &memo_index));
+  ASSERT_EQ(memo_index, 1);
+  ASSERT_EQ(not_found, 1);
+  ASSERT_OK(table.GetOrInsert(42, on_found, on_not_found, &memo_index));
+  ASSERT_EQ(memo_index, 0);
+  ASSERT_EQ(found, 0);
+}
+
+TEST(ScalarMemoTable, StressInt64) {
+  const int32_t n_values = 15000;
+  const int32_t n_repeats = 4;
+
+  auto values = MakeDistinctIntegers<int64_t>(n_values);
+  ScalarMemoTable<int64_t> table(default_memory_pool());
+
+  std::vector<int64_t> expected;
+  for (int32_t j = 0; j < n_repeats; ++j) {
+    int32_t expected_index = 0;
+    for (const int64_t value : values) {
+      AssertGetOrInsert(table, value, expected_index);
+      if (j == 0) {
+        expected.push_back(value);
+      }
+      ++expected_index;
+    }
+  }
+  ASSERT_EQ(table.size(), n_values);
+
+  std::vector<int64_t> actual(table.size());
+  table.CopyValues(actual.data());
+  ASSERT_EQ(actual, expected);
+}
+
+TEST(ScalarMemoTable, Double) {
+  const double A = 0.0, B = 1.5, C = -0.0, D = std::numeric_limits<double>::infinity(),
+               E = -D, F = std::nan("");
+
+  ScalarMemoTable<double> table(default_memory_pool());
+  AssertGetOrInsert(table, A, 0);
+  AssertGetOrInsert(table, B, 1);
+  // 0.0 and -0.0 are different values
+  AssertGetOrInsert(table, C, 2);
+  AssertGetOrInsert(table, D, 3);
+  AssertGetOrInsert(table, E, 4);
+  AssertGetOrInsert(table, F, 5);
+
+  // All the NaNs are the same value
+  AssertGet(table, -F, 5);
+  AssertGet(table, std::numeric_limits<double>::quiet_NaN(), 5);
+  AssertGet(table, std::numeric_limits<double>::signaling_NaN(), 5);
+  AssertGet(table, 0.0, 0);
+  AssertGet(table, -0.0, 2);
+
+  ASSERT_EQ(table.size(), 6);
+}
+
+TEST(SmallScalarMemoTable, Int8) {
+  const int8_t A = 1, B = 0, C = -1, D = -128, E = 127;
+
+  SmallScalarMemoTable<int8_t> table(default_memory_pool());
+  ASSERT_EQ(table.Get(A), kKeyNotFound);
+  AssertGetOrInsert(table, A, 0);
+  AssertGetOrInsert(table, B, 1);
+  AssertGetOrInsert(table, C, 2);
+  AssertGetOrInsert(table, D, 3);
+  AssertGetOrInsert(table, E, 4);
+  AssertGetOrInsert(table, C, 2);
+  ASSERT_EQ(table.Get(D), 3);
+
+  ASSERT_EQ(table.size(), 5);
+  std::vector<int8_t> values(table.size());
+  table.CopyValues(values.data());
+  ASSERT_EQ(values, std::vector<int8_t>({A, B, C, D, E}));
+}
+
+TEST(SmallScalarMemoTable, Bool) {
+  SmallScalarMemoTable<bool> table(default_memory_pool());
+  ASSERT_EQ(table.Get(true), kKeyNotFound);
+  AssertGetOrInsert(table, true, 0);
+  AssertGetOrInsert(table, false, 1);
+  AssertGetOrInsert(table, true, 0);
+  ASSERT_EQ(table.size(), 2);
+  ASSERT_EQ(table.value(0), true);
+  ASSERT_EQ(table.value(1), false);
+}
+
+TEST(BinaryMemoTable, Basics) {
+  std::string A = "", B = "a", C = "foo", D = "bar", E, F;
+  E += '\0';
+  F += '\0';
+  F += "trailing";
+
+  BinaryMemoTable table(default_memory_pool());
+  ASSERT_EQ(table.size(), 0);
+  ASSERT_EQ(table.Get(A), kKeyNotFound);
+  AssertGetOrInsert(table, A, 0);
+  ASSERT_EQ(table.Get(B), kKeyNotFound);
+  AssertGetOrInsert(table, B, 1);
+  AssertGetOrInsert(table, C, 2);
+  AssertGetOrInsert(table, D, 3);
+  AssertGetOrInsert(table, E, 4);
+  AssertGetOrInsert(table, F, 5);
+
+  AssertGetOrInsert(table, A, 0);
+  AssertGetOrInsert(table, E, 4);
+  ASSERT_EQ(table.Get(C), 2);
+  ASSERT_EQ(table.Get(F), 5);
+
+  ASSERT_EQ(table.size(), 6);
+  ASSERT_EQ(table.values_size(), 17);
+
+  {
+    std::vector<int32_t> offsets(table.size() + 1);
+    table.CopyOffsets(offsets.data());
+    ASSERT_EQ(offsets, std::vector<int32_t>({0, 0, 1, 4, 7, 8, 17}));
+
+    std::string expected_values;
+    expected_values += "afoobar";
+    expected_values += '\0';
+    expected_values += '\0';
+    expected_values += "trailing";
+    std::string values(17, 'X');
+    table.CopyValues(reinterpret_cast<uint8_t*>(&values[0]));
+    ASSERT_EQ(values, expected_values);
+  }
+  {
+    // The values from index 2 on
+    std::vector<int32_t> offsets(table.size() - 1);
+    table.CopyOffsets(2, offsets.data());
+    ASSERT_EQ(offsets, std::vector<int32_t>({0, 3, 6, 7, 16}));
+
+    ASSERT_EQ(table.values_size(2), 16);
+    std::string values(16, 'X');
+    table.CopyValues(2, reinterpret_cast<uint8_t*>(&values[0]));
+    ASSERT_EQ(values.substr(0, 6), "foobar");
+
+    std::vector<std::string> visited;
+    table.VisitValues(2, [&](const uint8_t* data, int32_t length) {
+      visited.emplace_back(reinterpret_cast<const char*>(data), length);
+    });
+    ASSERT_EQ(visited, std::vector<std::string>({C, D, E, F}));
+  }
+}
+
+TEST(BinaryMemoTable, MemoryPool) {
+  ProxyMemoryPool pool(default_memory_pool());
+  {
+    BinaryMemoTable table(&pool);
+    ASSERT_EQ(pool.bytes_allocated(), 0);
+    const std::string value(1000, 'x');
+    AssertGetOrInsert(table, value, 0);
+    AssertGetOrInsert(table, value.substr(1), 1);
+    ASSERT_GE(pool.bytes_allocated(), 2 * 1000 - 1);
+  }
+  ASSERT_EQ(pool.bytes_allocated(), 0);
+}
+
+TEST(BinaryMemoTable, Stress) {
+  const int32_t n_values = 20000;
+  const int32_t n_repeats = 10;
+  // Repeat each value n_repeats times
+  const int32_t n_total = n_values * n_repeats;
+
+  std::vector<std::string> values;
+  for (int32_t i = 0; i < n_values; ++i) {
+    values.push_back(std::to_string(i * 7919) + "-" + std::string(i % 40, 'x'));
+  }
+
+  BinaryMemoTable table(default_memory_pool());
+  int64_t values_size = 0;
+  for (int32_t i = 0; i < n_total; ++i) {
+    const std::string& value = values[i % n_values];
+    const int32_t expected = i % n_values;
+    AssertGetOrInsert(table, value, expected);
+    if (i < n_values) {
+      values_size += static_cast<int64_t>(value.size());
+    }
+  }
+  ASSERT_EQ(table.size(), n_values);
+  ASSERT_EQ(table.values_size(), values_size);
+  for (int32_t i = 0; i < n_values; ++i) {
+    ASSERT_EQ(table.Get(values[i]), i);
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
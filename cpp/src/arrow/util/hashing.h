@@ -0,0 +1,728 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Private header, not to be exported
+
+#ifndef ARROW_UTIL_HASHING_H
+#define ARROW_UTIL_HASHING_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/hash-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+#ifdef ARROW_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace arrow {
+namespace internal {
+
+typedef uint64_t hash_t;
+
+// ----------------------------------------------------------------------
+// Hash functions
+//
+// The hash table takes the index of the first probed group from the low bits
+// of the hashes, and the control byte of each entry from their 7 high bits, so
+// both ends of the hashes must depend on all the bits of the values.
+
+/// \brief Hash an arbitrary byte string.
+inline hash_t ComputeStringHash(const void* data, int64_t length) {
+  return HashUtil::MurmurHash2_64(data, static_cast<int>(length), 0);
+}
+
+/// \brief Hash an integer of at most 64 bits.
+inline hash_t ComputeIntegerHash(uint64_t value) {
+  // Multiplying by an odd constant (2^64 / golden ratio) mixes the low bits of
+  // the value into the high bits of the product, which are then folded into its
+  // low bits.
+  const hash_t h = value * 0x9E3779B97F4A7C15ULL;
+  return h ^ (h >> 32);
+}
+
+template <typename Scalar, typename Enable = void>
+struct ScalarHelper {
+  static bool CompareScalars(const Scalar& u, const Scalar& v) { return u == v; }
+
+  static hash_t ComputeHash(const Scalar& value) {
+    // Hash the bit representation of the value.
+    return ComputeStringHash(&value, sizeof(value));
+  }
+};
+
+template <typename Scalar>
+struct ScalarHelper<Scalar,
+                    typename std::enable_if<std::is_integral<Scalar>::value>::type> {
+  static bool CompareScalars(Scalar u, Scalar v) { return u == v; }
+
+  static hash_t ComputeHash(Scalar value) {
+    return ComputeIntegerHash(static_cast<uint64_t>(value));
+  }
+};
+
+template <typename Scalar>
+struct ScalarHelper<
+    Scalar, typename std::enable_if<std::is_floating_point<Scalar>::value>::type> {
+  using Bits = typename std::conditional<sizeof(Scalar) == 4, uint32_t, uint64_t>::type;
+
+  // All the NaNs are equal, and 0.0 and -0.0 are different, so that equal
+  // values have equal bit representations.
+  static bool CompareScalars(Scalar u, Scalar v) {
+    if (std::isnan(u)) {
+      return std::isnan(v);
+    }
+    return ToBits(u) == ToBits(v);
+  }
+
+  static hash_t ComputeHash(Scalar value) {
+    if (std::isnan(value)) {
+      value = std::numeric_limits<Scalar>::quiet_NaN();
+    }
+    return ComputeIntegerHash(ToBits(value));
+  }
+
+  static Bits ToBits(Scalar value) {
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(value));
+    return bits;
+  }
+};
+
+// ----------------------------------------------------------------------
+// An open-addressing hash table with SIMD probing of control bytes
+
+/// \brief Hash table from hashes to payloads, which never removes entries.
+///
+/// The slots are split into groups of kGroupSize. Each slot has a control byte,
+/// which is kEmpty or the 7 high bits of the hash of its entry, so that a single
+/// SIMD comparison finds the candidate slots of a whole group. The entries keep
+/// their full hash, which is compared before the keys: mismatching keys are
+/// seldom compared, and the table is resized without hashing the keys again.
+///
+/// A lookup probes the groups in a triangular sequence, which visits all of them,
+/// until a group has an empty slot. The table is grown once it is 7/8 full.
+///
+/// The slots are allocated from a MemoryPool on the first insertion, so that
+/// all the allocation failures are reported by Insert(). The payloads must be
+/// trivially copyable.
+template <typename Payload>
+class HashTable {
+ public:
+  static constexpr int kGroupSize = 16;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+  };
+
+  /// \param[in] pool the pool allocating the slots.
+  /// \param[in] capacity the number of entries to make room for.
+  explicit HashTable(MemoryPool* pool, int64_t capacity = 0)
+      : pool_(pool),
+        size_(0),
+        capacity_(0),
+        group_mask_(0),
+        controls_(NULLPTR),
+        entries_(NULLPTR) {
+    DCHECK_NE(pool, NULLPTR);
+    const int64_t min_slots = std::max<int64_t>(kGroupSize, capacity + capacity / 7 + 1);
+    initial_capacity_ = static_cast<uint64_t>(BitUtil::NextPower2(min_slots));
+  }
+
+  /// \brief Look up the entry of a hash, for which cmp_func(const Payload*)
+  /// returns true.
+  ///
+  /// \return the entry and true if found. Otherwise the empty entry where the
+  /// payload can be inserted with Insert(), and false.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    if (ARROW_PREDICT_FALSE(capacity_ == 0)) {
+      return {NULLPTR, false};
+    }
+    const uint8_t control = ControlByte(h);
+    uint64_t group = h & group_mask_;
+    uint64_t step = 0;
+    while (true) {
+      const uint64_t base = group * kGroupSize;
+      for (uint32_t matches = MatchGroup(&controls_[base], control); matches != 0;
+           matches &= matches - 1) {
+        Entry* entry = &entries_[base + BitUtil::CountTrailingZeros(matches)];
+        if (entry->h == h && cmp_func(&entry->payload)) {
+          return {entry, true};
+        }
+      }
+      const uint32_t empty = MatchGroup(&controls_[base], kEmpty);
+      if (ARROW_PREDICT_TRUE(empty != 0)) {
+        return {&entries_[base + BitUtil::CountTrailingZeros(empty)], false};
+      }
+      group = (group + ++step) & group_mask_;
+    }
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = const_cast<HashTable*>(this)->Lookup(h, std::forward<CmpFunc>(cmp_func));
+    return {p.first, p.second};
+  }
+
+  /// \brief Insert a payload in the entry returned by an unsuccessful Lookup().
+  /// The pointers to the entries are invalidated. The table is left unchanged
+  /// if it cannot be grown.
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    if (ARROW_PREDICT_FALSE((size_ + 1) * 8 > capacity_ * 7)) {
+      RETURN_NOT_OK(Upsize(capacity_ == 0 ? initial_capacity_ : capacity_ * 2));
+      entry = Lookup(h, [](const Payload*) { return false; }).first;
+    }
+    const uint64_t index = static_cast<uint64_t>(entry - entries_);
+    DCHECK_EQ(controls_[index], kEmpty);
+    controls_[index] = ControlByte(h);
+    entry->h = h;
+    entry->payload = payload;
+    ++size_;
+    return Status::OK();
+  }
+
+  uint64_t size() const { return size_; }
+
+  uint64_t capacity() const { return capacity_; }
+
+  /// \brief Call visit_func(const Entry*) on every entry, in no particular order.
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; ++i) {
+      if (controls_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  static constexpr uint8_t kEmpty = 0x80;
+
+  static uint8_t ControlByte(hash_t h) { return static_cast<uint8_t>(h >> 57); }
+
+  // Return the mask of the slots of the group at 'controls' whose control byte
+  // is 'control'.
+  static uint32_t MatchGroup(const uint8_t* controls, uint8_t control) {
+#ifdef ARROW_USE_SSE
+    const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls));
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(control));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, pattern)));
+#else
+    return MatchWord(controls, control) | (MatchWord(controls + 8, control) << 8);
+#endif
+  }
+
+#ifndef ARROW_USE_SSE
+  // Same as MatchGroup for 8 slots, testing all the bytes of a 64-bit word at
+  // once.
+  static uint32_t MatchWord(const uint8_t* controls, uint8_t control) {
+    constexpr uint64_t kLows = 0x7F7F7F7F7F7F7F7FULL;
+    uint64_t word;
+    std::memcpy(&word, controls, sizeof(word));
+    // The bytes equal to control become zero, whose high bit is then set
+    const uint64_t x =
+        BitUtil::FromLittleEndian(word) ^ (0x0101010101010101ULL * control);
+    const uint64_t zeros = ~(((x & kLows) + kLows) | x | kLows);
+    // Gather the high bits of the 8 bytes into the low 8 bits
+    return static_cast<uint32_t>(((zeros >> 7) * 0x0102040810204080ULL) >> 56);
+  }
+#endif
+
+  Status Upsize(uint64_t new_capacity) {
+    DCHECK_EQ(new_capacity % kGroupSize, 0);
+    std::unique_ptr<Buffer> controls_buffer, entries_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, new_capacity, &controls_buffer));
+    RETURN_NOT_OK(AllocateBuffer(pool_, new_capacity * sizeof(Entry), &entries_buffer));
+    std::memset(controls_buffer->mutable_data(), kEmpty, new_capacity);
+
+    // The old slots are released with the local buffers on return
+    controls_buffer_.swap(controls_buffer);
+    entries_buffer_.swap(entries_buffer);
+    const uint8_t* old_controls = controls_;
+    const Entry* old_entries = entries_;
+    const uint64_t old_capacity = capacity_;
+    controls_ = controls_buffer_->mutable_data();
+    entries_ = reinterpret_cast<Entry*>(entries_buffer_->mutable_data());
+    capacity_ = new_capacity;
+    group_mask_ = new_capacity / kGroupSize - 1;
+
+    for (uint64_t i = 0; i < old_capacity; ++i) {
+      if (old_controls[i] == kEmpty) {
+        continue;
+      }
+      // The entries are distinct, so only an empty slot needs to be found.
+      const Entry& old_entry = old_entries[i];
+      auto p = Lookup(old_entry.h, [](const Payload*) { return false; });
+      controls_[p.first - entries_] = old_controls[i];
+      *p.first = old_entry;
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  uint64_t initial_capacity_;
+  uint64_t size_;
+  uint64_t capacity_;
+  uint64_t group_mask_;
+  std::unique_ptr<Buffer> controls_buffer_;
+  std::unique_ptr<Buffer> entries_buffer_;
+  uint8_t* controls_;
+  Entry* entries_;
+};
+
+template <typename Payload>
+constexpr int HashTable<Payload>::kGroupSize;
+
+template <typename Payload>
+constexpr uint8_t HashTable<Payload>::kEmpty;
+
+// ----------------------------------------------------------------------
+// Memoization tables
+//
+// A memo table assigns consecutive indices to the distinct values it is given,
+// in the order of their first occurrence.
+
+/// The index returned by the Get() methods of the memo tables for a value
+/// which has not been inserted.
+static constexpr int32_t kKeyNotFound = -1;
+
+class MemoTable {
+ public:
+  virtual ~MemoTable() = default;
+
+  /// The number of distinct values.
+  virtual int32_t size() const = 0;
+};
+
+/// \brief Memo table for fixed-width scalars, whose values are stored in the
+/// entries of the hash table.
+template <typename Scalar>
+class ScalarMemoTable : public MemoTable {
+ public:
+  explicit ScalarMemoTable(MemoryPool* pool, int64_t entries = 0)
+      : hash_table_(pool, entries) {}
+
+  int32_t Get(const Scalar& value) const {
+    auto cmp_func = [&value](const Payload* payload) {
+      return ScalarHelper<Scalar>::CompareScalars(payload->value, value);
+    };
+    auto p = hash_table_.Lookup(ScalarHelper<Scalar>::ComputeHash(value), cmp_func);
+    return p.second ? p.first->payload.memo_index : kKeyNotFound;
+  }
+
+  /// \brief Get the index of a value in out_memo_index, inserting it if needed.
+  /// on_found or on_not_found is called with the index, depending on whether
+  /// the value was already present.
+  template <typename Func1, typename Func2>
+  Status GetOrInsert(const Scalar& value, Func1&& on_found, Func2&& on_not_found,
+                     int32_t* out_memo_index) {
+    auto cmp_func = [&value](const Payload* payload) {
+      return ScalarHelper<Scalar>::CompareScalars(payload->value, value);
+    };
+    const hash_t h = ScalarHelper<Scalar>::ComputeHash(value);
+    auto p = hash_table_.Lookup(h, cmp_func);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      RETURN_NOT_OK(hash_table_.Insert(p.first, h, {value, memo_index}));
+      on_not_found(memo_index);
+    }
+    *out_memo_index = memo_index;
+    return Status::OK();
+  }
+
+  Status GetOrInsert(const Scalar& value, int32_t* out_memo_index) {
+    return GetOrInsert(value, [](int32_t) {}, [](int32_t) {}, out_memo_index);
+  }
+
+  int32_t size() const override { return static_cast<int32_t>(hash_table_.size()); }
+
+  /// \brief Copy the values of the indices from 'start' on to out_data.
+  void CopyValues(int32_t start, Scalar* out_data) const {
+    hash_table_.VisitEntries([=](const typename HashTable<Payload>::Entry* entry) {
+      const int32_t index = entry->payload.memo_index - start;
+      if (index >= 0) {
+        out_data[index] = entry->payload.value;
+      }
+    });
+  }
+
+  void CopyValues(Scalar* out_data) const { CopyValues(0, out_data); }
+
+ protected:
+  struct Payload {
+    Scalar value;
+    int32_t memo_index;
+  };
+
+  HashTable<Payload> hash_table_;
+};
+
+/// \brief Memo table for scalars of at most 8 bits, which maps the values to
+/// their indices with a direct lookup table.
+template <typename Scalar>
+class SmallScalarMemoTable : public MemoTable {
+ public:
+  /// The table has room for all the values, so it never allocates memory.
+  explicit SmallScalarMemoTable(MemoryPool* /*pool*/, int64_t /*entries*/ = 0)
+      : size_(0) {
+    std::fill(value_to_index_, value_to_index_ + kCardinality, kKeyNotFound);
+  }
+
+  int32_t Get(const Scalar value) const { return value_to_index_[AsIndex(value)]; }
+
+  template <typename Func1, typename Func2>
+  Status GetOrInsert(const Scalar value, Func1&& on_found, Func2&& on_not_found,
+                     int32_t* out_memo_index) {
+    const uint32_t value_index = AsIndex(value);
+    int32_t memo_index = value_to_index_[value_index];
+    if (memo_index == kKeyNotFound) {
+      memo_index = size_++;
+      index_to_value_[memo_index] = value;
+      value_to_index_[value_index] = memo_index;
+      on_not_found(memo_index);
+    } else {
+      on_found(memo_index);
+    }
+    *out_memo_index = memo_index;
+    return Status::OK();
+  }
+
+  Status GetOrInsert(const Scalar value, int32_t* out_memo_index) {
+    return GetOrInsert(value, [](int32_t) {}, [](int32_t) {}, out_memo_index);
+  }
+
+  int32_t size() const override { return size_; }
+
+  /// The value of an index.
+  Scalar value(int32_t memo_index) const { return index_to_value_[memo_index]; }
+
+  /// \brief Copy the values of the indices from 'start' on to out_data.
+  void CopyValues(int32_t start, Scalar* out_data) const {
+    std::copy(index_to_value_ + start, index_to_value_ + size_, out_data);
+  }
+
+  void CopyValues(Scalar* out_data) const { CopyValues(0, out_data); }
+
+ protected:
+  static_assert(sizeof(Scalar) == 1, "only for scalars of at most 8 bits");
+  static constexpr uint32_t kCardinality = std::is_same<Scalar, bool>::value ? 2 : 256;
+
+  static uint32_t AsIndex(Scalar value) { return static_cast<uint8_t>(value); }
+
+  int32_t value_to_index_[kCardinality];
+  Scalar index_to_value_[kCardinality];
+  int32_t size_;
+};
+
+/// \brief Memo table for byte strings, whose values are stored one after the
+/// other in a contiguous arena, like the data of a BinaryArray.
+class BinaryMemoTable : public MemoTable {
+ public:
+  /// \param[in] pool the pool allocating the hash table and the values.
+  /// \param[in] entries the number of values to make room for.
+  /// \param[in] values_size the total size of the values to make room for, or
+  ///            -1 to guess it from the number of values.
+  explicit BinaryMemoTable(MemoryPool* pool, int64_t entries = 0,
+                           int64_t values_size = -1)
+      : hash_table_(pool, entries),
+        reserved_entries_(entries),
+        reserved_values_size_(values_size < 0 ? entries * 4 : values_size),
+        values_(pool),
+        end_offsets_(pool) {}
+
+  int32_t Get(const void* data, int32_t length) const {
+    auto cmp_func = [this, data, length](const Payload* payload) {
+      return IsEqual(payload->memo_index, data, length);
+    };
+    auto p = hash_table_.Lookup(ComputeStringHash(data, length), cmp_func);
+    return p.second ? p.first->payload.memo_index : kKeyNotFound;
+  }
+
+  int32_t Get(const std::string& value) const {
+    return Get(value.data(), static_cast<int32_t>(value.size()));
+  }
+
+  /// \brief Return the index of a value, inserting it if needed. on_found or
+  /// on_not_found is called with the index, depending on whether the value was
+  /// already present.
+  template <typename Func1, typename Func2>
+  Status GetOrInsert(const void* data, int32_t length, Func1&& on_found,
+                     Func2&& on_not_found, int32_t* out_memo_index) {
+    auto cmp_func = [this, data, length](const Payload* payload) {
+      return IsEqual(payload->memo_index, data, length);
+    };
+    const hash_t h = ComputeStringHash(data, length);
+    auto p = hash_table_.Lookup(h, cmp_func);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      // Allocate everything before inserting, so that a failure leaves the
+      // table unchanged
+      RETURN_NOT_OK(Reserve(&values_, length, reserved_values_size_));
+      RETURN_NOT_OK(Reserve(&end_offsets_, sizeof(int32_t),
+                            reserved_entries_ * sizeof(int32_t)));
+      RETURN_NOT_OK(hash_table_.Insert(p.first, h, {memo_index}));
+      values_.UnsafeAppend(data, length);
+      end_offsets_.UnsafeAppend(static_cast<int32_t>(values_.length()));
+      on_not_found(memo_index);
+    }
+    *out_memo_index = memo_index;
+    return Status::OK();
+  }
+
+  Status GetOrInsert(const void* data, int32_t length, int32_t* out_memo_index) {
+    return GetOrInsert(data, length, [](int32_t) {}, [](int32_t) {}, out_memo_index);
+  }
+
+  Status GetOrInsert(const std::string& value, int32_t* out_memo_index) {
+    return GetOrInsert(value.data(), static_cast<int32_t>(value.size()), out_memo_index);
+  }
+
+  int32_t size() const override { return static_cast<int32_t>(hash_table_.size()); }
+
+  /// The total size of the values.
+  int32_t values_size() const { return static_cast<int32_t>(values_.length()); }
+
+  /// The size of the values of the indices from 'start' on.
+  int32_t values_size(int32_t start) const { return values_size() - Offset(start); }
+
+  /// \brief Copy the offsets of the values of the indices from 'start' on to
+  /// out_data, relative to the first of them, followed by their end offset.
+  void CopyOffsets(int32_t start, int32_t* out_data) const {
+    const int32_t delta = Offset(start);
+    *out_data++ = 0;
+    for (int32_t i = start; i < size(); ++i) {
+      *out_data++ = end_offsets_.data()[i] - delta;
+    }
+  }
+
+  void CopyOffsets(int32_t* out_data) const { CopyOffsets(0, out_data); }
+
+  /// \brief Copy the values of the indices from 'start' on to out_data.
+  void CopyValues(int32_t start, uint8_t* out_data) const {
+    const int32_t nbytes = values_size(start);
+    if (nbytes > 0) {
+      std::memcpy(out_data, values_.data() + Offset(start), static_cast<size_t>(nbytes));
+    }
+  }
+
+  void CopyValues(uint8_t* out_data) const { CopyValues(0, out_data); }
+
+  /// \brief Call visit_func(const uint8_t* data, int32_t length) on the values
+  /// of the indices from 'start' on, in order.
+  template <typename VisitFunc>
+  void VisitValues(int32_t start, VisitFunc&& visit_func) const {
+    int32_t offset = Offset(start);
+    for (int32_t i = start; i < size(); ++i) {
+      const int32_t end_offset = end_offsets_.data()[i];
+      visit_func(values_.data() + offset, end_offset - offset);
+      offset = end_offset;
+    }
+  }
+
+ protected:
+  struct Payload {
+    int32_t memo_index;
+  };
+
+  // The offset of the value of an index, or the total size of the values for
+  // the index past the last one.
+  int32_t Offset(int32_t memo_index) const {
+    return memo_index == 0 ? 0 : end_offsets_.data()[memo_index - 1];
+  }
+
+  bool IsEqual(int32_t memo_index, const void* data, int32_t length) const {
+    const int32_t start = Offset(memo_index);
+    return end_offsets_.data()[memo_index] - start == length &&
+           (length == 0 || std::memcmp(values_.data() + start, data,
+                                       static_cast<size_t>(length)) == 0);
+  }
+
+  // Make room for nbytes more bytes in a builder, growing it geometrically
+  // and at least to the min_capacity asked for at construction.
+  static Status Reserve(BufferBuilder* builder, int64_t nbytes, int64_t min_capacity) {
+    const int64_t needed = builder->length() + nbytes;
+    if (ARROW_PREDICT_FALSE(needed > builder->capacity())) {
+      return builder->Resize(std::max(min_capacity, BitUtil::NextPower2(needed)),
+                             false /*shrink_to_fit*/);
+    }
+    return Status::OK();
+  }
+
+  HashTable<Payload> hash_table_;
+  int64_t reserved_entries_;
+  int64_t reserved_values_size_;
+  // The values, and the end offset of each of them. Like the slots of the
+  // hash table, they are allocated on the first insertion.
+  BufferBuilder values_;
+  TypedBufferBuilder<int32_t> end_offsets_;
+};
+
+// ----------------------------------------------------------------------
+// Memo tables of the values of Arrow types
+
+template <typename T, typename Enable = void>
+struct HashTraits {};
+
+template <typename T>
+struct HashTraits<T, enable_if_boolean<T>> {
+  using MemoTableType = SmallScalarMemoTable<bool>;
+};
+
+template <typename T>
+struct HashTraits<T, enable_if_8bit_int<T>> {
+  using MemoTableType = SmallScalarMemoTable<typename T::c_type>;
+};
+
+template <typename T>
+struct HashTraits<T, typename std::enable_if<has_c_type<T>::value &&
+                                             !is_8bit_int<T>::value>::type> {
+  using MemoTableType = ScalarMemoTable<typename T::c_type>;
+};
+
+template <typename T>
+struct HashTraits<T, enable_if_binary<T>> {
+  using MemoTableType = BinaryMemoTable;
+};
+
+template <typename T>
+struct HashTraits<T, enable_if_fixed_size_binary<T>> {
+  using MemoTableType = BinaryMemoTable;
+};
+
+/// \brief Build the dictionary arrays of the values of a memo table.
+template <typename T, typename Enable = void>
+struct DictionaryTraits {};
+
+template <typename T>
+struct DictionaryTraits<T, enable_if_boolean<T>> {
+  using MemoTableType = typename HashTraits<T>::MemoTableType;
+
+  /// Make the array of the values of the indices from 'start_offset' on.
+  static Status GetDictionaryArrayData(MemoryPool* pool,
+                                       const std::shared_ptr<DataType>& type,
+                                       const MemoTableType& memo_table,
+                                       int32_t start_offset,
+                                       std::shared_ptr<ArrayData>* out) {
+    const int64_t length = memo_table.size() - start_offset;
+    std::shared_ptr<Buffer> dict_data;
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool, length, &dict_data));
+    for (int64_t i = 0; i < length; ++i) {
+      if (memo_table.value(static_cast<int32_t>(start_offset + i))) {
+        BitUtil::SetBit(dict_data->mutable_data(), i);
+      }
+    }
+    *out = ArrayData::Make(type, length, {nullptr, dict_data}, 0 /*null_count*/);
+    return Status::OK();
+  }
+};
+
+template <typename T>
+struct DictionaryTraits<T, enable_if_has_c_type<T>> {
+  using c_type = typename T::c_type;
+  using MemoTableType = typename HashTraits<T>::MemoTableType;
+
+  static Status GetDictionaryArrayData(MemoryPool* pool,
+                                       const std::shared_ptr<DataType>& type,
+                                       const MemoTableType& memo_table,
+                                       int32_t start_offset,
+                                       std::shared_ptr<ArrayData>* out) {
+    const int64_t length = memo_table.size() - start_offset;
+    std::shared_ptr<Buffer> dict_data;
+    RETURN_NOT_OK(AllocateBuffer(pool, length * sizeof(c_type), &dict_data));
+    memo_table.CopyValues(start_offset,
+                          reinterpret_cast<c_type*>(dict_data->mutable_data()));
+    dict_data->ZeroPadding();
+    *out = ArrayData::Make(type, length, {nullptr, dict_data}, 0 /*null_count*/);
+    return Status::OK();
+  }
+};
+
+template <typename T>
+struct DictionaryTraits<T, enable_if_binary<T>> {
+  using MemoTableType = typename HashTraits<T>::MemoTableType;
+
+  static Status GetDictionaryArrayData(MemoryPool* pool,
+                                       const std::shared_ptr<DataType>& type,
+                                       const MemoTableType& memo_table,
+                                       int32_t start_offset,
+                                       std::shared_ptr<ArrayData>* out) {
+    const int64_t length = memo_table.size() - start_offset;
+    std::shared_ptr<Buffer> dict_offsets;
+    RETURN_NOT_OK(AllocateBuffer(pool, (length + 1) * sizeof(int32_t), &dict_offsets));
+    memo_table.CopyOffsets(start_offset,
+                           reinterpret_cast<int32_t*>(dict_offsets->mutable_data()));
+    dict_offsets->ZeroPadding();
+
+    std::shared_ptr<Buffer> dict_data;
+    RETURN_NOT_OK(AllocateBuffer(pool, memo_table.values_size(start_offset), &dict_data));
+    memo_table.CopyValues(start_offset, dict_data->mutable_data());
+    dict_data->ZeroPadding();
+
+    *out = ArrayData::Make(type, length, {nullptr, dict_offsets, dict_data},
+                           0 /*null_count*/);
+    return Status::OK();
+  }
+};
+
+template <typename T>
+struct DictionaryTraits<T, enable_if_fixed_size_binary<T>> {
+  using MemoTableType = typename HashTraits<T>::MemoTableType;
+
+  static Status GetDictionaryArrayData(MemoryPool* pool,
+                                       const std::shared_ptr<DataType>& type,
+                                       const MemoTableType& memo_table,
+                                       int32_t start_offset,
+                                       std::shared_ptr<ArrayData>* out) {
+    const int64_t length = memo_table.size() - start_offset;
+    std::shared_ptr<Buffer> dict_data;
+    RETURN_NOT_OK(AllocateBuffer(pool, memo_table.values_size(start_offset), &dict_data));
+    memo_table.CopyValues(start_offset, dict_data->mutable_data());
+    dict_data->ZeroPadding();
+    *out = ArrayData::Make(type, length, {nullptr, dict_data}, 0 /*null_count*/);
+    return Status::OK();
+  }
+};
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_HASHING_H
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/test-util.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/parsing.h"
 
 namespace arrow {
@@ -43,7 +44,7 @@ static std::vector<std::string> MakeIntStrings(int32_t num_items) {
   for (int32_t i = 0; i < num_items; ++i) {
     strings.push_back(base_strings[i % base_strings.size()]);
   }
-  return base_strings;
+  return strings;
 }
 
 static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
@@ -54,7 +55,30 @@ static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   for (int32_t i = 0; i < num_items; ++i) {
     strings.push_back(base_strings[i % base_strings.size()]);
   }
-  return base_strings;
+  return strings;
+}
+
+static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {
+      "1970-01-01",           "2000-02-29 12",         "1900-02-28T12:34",
+      "2018-11-13 17:11:10",  "2018-11-13T17:11:10Z",  "3989-07-14 03:30:00.5",
+      "2018-11-13 17:11:10.123"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
+static std::vector<std::string> MakeDecimalStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"0",           "5",          "-12.3",
+                                           "98765430000", "3456.789",   "0.0012345",
+                                           "-12345.6789", "1234567890123.456789"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
@@ -97,6 +121,47 @@ static void BM_FloatParsing(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <TimeUnit::type UNIT>
+static void BM_TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
+  using c_type = TimestampType::c_type;
+
+  auto strings = MakeTimestampStrings(1000);
+  StringConverter<TimestampType> converter(timestamp(UNIT));
+
+  while (state.KeepRunning()) {
+    c_type total = 0;
+    for (const auto& s : strings) {
+      c_type value;
+      if (!converter(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+static void BM_DecimalParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeDecimalStrings(1000);
+  StringConverter<Decimal128Type> converter(decimal(38, 8));
+
+  while (state.KeepRunning()) {
+    Decimal128 total;
+    for (const auto& s : strings) {
+      Decimal128 value;
+      if (!converter(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 BENCHMARK_TEMPLATE(BM_IntegerParsing, Int8Type);
 BENCHMARK_TEMPLATE(BM_IntegerParsing, Int16Type);
 BENCHMARK_TEMPLATE(BM_IntegerParsing, Int32Type);
@@ -109,5 +174,10 @@ BENCHMARK_TEMPLATE(BM_IntegerParsing, UInt64Type);
 BENCHMARK_TEMPLATE(BM_FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(BM_FloatParsing, DoubleType);
 
+BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::MILLI);
+BENCHMARK_TEMPLATE(BM_TimestampParsing, TimeUnit::MICRO);
+
+BENCHMARK(BM_DecimalParsing);
+
 }  // namespace internal
 }  // namespace arrow
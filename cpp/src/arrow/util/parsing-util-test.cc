@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/type.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/parsing.h"
 
 namespace arrow {
@@ -80,9 +81,18 @@ TEST(StringConversion, ToFloat) {
   // XXX ASSERT_EQ doesn't distinguish signed zeros
   AssertConversion(converter, "-0.0", -0.0f);
   AssertConversion(converter, "-1e20", -1e20f);
+  AssertConversion(converter, "16777216", 16777216.0f);
+  AssertConversion(converter, "-123.25", -123.25f);
+  AssertConversion(converter, "0.1", 0.1f);
+  AssertConversion(converter, "3.4028235e38", 3.4028235e38f);
+  // Too many digits for the fast path
+  AssertConversion(converter, "16777217.5", 16777217.5f);
+  AssertConversion(converter, "0.12345678901234567890", 0.12345678901234567890f);
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "e");
+  AssertConversionFails(converter, "1.2.3");
+  AssertConversionFails(converter, "-1-");
 }
 
 TEST(StringConversion, ToDouble) {
@@ -93,9 +103,21 @@ TEST(StringConversion, ToDouble) {
   // XXX ASSERT_EQ doesn't distinguish signed zeros
   AssertConversion(converter, "-0.0", -0.0);
   AssertConversion(converter, "-1e100", -1e100);
+  AssertConversion(converter, "9007199254740992", 9007199254740992.0);
+  AssertConversion(converter, "-123456.789", -123456.789);
+  AssertConversion(converter, "0.1", 0.1);
+  AssertConversion(converter, "0.0000000000000000000001", 1e-22);
+  AssertConversion(converter, "1234567890.0123456789", 1234567890.0123456789);
+  // Too many digits for the fast path
+  AssertConversion(converter, "9007199254740993.5", 9007199254740993.5);
+  AssertConversion(converter, "0.00000000000000000000001", 1e-23);
+  AssertConversion(converter, "123456789012345678901234567890",
+                   123456789012345678901234567890.0);
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "e");
+  AssertConversionFails(converter, "1.2.3");
+  AssertConversionFails(converter, "-1-");
 }
 
 TEST(StringConversion, ToFloatLocale) {
@@ -217,6 +239,8 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion(converter, "432198765", 432198765UL);
   AssertConversion(converter, "4294967295", 4294967295UL);
   AssertConversion(converter, "04294967295", 4294967295UL);
+  AssertConversion(converter, "12345678", 12345678UL);
+  AssertConversion(converter, "87654321", 87654321UL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
@@ -237,6 +261,8 @@ TEST(StringConversion, ToInt64) {
   AssertConversion(converter, "09223372036854775807", 9223372036854775807LL);
   AssertConversion(converter, "-9223372036854775808", -9223372036854775807LL - 1);
   AssertConversion(converter, "-009223372036854775808", -9223372036854775807LL - 1);
+  AssertConversion(converter, "1234567890123456", 1234567890123456LL);
+  AssertConversion(converter, "-8765432109876543210", -8765432109876543210LL);
 
   // Non-representable values
   AssertConversionFails(converter, "9223372036854775808");
@@ -253,10 +279,23 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
+  AssertConversion(converter, "10000000000000000000", 10000000000000000000ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "99999999999999999999");
+  AssertConversionFails(converter, "100000000000000000000");
+
+  // Non-digits in any position of a group of eight digits
+  for (size_t i = 0; i < 16; ++i) {
+    std::string s = "1234567812345678";
+    s[i] = ':';
+    AssertConversionFails(converter, s);
+    s[i] = '/';
+    AssertConversionFails(converter, s);
+  }
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -264,4 +303,160 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails(converter, "e");
 }
 
+TEST(StringConversion, ToTimestampDate) {
+  StringConverter<TimestampType> converter(timestamp(TimeUnit::SECOND));
+
+  AssertConversion(converter, "1970-01-01", 0);
+  AssertConversion(converter, "1989-07-14", 616377600);
+  AssertConversion(converter, "2000-02-29", 951782400);
+  AssertConversion(converter, "3989-07-14", 63730281600LL);
+  AssertConversion(converter, "1900-02-28", -2203977600LL);
+  AssertConversion(converter, "0001-01-01", -62135596800LL);
+
+  AssertConversionFails(converter, "");
+  AssertConversionFails(converter, "1970");
+  AssertConversionFails(converter, "19700101");
+  AssertConversionFails(converter, "1970/01/01");
+  AssertConversionFails(converter, "1970-01-01 ");
+  AssertConversionFails(converter, "1970-01-01Z");
+  AssertConversionFails(converter, "1970-00-01");
+  AssertConversionFails(converter, "1970-13-01");
+  AssertConversionFails(converter, "1970-01-32");
+  AssertConversionFails(converter, "1970-01-00");
+  AssertConversionFails(converter, "1970-02-29");
+  AssertConversionFails(converter, "2100-02-29");
+  AssertConversionFails(converter, "1970-0a-01");
+}
+
+TEST(StringConversion, ToTimestampTime) {
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::SECOND));
+
+    AssertConversion(converter, "1970-01-01 00:00:00", 0);
+    AssertConversion(converter, "2018-11-13 17", 1542128400);
+    AssertConversion(converter, "2018-11-13T17", 1542128400);
+    AssertConversion(converter, "2018-11-13 17Z", 1542128400);
+    AssertConversion(converter, "2018-11-13T17Z", 1542128400);
+    AssertConversion(converter, "2018-11-13 17:11", 1542129060);
+    AssertConversion(converter, "2018-11-13T17:11", 1542129060);
+    AssertConversion(converter, "2018-11-13 17:11Z", 1542129060);
+    AssertConversion(converter, "2018-11-13T17:11Z", 1542129060);
+    AssertConversion(converter, "2018-11-13 17:11:10", 1542129070);
+    AssertConversion(converter, "2018-11-13T17:11:10", 1542129070);
+    AssertConversion(converter, "2018-11-13 17:11:10Z", 1542129070);
+    AssertConversion(converter, "2018-11-13T17:11:10Z", 1542129070);
+    AssertConversion(converter, "1900-02-28 12:34:56", -2203932304LL);
+
+    AssertConversionFails(converter, "1970-01-01 1");
+    AssertConversionFails(converter, "1970-01-01 1:00");
+    AssertConversionFails(converter, "1970-01-01 00:00:0");
+    AssertConversionFails(converter, "1970-01-01 00:00:00.");
+    AssertConversionFails(converter, "1970-01-01 00:00:00.0");
+    AssertConversionFails(converter, "1970-01-01T00-00-00");
+    AssertConversionFails(converter, "1970-01-01/00:00:00");
+    AssertConversionFails(converter, "1970-01-01 24:00:00");
+    AssertConversionFails(converter, "1970-01-01 00:60:00");
+    AssertConversionFails(converter, "1970-01-01 00:00:60");
+    AssertConversionFails(converter, "1970-01-01 00:0a:00");
+    AssertConversionFails(converter, "1970-01-01 00:00:00ZZ");
+  }
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::MILLI));
+
+    AssertConversion(converter, "2018-11-13 17:11:10", 1542129070000LL);
+    AssertConversion(converter, "2018-11-13T17:11:10Z", 1542129070000LL);
+    AssertConversion(converter, "2018-11-13 17:11:10.5", 1542129070500LL);
+    AssertConversion(converter, "2018-11-13 17:11:10.123Z", 1542129070123LL);
+    AssertConversion(converter, "1969-12-31 23:59:59.999", -1);
+
+    AssertConversionFails(converter, "2018-11-13 17:11:10.1234");
+    AssertConversionFails(converter, "2018-11-13 17:11:10.12a");
+  }
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::MICRO));
+
+    AssertConversion(converter, "2018-11-13 17:11:10.123456", 1542129070123456LL);
+    AssertConversion(converter, "2018-11-13 17:11:10.000001", 1542129070000001LL);
+
+    AssertConversionFails(converter, "2018-11-13 17:11:10.1234567");
+  }
+  {
+    StringConverter<TimestampType> converter(timestamp(TimeUnit::NANO));
+
+    AssertConversion(converter, "2018-11-13 17:11:10", 1542129070000000000LL);
+    AssertConversion(converter, "2018-11-13 17:11:10.123456789Z",
+                     1542129070123456789LL);
+    AssertConversion(converter, "1677-09-21 00:12:44", -9223372036000000000LL);
+    AssertConversion(converter, "2262-04-11 23:47:16.854775807",
+                     9223372036854775807LL);
+
+    // Out of range for nanoseconds
+    AssertConversionFails(converter, "1677-09-21 00:12:43");
+    AssertConversionFails(converter, "2262-04-11 23:47:16.854775808");
+    AssertConversionFails(converter, "3989-07-14");
+    AssertConversionFails(converter, "2018-11-13 17:11:10.1234567890");
+  }
+}
+
+void AssertDecimalConversion(StringConverter<Decimal128Type>& converter,
+                             const std::string& s, const std::string& expected) {
+  Decimal128 out;
+  ASSERT_TRUE(converter(s.data(), s.length(), &out))
+      << "Conversion failed for '" << s << "' (expected to return " << expected << ")";
+  ASSERT_EQ(out.ToIntegerString(), expected);
+}
+
+void AssertDecimalConversionFails(StringConverter<Decimal128Type>& converter,
+                                  const std::string& s) {
+  Decimal128 out;
+  ASSERT_FALSE(converter(s.data(), s.length(), &out))
+      << "Conversion should have failed for '" << s << "' (returned "
+      << out.ToIntegerString() << ")";
+}
+
+TEST(StringConversion, ToDecimal) {
+  {
+    StringConverter<Decimal128Type> converter(decimal(5, 2));
+
+    AssertDecimalConversion(converter, "0", "0");
+    AssertDecimalConversion(converter, "-0", "0");
+    AssertDecimalConversion(converter, "1", "100");
+    AssertDecimalConversion(converter, "+1.5", "150");
+    AssertDecimalConversion(converter, "-1.25", "-125");
+    AssertDecimalConversion(converter, "999.99", "99999");
+    AssertDecimalConversion(converter, "-999.99", "-99999");
+    AssertDecimalConversion(converter, "000123.4500", "12345");
+    AssertDecimalConversion(converter, "0.01", "1");
+    // Exponents go through the generic parser
+    AssertDecimalConversion(converter, "1.5E2", "15000");
+    AssertDecimalConversion(converter, "-1.2345E2", "-12345");
+
+    // Too many digits for the precision or the scale
+    AssertDecimalConversionFails(converter, "1000");
+    AssertDecimalConversionFails(converter, "1000.00");
+    AssertDecimalConversionFails(converter, "0.001");
+    AssertDecimalConversionFails(converter, "1.5E3");
+    AssertDecimalConversionFails(converter, "1e-3");
+
+    AssertDecimalConversionFails(converter, "");
+    AssertDecimalConversionFails(converter, "-");
+    AssertDecimalConversionFails(converter, ".");
+    AssertDecimalConversionFails(converter, "1.2.3");
+    AssertDecimalConversionFails(converter, "1a");
+    AssertDecimalConversionFails(converter, "e");
+  }
+  {
+    StringConverter<Decimal128Type> converter(decimal(38, 10));
+
+    AssertDecimalConversion(converter, "1234567890123456789012345678.0123456789",
+                            "12345678901234567890123456780123456789");
+    AssertDecimalConversion(converter, "-1234567890123456789012345678",
+                            "-12345678901234567890123456780000000000");
+    AssertDecimalConversion(converter, "123456789.5", "1234567895000000000");
+
+    AssertDecimalConversionFails(converter, "12345678901234567890123456789");
+    AssertDecimalConversionFails(converter, "0.12345678901");
+  }
+}
+
 }  // namespace arrow
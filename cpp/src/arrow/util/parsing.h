@@ -20,8 +20,13 @@
 #ifndef ARROW_UTIL_PARSING_H
 #define ARROW_UTIL_PARSING_H
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <locale>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -30,6 +35,10 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/macros.h"
 
 namespace arrow {
 namespace internal {
@@ -43,6 +52,11 @@ namespace internal {
 /// so it's recommended to use a single instance many times, if doing bulk
 /// conversion.
 ///
+/// All converters can be constructed from the target data type.  It is
+/// optional for types without parameters, but required for parametric
+/// types such as TimestampType (for the unit) or Decimal128Type (for the
+/// precision and scale).
+///
 template <typename ARROW_TYPE, typename Enable = void>
 class StringConverter;
 
@@ -51,6 +65,8 @@ class StringConverter<BooleanType> {
  public:
   using value_type = bool;
 
+  explicit StringConverter(const std::shared_ptr<DataType>& = NULLPTR) {}
+
   bool operator()(const char* s, size_t length, value_type* out) {
     if (length == 1) {
       // "0" or "1"?
@@ -81,6 +97,124 @@ class StringConverter<BooleanType> {
   }
 };
 
+namespace detail {
+
+// Digits are validated and converted eight at a time with plain 64-bit
+// arithmetic ("SIMD within a register"), which works on all platforms and
+// is much faster than a loop over single characters for long numbers.
+
+// Load 8 characters, the first one in the least significant byte
+inline uint64_t LoadEightChars(const char* s) {
+  uint64_t word;
+  memcpy(&word, s, sizeof(word));
+  return BitUtil::FromLittleEndian(word);
+}
+
+// Whether the 8 characters are all in '0'..'9': the high nibble of each byte
+// must be 3, and adding 6 to a digit must not carry into the high nibble.
+inline bool IsEightDigits(uint64_t word) {
+  return ((word & 0xF0F0F0F0F0F0F0F0ULL) |
+          (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+         0x3333333333333333ULL;
+}
+
+// Convert 8 digits to their value, by combining adjacent digits into pairs,
+// then pairs into quads and quads into the final value
+inline uint32_t ParseEightDigits(uint64_t word) {
+  word -= 0x3030303030303030ULL;
+  word = (word * 10) + (word >> 8);
+  word = (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+          (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+         32;
+  return static_cast<uint32_t>(word);
+}
+
+// Parse a run of at most 19 digits, which always fits in a uint64_t
+inline bool ParseDigits(const char* s, size_t length, uint64_t* out) {
+  uint64_t result = 0;
+  for (; length >= 8; length -= 8, s += 8) {
+    const uint64_t word = LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE(!IsEightDigits(word))) {
+      return false;
+    }
+    result = result * 100000000ULL + ParseEightDigits(word);
+  }
+  for (; length > 0; --length, ++s) {
+    const uint8_t digit = static_cast<uint8_t>(*s - '0');
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  *out = result;
+  return true;
+}
+
+static constexpr uint64_t kUInt64PowersOfTen[] = {1ULL,
+                                                  10ULL,
+                                                  100ULL,
+                                                  1000ULL,
+                                                  10000ULL,
+                                                  100000ULL,
+                                                  1000000ULL,
+                                                  10000000ULL,
+                                                  100000000ULL,
+                                                  1000000000ULL,
+                                                  10000000000ULL,
+                                                  100000000000ULL,
+                                                  1000000000000ULL,
+                                                  10000000000000ULL,
+                                                  100000000000000ULL,
+                                                  1000000000000000ULL,
+                                                  10000000000000000ULL,
+                                                  100000000000000000ULL,
+                                                  1000000000000000000ULL};
+
+static constexpr double kDoublePowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Parse the plain decimal notation "[-]digits[.digits]" when the digits and
+// the power of ten are both exactly representable in the floating-point type,
+// so that a single correctly rounded division gives the exact result.  This
+// covers most numbers found in practice.  Returns false for anything else,
+// which must go through the general converter.
+template <typename T>
+inline bool ParseSimpleDecimal(const char* s, size_t length, T* out) {
+  // Largest exactly representable mantissa and power of ten
+  constexpr uint64_t kMaxMantissa = 1ULL << std::numeric_limits<T>::digits;
+  constexpr size_t kMaxExponent = std::is_same<T, float>::value ? 10 : 22;
+
+  const char* end = s + length;
+  const bool negative = (length > 0 && *s == '-');
+  s += negative;
+  const char* dot = static_cast<const char*>(memchr(s, '.', end - s));
+  const char* int_end = dot ? dot : end;
+  const size_t int_length = int_end - s;
+  const size_t frac_length = dot ? end - dot - 1 : 0;
+  if (int_length == 0 || (dot && frac_length == 0) ||
+      int_length + frac_length > 19 || frac_length > kMaxExponent) {
+    return false;
+  }
+  uint64_t mantissa, fraction = 0;
+  if (!ParseDigits(s, int_length, &mantissa) ||
+      (dot && !ParseDigits(dot + 1, frac_length, &fraction))) {
+    return false;
+  }
+  mantissa = mantissa * kUInt64PowersOfTen[frac_length] + fraction;
+  if (mantissa > kMaxMantissa) {
+    return false;
+  }
+  T value = static_cast<T>(mantissa);
+  if (frac_length > 0) {
+    value /= static_cast<T>(kDoublePowersOfTen[frac_length]);
+  }
+  *out = negative ? -value : value;
+  return true;
+}
+
+}  // namespace detail
+
 // Ideas for faster float parsing:
 // - http://rapidjson.org/md_doc_internals.html#ParsingDouble
 // - https://github.com/google/double-conversion [used here]
@@ -91,12 +225,15 @@ class StringToFloatConverterMixin {
  public:
   using value_type = typename ARROW_TYPE::c_type;
 
-  StringToFloatConverterMixin()
+  explicit StringToFloatConverterMixin(const std::shared_ptr<DataType>& = NULLPTR)
       : main_converter_(flags_, main_junk_value_, main_junk_value_, "inf", "nan"),
         fallback_converter_(flags_, fallback_junk_value_, fallback_junk_value_, "inf",
                             "nan") {}
 
   bool operator()(const char* s, size_t length, value_type* out) {
+    if (ARROW_PREDICT_TRUE(detail::ParseSimpleDecimal(s, length, out))) {
+      return true;
+    }
     value_type v;
     // double-conversion doesn't give us an error flag but signals parse
     // errors with sentinel values.  Since a sentinel value can appear as
@@ -137,10 +274,16 @@ class StringToFloatConverterMixin {
 };
 
 template <>
-class StringConverter<FloatType> : public StringToFloatConverterMixin<FloatType> {};
+class StringConverter<FloatType> : public StringToFloatConverterMixin<FloatType> {
+ public:
+  using StringToFloatConverterMixin<FloatType>::StringToFloatConverterMixin;
+};
 
 template <>
-class StringConverter<DoubleType> : public StringToFloatConverterMixin<DoubleType> {};
+class StringConverter<DoubleType> : public StringToFloatConverterMixin<DoubleType> {
+ public:
+  using StringToFloatConverterMixin<DoubleType>::StringToFloatConverterMixin;
+};
 
 // NOTE: HalfFloatType would require a half<->float conversion library
 
@@ -182,6 +325,19 @@ namespace detail {
     result = new_result;                                                          \
   }
 
+// Parse the next 8 digits at once
+#define PARSE_UNSIGNED_EIGHT_DIGITS(C_TYPE)                                     \
+  {                                                                             \
+    const uint64_t word = LoadEightChars(s);                                    \
+    if (ARROW_PREDICT_FALSE(!IsEightDigits(word))) {                            \
+      /* Non-digit */                                                           \
+      return false;                                                             \
+    }                                                                           \
+    result = static_cast<C_TYPE>(result * 100000000U + ParseEightDigits(word)); \
+    s += 8;                                                                     \
+    length -= 8;                                                                \
+  }
+
 inline bool ParseUnsigned(const char* s, size_t length, uint8_t* out) {
   uint8_t result = 0;
 
@@ -204,21 +360,26 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
   return true;
 }
 
+// Below 8 digits, the digits are parsed one at a time and can't overflow
+#define PARSE_UNSIGNED_SEVEN_ITERATIONS(C_TYPE) \
+  PARSE_UNSIGNED_ITERATION(C_TYPE);             \
+  PARSE_UNSIGNED_ITERATION(C_TYPE);             \
+  PARSE_UNSIGNED_ITERATION(C_TYPE);             \
+  PARSE_UNSIGNED_ITERATION(C_TYPE);             \
+  PARSE_UNSIGNED_ITERATION(C_TYPE);             \
+  PARSE_UNSIGNED_ITERATION(C_TYPE);             \
+  PARSE_UNSIGNED_ITERATION(C_TYPE);
+
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
   uint32_t result = 0;
 
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-
-  PARSE_UNSIGNED_ITERATION_LAST(uint32_t);
+  if (length >= 8) {
+    PARSE_UNSIGNED_EIGHT_DIGITS(uint32_t);
+    PARSE_UNSIGNED_ITERATION(uint32_t);
+    PARSE_UNSIGNED_ITERATION_LAST(uint32_t);
+  } else {
+    PARSE_UNSIGNED_SEVEN_ITERATIONS(uint32_t);
+  }
   *out = result;
   return true;
 }
@@ -226,36 +387,27 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   uint64_t result = 0;
 
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
+  if (length >= 16) {
+    PARSE_UNSIGNED_EIGHT_DIGITS(uint64_t);
+    PARSE_UNSIGNED_EIGHT_DIGITS(uint64_t);
+    PARSE_UNSIGNED_ITERATION(uint64_t);
+    PARSE_UNSIGNED_ITERATION(uint64_t);
+    PARSE_UNSIGNED_ITERATION(uint64_t);
+    PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
+  } else {
+    if (length >= 8) {
+      PARSE_UNSIGNED_EIGHT_DIGITS(uint64_t);
+    }
+    PARSE_UNSIGNED_SEVEN_ITERATIONS(uint64_t);
+  }
   *out = result;
   return true;
 }
 
 #undef PARSE_UNSIGNED_ITERATION
 #undef PARSE_UNSIGNED_ITERATION_LAST
+#undef PARSE_UNSIGNED_EIGHT_DIGITS
+#undef PARSE_UNSIGNED_SEVEN_ITERATIONS
 
 }  // namespace detail
 
@@ -264,6 +416,9 @@ class StringToUnsignedIntConverterMixin {
  public:
   using value_type = typename ARROW_TYPE::c_type;
 
+  explicit StringToUnsignedIntConverterMixin(
+      const std::shared_ptr<DataType>& = NULLPTR) {}
+
   bool operator()(const char* s, size_t length, value_type* out) {
     if (ARROW_PREDICT_FALSE(length == 0)) {
       return false;
@@ -278,18 +433,27 @@ class StringToUnsignedIntConverterMixin {
 };
 
 template <>
-class StringConverter<UInt8Type> : public StringToUnsignedIntConverterMixin<UInt8Type> {};
+class StringConverter<UInt8Type> : public StringToUnsignedIntConverterMixin<UInt8Type> {
+ public:
+  using StringToUnsignedIntConverterMixin<UInt8Type>::StringToUnsignedIntConverterMixin;
+};
 
 template <>
 class StringConverter<UInt16Type> : public StringToUnsignedIntConverterMixin<UInt16Type> {
+ public:
+  using StringToUnsignedIntConverterMixin<UInt16Type>::StringToUnsignedIntConverterMixin;
 };
 
 template <>
 class StringConverter<UInt32Type> : public StringToUnsignedIntConverterMixin<UInt32Type> {
+ public:
+  using StringToUnsignedIntConverterMixin<UInt32Type>::StringToUnsignedIntConverterMixin;
 };
 
 template <>
 class StringConverter<UInt64Type> : public StringToUnsignedIntConverterMixin<UInt64Type> {
+ public:
+  using StringToUnsignedIntConverterMixin<UInt64Type>::StringToUnsignedIntConverterMixin;
 };
 
 template <class ARROW_TYPE>
@@ -298,6 +462,9 @@ class StringToSignedIntConverterMixin {
   using value_type = typename ARROW_TYPE::c_type;
   using unsigned_type = typename std::make_unsigned<value_type>::type;
 
+  explicit StringToSignedIntConverterMixin(
+      const std::shared_ptr<DataType>& = NULLPTR) {}
+
   bool operator()(const char* s, size_t length, value_type* out) {
     static constexpr unsigned_type max_positive =
         static_cast<unsigned_type>(std::numeric_limits<value_type>::max());
@@ -328,7 +495,7 @@ class StringToSignedIntConverterMixin {
       if (ARROW_PREDICT_FALSE(unsigned_value > max_negative)) {
         return false;
       }
-      *out = static_cast<value_type>(-static_cast<value_type>(unsigned_value));
+      *out = static_cast<value_type>(-unsigned_value);
     } else {
       if (ARROW_PREDICT_FALSE(unsigned_value > max_positive)) {
         return false;
@@ -340,16 +507,342 @@ class StringToSignedIntConverterMixin {
 };
 
 template <>
-class StringConverter<Int8Type> : public StringToSignedIntConverterMixin<Int8Type> {};
+class StringConverter<Int8Type> : public StringToSignedIntConverterMixin<Int8Type> {
+ public:
+  using StringToSignedIntConverterMixin<Int8Type>::StringToSignedIntConverterMixin;
+};
 
 template <>
-class StringConverter<Int16Type> : public StringToSignedIntConverterMixin<Int16Type> {};
+class StringConverter<Int16Type> : public StringToSignedIntConverterMixin<Int16Type> {
+ public:
+  using StringToSignedIntConverterMixin<Int16Type>::StringToSignedIntConverterMixin;
+};
 
 template <>
-class StringConverter<Int32Type> : public StringToSignedIntConverterMixin<Int32Type> {};
+class StringConverter<Int32Type> : public StringToSignedIntConverterMixin<Int32Type> {
+ public:
+  using StringToSignedIntConverterMixin<Int32Type>::StringToSignedIntConverterMixin;
+};
 
 template <>
-class StringConverter<Int64Type> : public StringToSignedIntConverterMixin<Int64Type> {};
+class StringConverter<Int64Type> : public StringToSignedIntConverterMixin<Int64Type> {
+ public:
+  using StringToSignedIntConverterMixin<Int64Type>::StringToSignedIntConverterMixin;
+};
+
+namespace detail {
+
+// Check 8 characters made of digits and of separators at fixed positions
+// (selected by the mask), all at once, and return the digit values with
+// the separators zeroed
+inline bool MatchDigitsAndSeparators(uint64_t word, uint64_t separator_mask,
+                                     uint64_t separators, uint64_t* digits) {
+  if (ARROW_PREDICT_FALSE((word & separator_mask) != separators)) {
+    return false;
+  }
+  word = (word & ~separator_mask) | (0x3030303030303030ULL & separator_mask);
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(word))) {
+    return false;
+  }
+  *digits = word - 0x3030303030303030ULL;
+  return true;
+}
+
+// The value of a digit returned by MatchDigitsAndSeparators
+inline uint32_t DigitAt(uint64_t digits, int position) {
+  return static_cast<uint32_t>((digits >> (8 * position)) & 0xFF);
+}
+
+inline bool ParseTwoDigits(const char* s, uint32_t* out) {
+  const uint32_t high = static_cast<uint8_t>(s[0] - '0');
+  const uint32_t low = static_cast<uint8_t>(s[1] - '0');
+  *out = high * 10 + low;
+  return high <= 9 && low <= 9;
+}
+
+// Number of days since 1970-01-01 of a date in the proleptic Gregorian
+// calendar, see http://howardhinnant.github.io/date_algorithms.html
+inline int64_t DaysSinceEpoch(int64_t year, uint32_t month, uint32_t day) {
+  year -= month <= 2;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const uint32_t year_of_era = static_cast<uint32_t>(year - era * 400);
+  const uint32_t day_of_year =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const uint32_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+}
+
+inline uint32_t DaysInMonth(uint32_t year, uint32_t month) {
+  static constexpr uint8_t kDaysInMonth[] = {31, 28, 31, 30, 31, 30,
+                                             31, 31, 30, 31, 30, 31};
+  const bool leap_year = (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+  return kDaysInMonth[month - 1] + (month == 2 && leap_year);
+}
+
+// Parse "YYYY-MM-DD" into a number of days since the epoch
+inline bool ParseYYYY_MM_DD(const char* s, int64_t* out) {
+  // "YYYY-MM-" is checked at once, with dashes at offsets 4 and 7
+  uint64_t digits;
+  uint32_t day;
+  if (ARROW_PREDICT_FALSE(!MatchDigitsAndSeparators(
+          LoadEightChars(s), 0xFF0000FF00000000ULL, 0x2D00002D00000000ULL, &digits)) ||
+      ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 8, &day))) {
+    return false;
+  }
+  const uint32_t year = DigitAt(digits, 0) * 1000 + DigitAt(digits, 1) * 100 +
+                        DigitAt(digits, 2) * 10 + DigitAt(digits, 3);
+  const uint32_t month = DigitAt(digits, 5) * 10 + DigitAt(digits, 6);
+  if (ARROW_PREDICT_FALSE(month < 1 || month > 12) ||
+      ARROW_PREDICT_FALSE(day < 1 || day > DaysInMonth(year, month))) {
+    return false;
+  }
+  *out = DaysSinceEpoch(year, month, day);
+  return true;
+}
+
+// Parse "hh", "hh:mm" or "hh:mm:ss" into a number of seconds
+inline bool ParseTimeOfDay(const char* s, size_t length, int64_t* out) {
+  uint32_t hours, minutes = 0, seconds = 0;
+  if (length == 8) {
+    // "hh:mm:ss" is checked at once, with colons at offsets 2 and 5
+    uint64_t digits;
+    if (ARROW_PREDICT_FALSE(!MatchDigitsAndSeparators(
+            LoadEightChars(s), 0x0000FF0000FF0000ULL, 0x00003A00003A0000ULL, &digits))) {
+      return false;
+    }
+    hours = DigitAt(digits, 0) * 10 + DigitAt(digits, 1);
+    minutes = DigitAt(digits, 3) * 10 + DigitAt(digits, 4);
+    seconds = DigitAt(digits, 6) * 10 + DigitAt(digits, 7);
+  } else if (length == 5) {
+    if (!ParseTwoDigits(s, &hours) || s[2] != ':' || !ParseTwoDigits(s + 3, &minutes)) {
+      return false;
+    }
+  } else if (length == 2) {
+    if (!ParseTwoDigits(s, &hours)) {
+      return false;
+    }
+  } else {
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(hours > 23 || minutes > 59 || seconds > 59)) {
+    return false;
+  }
+  *out = hours * 3600 + minutes * 60 + seconds;
+  return true;
+}
+
+}  // namespace detail
+
+/// \brief Conversion of ISO-8601 timestamps
+///
+/// The accepted formats are "YYYY-MM-DD", optionally followed by a time of
+/// day "hh", "hh:mm", "hh:mm:ss" or "hh:mm:ss.f" separated by a space or a
+/// "T".  The time may be followed by "Z".  The number of fractional digits
+/// is limited by the unit of the timestamp type.  All timestamps are
+/// interpreted as UTC.
+template <>
+class StringConverter<TimestampType> {
+ public:
+  using value_type = TimestampType::c_type;
+
+  explicit StringConverter(const std::shared_ptr<DataType>& type) {
+    switch (checked_cast<const TimestampType&>(*type).unit()) {
+      case TimeUnit::SECOND:
+        fraction_digits_ = 0;
+        break;
+      case TimeUnit::MILLI:
+        fraction_digits_ = 3;
+        break;
+      case TimeUnit::MICRO:
+        fraction_digits_ = 6;
+        break;
+      case TimeUnit::NANO:
+        fraction_digits_ = 9;
+        break;
+    }
+    multiplier_ = static_cast<int64_t>(detail::kUInt64PowersOfTen[fraction_digits_]);
+  }
+
+  bool operator()(const char* s, size_t length, value_type* out) {
+    if (ARROW_PREDICT_FALSE(length < 10)) {
+      return false;
+    }
+    int64_t days;
+    if (ARROW_PREDICT_FALSE(!detail::ParseYYYY_MM_DD(s, &days))) {
+      return false;
+    }
+    int64_t seconds = days * 86400;
+    int64_t subseconds = 0;
+
+    if (length > 10) {
+      if (s[10] != ' ' && s[10] != 'T') {
+        return false;
+      }
+      s += 11;
+      length -= 11;
+      if (length > 0 && s[length - 1] == 'Z') {
+        --length;
+      }
+      size_t time_length = length;
+      if (length > 8 && s[8] == '.') {
+        // Fractional seconds, up to the precision of the unit
+        const size_t num_digits = length - 9;
+        uint64_t fraction;
+        if (ARROW_PREDICT_FALSE(num_digits == 0 || num_digits > fraction_digits_) ||
+            ARROW_PREDICT_FALSE(!detail::ParseDigits(s + 9, num_digits, &fraction))) {
+          return false;
+        }
+        subseconds = static_cast<int64_t>(
+            fraction * detail::kUInt64PowersOfTen[fraction_digits_ - num_digits]);
+        time_length = 8;
+      }
+      int64_t time_of_day;
+      if (ARROW_PREDICT_FALSE(!detail::ParseTimeOfDay(s, time_length, &time_of_day))) {
+        return false;
+      }
+      seconds += time_of_day;
+    }
+
+    // Out of range for the unit?
+    if (ARROW_PREDICT_FALSE(
+            seconds < std::numeric_limits<int64_t>::min() / multiplier_ ||
+            seconds > (std::numeric_limits<int64_t>::max() - subseconds) / multiplier_)) {
+      return false;
+    }
+    *out = seconds * multiplier_ + subseconds;
+    return true;
+  }
+
+ protected:
+  size_t fraction_digits_ = 0;
+  int64_t multiplier_ = 1;
+};
+
+/// \brief Conversion of decimal numbers to the precision and scale of a
+/// Decimal128Type
+///
+/// The conversion fails if the value would lose digits or doesn't fit in the
+/// precision.
+template <>
+class StringConverter<Decimal128Type> {
+ public:
+  using value_type = Decimal128;
+
+  explicit StringConverter(const std::shared_ptr<DataType>& type) {
+    const auto& decimal_type = checked_cast<const Decimal128Type&>(*type);
+    precision_ = decimal_type.precision();
+    scale_ = decimal_type.scale();
+  }
+
+  bool operator()(const char* s, size_t length, value_type* out) {
+    if (ARROW_PREDICT_TRUE(ParsePlain(s, length, out))) {
+      return true;
+    }
+    return ParseGeneral(s, length, out);
+  }
+
+ protected:
+  // Fast path for the plain notation "[-+]digits[.digits]"
+  bool ParsePlain(const char* s, size_t length, value_type* out) {
+    const char* end = s + length;
+    bool negative = false;
+    if (length > 0 && (*s == '-' || *s == '+')) {
+      negative = (*s == '-');
+      ++s;
+    }
+    const char* int_start = s;
+    const char* dot = static_cast<const char*>(memchr(s, '.', end - s));
+    const char* int_end = dot ? dot : end;
+    const char* frac_start = dot ? dot + 1 : end;
+    if (int_end == int_start || (dot && frac_start == end) || scale_ < 0) {
+      return false;
+    }
+    // Leading zeros are not significant, neither are trailing zeros after
+    // the scale of the type
+    while (int_start + 1 < int_end && *int_start == '0') {
+      ++int_start;
+    }
+    size_t int_length = int_end - int_start;
+    size_t frac_length = end - frac_start;
+    while (frac_length > static_cast<size_t>(scale_) &&
+           frac_start[frac_length - 1] == '0') {
+      --frac_length;
+    }
+    if (int_length == 1 && *int_start == '0') {
+      int_length = 0;
+    }
+    if (frac_length > static_cast<size_t>(scale_) ||
+        int_length + scale_ > static_cast<size_t>(precision_)) {
+      return false;
+    }
+    const size_t num_zeros = scale_ - frac_length;
+
+    if (int_length + scale_ <= 18) {
+      // The scaled value fits in an int64_t
+      uint64_t int_value, frac_value;
+      if (!detail::ParseDigits(int_start, int_length, &int_value) ||
+          !detail::ParseDigits(frac_start, frac_length, &frac_value)) {
+        return false;
+      }
+      const uint64_t value =
+          (int_value * detail::kUInt64PowersOfTen[frac_length] + frac_value) *
+          detail::kUInt64PowersOfTen[num_zeros];
+      *out = negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+      return true;
+    }
+    Decimal128 value;
+    if (!AppendDigits(int_start, int_length, &value) ||
+        !AppendDigits(frac_start, frac_length, &value)) {
+      return false;
+    }
+    for (size_t zeros = num_zeros; zeros > 0;) {
+      const size_t chunk = std::min<size_t>(zeros, 18);
+      value *= Decimal128(detail::kUInt64PowersOfTen[chunk]);
+      zeros -= chunk;
+    }
+    *out = negative ? value.Negate() : value;
+    return true;
+  }
+
+  // Multiply the value by a power of ten and add a run of digits, 18 digits
+  // at a time
+  static bool AppendDigits(const char* s, size_t length, Decimal128* value) {
+    while (length > 0) {
+      const size_t chunk = std::min<size_t>(length, 18);
+      uint64_t chunk_value;
+      if (!detail::ParseDigits(s, chunk, &chunk_value)) {
+        return false;
+      }
+      *value *= Decimal128(detail::kUInt64PowersOfTen[chunk]);
+      *value += Decimal128(chunk_value);
+      s += chunk;
+      length -= chunk;
+    }
+    return true;
+  }
+
+  // Other notations, such as exponents, go through the generic parser
+  bool ParseGeneral(const char* s, size_t length, value_type* out) {
+    int32_t precision, scale;
+    Decimal128 value;
+    if (!Decimal128::FromString(std::string(s, length), &value, &precision, &scale)
+             .ok() ||
+        precision > 38 || precision - scale + scale_ > precision_) {
+      return false;
+    }
+    if (scale != scale_) {
+      if (std::abs(scale_ - scale) > 38 || !value.Rescale(scale, scale_, &value).ok()) {
+        return false;
+      }
+    }
+    *out = value;
+    return true;
+  }
+
+  int32_t precision_;
+  int32_t scale_;
+};
 
 }  // namespace internal
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <random>
 #include <vector>
 
@@ -28,6 +29,8 @@
 
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/rle-encoding.h"
 
 using std::vector;
@@ -466,5 +469,130 @@ TEST(BitRle, Overflow) {
   }
 }
 
+// Bit-pack num_values random values of the given width into an exactly sized
+// buffer, so that out-of-bounds reads from the unpack kernels can be detected by
+// sanitizers
+void PackRandomValues(int bit_width, int num_values, std::vector<uint32_t>* values,
+                      std::vector<uint32_t>* packed) {
+  std::default_random_engine gen(bit_width);
+  std::uniform_int_distribution<uint32_t> dist;
+  const uint64_t mask = (1ULL << bit_width) - 1;
+
+  values->assign(num_values, 0);
+  // Keep the buffer non-empty for bit_width == 0
+  packed->assign(std::max(num_values * bit_width / 32, 1), 0);
+  if (bit_width == 0) {
+    return;
+  }
+  BitUtil::BitWriter writer(reinterpret_cast<uint8_t*>(packed->data()),
+                            static_cast<int>(packed->size() * 4));
+  for (int i = 0; i < num_values; ++i) {
+    (*values)[i] = static_cast<uint32_t>(dist(gen) & mask);
+    ASSERT_TRUE(writer.PutValue((*values)[i], bit_width));
+  }
+  writer.Flush();
+}
+
+void CheckUnpack32(
+    const std::function<int(const uint32_t*, uint32_t*, int, int)>& unpack) {
+  // Not a multiple of the 32-value block size: the trailing values are ignored
+  const int num_values = 32 * 37;
+  for (int bit_width = 0; bit_width <= MAX_WIDTH; ++bit_width) {
+    std::vector<uint32_t> values, packed;
+    PackRandomValues(bit_width, num_values, &values, &packed);
+
+    std::vector<uint32_t> unpacked(num_values + 5, 0xdeadbeef);
+    ASSERT_EQ(num_values, unpack(packed.data(), unpacked.data(), num_values + 5,
+                                 bit_width));
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(values[i], unpacked[i]) << "bit_width=" << bit_width << " i=" << i;
+    }
+    for (int i = num_values; i < num_values + 5; ++i) {
+      ASSERT_EQ(0xdeadbeef, unpacked[i]);
+    }
+  }
+}
+
+TEST(BitPacking, Unpack32) {
+  CheckUnpack32(internal::unpack32_default);
+  CheckUnpack32(internal::unpack32);
+#ifdef ARROW_HAVE_AVX2
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX2)) {
+    CheckUnpack32(internal::unpack32_avx2);
+  }
+#endif
+#ifdef ARROW_HAVE_AVX512
+  if (internal::CpuInfo::GetInstance()->IsSupported(internal::CpuInfo::AVX512)) {
+    CheckUnpack32(internal::unpack32_avx512);
+  }
+#endif
+}
+
+TEST(BitPacking, Gather) {
+  const int dict_size = 100;
+  const int num_values = 1003;
+  std::vector<uint32_t> dict32(dict_size);
+  std::vector<uint64_t> dict64(dict_size);
+  for (int i = 0; i < dict_size; ++i) {
+    dict32[i] = i * 7 + 1;
+    dict64[i] = (static_cast<uint64_t>(i) << 40) + i;
+  }
+  std::vector<int32_t> indices(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    indices[i] = (i * 31) % dict_size;
+  }
+
+  std::vector<uint32_t> out32(num_values);
+  std::vector<uint64_t> out64(num_values);
+  internal::gather32(dict32.data(), indices.data(), num_values, out32.data());
+  internal::gather64(dict64.data(), indices.data(), num_values, out64.data());
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(dict32[indices[i]], out32[i]);
+    ASSERT_EQ(dict64[indices[i]], out64[i]);
+  }
+}
+
+template <typename T>
+void CheckGetBatchWithDict(const std::vector<T>& dictionary) {
+  const int bit_width = 7;
+  const int num_values = 2000;
+  std::vector<int> indices(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    // Mix of literal and repeated runs
+    indices[i] = (i / 100) % 2 == 0 ? (i * 13) % static_cast<int>(dictionary.size())
+                                    : (i / 100);
+  }
+
+  const int buffer_len = RleEncoder::MaxBufferSize(bit_width, num_values);
+  std::vector<uint8_t> buffer(buffer_len);
+  RleEncoder encoder(buffer.data(), buffer_len, bit_width);
+  for (int index : indices) {
+    ASSERT_TRUE(encoder.Put(index));
+  }
+  int encoded_len = encoder.Flush();
+
+  RleDecoder decoder(buffer.data(), encoded_len, bit_width);
+  std::vector<T> values(num_values);
+  ASSERT_EQ(num_values,
+            decoder.GetBatchWithDict(dictionary.data(), values.data(), num_values));
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(dictionary[indices[i]], values[i]) << i;
+  }
+}
+
+TEST(Rle, GetBatchWithDict) {
+  std::vector<int32_t> dict_int32;
+  std::vector<int64_t> dict_int64;
+  std::vector<double> dict_double;
+  for (int i = 0; i < 128; ++i) {
+    dict_int32.push_back(i * 3 - 100);
+    dict_int64.push_back(static_cast<int64_t>(i) << 33);
+    dict_double.push_back(i / 4.0);
+  }
+  CheckGetBatchWithDict(dict_int32);
+  CheckGetBatchWithDict(dict_int64);
+  CheckGetBatchWithDict(dict_double);
+}
+
 }  // namespace util
 }  // namespace arrow
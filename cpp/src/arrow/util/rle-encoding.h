@@ -23,9 +23,12 @@
 
 #include <math.h>
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
 
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
@@ -310,6 +313,41 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+namespace detail {
+
+// Decode dictionary indices into values. Numeric values of 4 and 8 bytes use the
+// (possibly SIMD) gather kernels from bpacking.h, other types are copied one at a
+// time.
+template <typename T, int kSize = std::is_arithmetic<T>::value ? sizeof(T) : 0>
+struct DictionaryGather {
+  static void Gather(const T* dictionary, const int* indices, int num_values,
+                     T* values) {
+    for (int i = 0; i < num_values; ++i) {
+      values[i] = dictionary[indices[i]];
+    }
+  }
+};
+
+template <typename T>
+struct DictionaryGather<T, 4> {
+  static void Gather(const T* dictionary, const int* indices, int num_values,
+                     T* values) {
+    internal::gather32(reinterpret_cast<const uint32_t*>(dictionary), indices,
+                       num_values, reinterpret_cast<uint32_t*>(values));
+  }
+};
+
+template <typename T>
+struct DictionaryGather<T, 8> {
+  static void Gather(const T* dictionary, const int* indices, int num_values,
+                     T* values) {
+    internal::gather64(reinterpret_cast<const uint64_t*>(dictionary), indices,
+                       num_values, reinterpret_cast<uint64_t*>(values));
+  }
+};
+
+}  // namespace detail
+
 template <typename T>
 inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batch_size) {
   DCHECK_GE(bit_width_, 0);
@@ -332,9 +370,8 @@ inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batc
       literal_batch = std::min(literal_batch, buffer_size);
       int actual_read = bit_reader_.GetBatch(bit_width_, &indices[0], literal_batch);
       DCHECK_EQ(actual_read, literal_batch);
-      for (int i = 0; i < literal_batch; ++i) {
-        values[values_read + i] = dictionary[indices[i]];
-      }
+      detail::DictionaryGather<T>::Gather(dictionary, indices, literal_batch,
+                                          values + values_read);
       literal_count_ -= literal_batch;
       values_read += literal_batch;
     } else {
@@ -125,6 +125,18 @@ int ThreadPool::GetActualCapacity() {
   return static_cast<int>(state_->workers_.size());
 }
 
+bool ThreadPool::OwnsThisThread() {
+  ProtectAgainstFork();
+  std::unique_lock<std::mutex> lock(state_->mutex_);
+  const auto thread_id = std::this_thread::get_id();
+  for (const auto& worker : state_->workers_) {
+    if (worker.get_id() == thread_id) {
+      return true;
+    }
+  }
+  return false;
+}
+
 Status ThreadPool::Shutdown(bool wait) {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -93,6 +93,11 @@ class ARROW_EXPORT ThreadPool {
   // thread count is fully adjusted.
   Status SetCapacity(int threads);
 
+  // Return whether the calling thread is one of the pool's workers. Tasks which
+  // wait for tasks submitted to the same pool may use it to run them inline,
+  // since the pool may have no free worker left to run them.
+  bool OwnsThisThread();
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
@@ -56,31 +56,45 @@ FieldDescriptorPtr Annotator::MakeDesc(FieldPtr field) {
 
 void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
                                        const arrow::ArrayData& array_data,
-                                       EvalBatch* eval_batch) {
+                                       int64_t offset, EvalBatch* eval_batch) {
   int buffer_idx = 0;
+  DCHECK_EQ(offset % 64, 0);
 
   // TODO:
   // - validity is optional
 
   uint8_t* validity_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-  eval_batch->SetBuffer(desc.validity_idx(), validity_buf);
+  eval_batch->SetBuffer(desc.validity_idx(), validity_buf + offset / 8);
   ++buffer_idx;
 
   if (desc.HasOffsetsIdx()) {
+    // the offsets are relative to the start of the data buffer, which is shared by
+    // all the slices.
     uint8_t* offsets_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-    eval_batch->SetBuffer(desc.offsets_idx(), offsets_buf);
+    eval_batch->SetBuffer(desc.offsets_idx(), offsets_buf + offset * sizeof(int32_t));
     ++buffer_idx;
   }
 
   uint8_t* data_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
+  if (offset != 0 && !desc.HasOffsetsIdx()) {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*desc.Type());
+    data_buf += offset * fw_type.bit_width() / 8;
+  }
   eval_batch->SetBuffer(desc.data_idx(), data_buf);
   ++buffer_idx;
 }
 
 EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                          const ArrayDataVector& out_vector) {
+  return PrepareEvalBatch(record_batch, out_vector, 0, record_batch.num_rows(), 0);
+}
+
+EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                         const ArrayDataVector& out_vector,
+                                         int64_t in_offset, int64_t num_records,
+                                         int64_t out_offset) {
   EvalBatchPtr eval_batch = std::make_shared<EvalBatch>(
-      record_batch.num_rows(), buffer_count_, local_bitmap_count_);
+      static_cast<int>(num_records), buffer_count_, local_bitmap_count_);
 
   // Fill in the entries for the input fields.
   for (int i = 0; i < record_batch.num_columns(); ++i) {
@@ -92,14 +106,14 @@ EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
     }
 
     PrepareBuffersForField(*(found->second), *(record_batch.column(i))->data(),
-                           eval_batch.get());
+                           in_offset, eval_batch.get());
   }
 
   // Fill in the entries for the output fields.
   int idx = 0;
   for (auto& arraydata : out_vector) {
     const FieldDescriptorPtr& desc = out_descs_.at(idx);
-    PrepareBuffersForField(*desc, *arraydata, eval_batch.get());
+    PrepareBuffersForField(*desc, *arraydata, out_offset, eval_batch.get());
     ++idx;
   }
   return eval_batch;
@@ -51,14 +51,24 @@ class Annotator {
   EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                 const ArrayDataVector& out_vector);
 
+  /// Prepare an eval batch for a slice of the incoming record batch, whose buffers
+  /// point at the records 'in_offset' of the inputs and 'out_offset' of the outputs.
+  /// The offsets must be multiples of 64, so that the bitmaps of the slice start on
+  /// a word boundary.
+  EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                const ArrayDataVector& out_vector, int64_t in_offset,
+                                int64_t num_records, int64_t out_offset);
+
  private:
   /// Annotate a field and return the descriptor.
   FieldDescriptorPtr MakeDesc(FieldPtr field);
 
   /// Populate eval_batch by extracting the raw buffers from the arrow array, whose
   /// contents are represent by the annotated descriptor 'desc'.
+  /// The buffers start at the record 'offset' of the array.
   void PrepareBuffersForField(const FieldDescriptor& desc,
-                              const arrow::ArrayData& array_data, EvalBatch* eval_batch);
+                              const arrow::ArrayData& array_data, int64_t offset,
+                              EvalBatch* eval_batch);
 
   /// The list of input/output buffers (includes bitmap buffers, value buffers and
   /// offset buffers).
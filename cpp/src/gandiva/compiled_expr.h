@@ -24,7 +24,8 @@
 namespace gandiva {
 
 using EvalFunc = int (*)(uint8_t** buffers, uint8_t** local_bitmaps,
-                         int64_t execution_ctx_ptr, int64_t record_count);
+                         const uint8_t* selection_buffer, int64_t execution_ctx_ptr,
+                         int64_t record_count);
 
 /// \brief Tracks the compiled state for one expression.
 class CompiledExpr {
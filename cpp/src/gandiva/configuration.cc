@@ -25,12 +25,18 @@ const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration
     InitDefaultConfig();
 
 std::size_t Configuration::Hash() const {
-  boost::hash<std::string> string_hash;
-  return string_hash(byte_code_file_path_);
+  size_t result = 0;
+  boost::hash_combine(result, byte_code_file_path_);
+  boost::hash_combine(result, object_cache_directory_);
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return other.byte_code_file_path() == byte_code_file_path();
+  return other.byte_code_file_path() == byte_code_file_path() &&
+         other.object_cache_directory() == object_cache_directory() &&
+         other.object_cache_capacity() == object_cache_capacity() &&
+         other.parallel_evaluation() == parallel_evaluation() &&
+         other.slice_size() == slice_size();
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
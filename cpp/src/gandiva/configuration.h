@@ -18,6 +18,7 @@
 #ifndef GANDIVA_CONFIGURATION_H
 #define GANDIVA_CONFIGURATION_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -28,6 +29,12 @@ namespace gandiva {
 extern const char kByteCodeFilePath[];
 extern const char kHelperLibFilePath[];
 
+/// Default size bound of the on-disk cache of compiled code, in bytes.
+constexpr int64_t kDefaultObjectCacheCapacity = 256 * 1024 * 1024;
+
+/// Default number of records of the slices evaluated in parallel.
+constexpr int64_t kDefaultSliceSize = 16 * 1024;
+
 class ConfigurationBuilder;
 /// \brief runtime config for gandiva
 ///
@@ -40,18 +47,40 @@ class Configuration {
   const std::string& byte_code_file_path() const { return byte_code_file_path_; }
   const std::string& helper_lib_file_path() const { return helper_lib_file_path_; }
 
+  /// Directory of the on-disk cache of compiled code, shared across processes.
+  /// Empty if the cache is disabled.
+  const std::string& object_cache_directory() const { return object_cache_directory_; }
+  int64_t object_cache_capacity() const { return object_cache_capacity_; }
+
+  /// Whether batches larger than a slice are split into slices evaluated in
+  /// parallel on the Arrow CPU thread pool.
+  bool parallel_evaluation() const { return parallel_evaluation_; }
+  int64_t slice_size() const { return slice_size_; }
+
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
   bool operator!=(const Configuration& other) const;
 
  private:
   explicit Configuration(const std::string& byte_code_file_path,
-                         const std::string& helper_lib_file_path)
+                         const std::string& helper_lib_file_path,
+                         const std::string& object_cache_directory = "",
+                         int64_t object_cache_capacity = kDefaultObjectCacheCapacity,
+                         bool parallel_evaluation = false,
+                         int64_t slice_size = kDefaultSliceSize)
       : byte_code_file_path_(byte_code_file_path),
-        helper_lib_file_path_(helper_lib_file_path) {}
+        helper_lib_file_path_(helper_lib_file_path),
+        object_cache_directory_(object_cache_directory),
+        object_cache_capacity_(object_cache_capacity),
+        parallel_evaluation_(parallel_evaluation),
+        slice_size_(slice_size) {}
 
   const std::string byte_code_file_path_;
   const std::string helper_lib_file_path_;
+  const std::string object_cache_directory_;
+  const int64_t object_cache_capacity_;
+  const bool parallel_evaluation_;
+  const int64_t slice_size_;
 };
 
 /// \brief configuration builder for gandiva
@@ -62,7 +91,10 @@ class ConfigurationBuilder {
  public:
   ConfigurationBuilder()
       : byte_code_file_path_(kByteCodeFilePath),
-        helper_lib_file_path_(kHelperLibFilePath) {}
+        helper_lib_file_path_(kHelperLibFilePath),
+        object_cache_capacity_(kDefaultObjectCacheCapacity),
+        parallel_evaluation_(false),
+        slice_size_(kDefaultSliceSize) {}
 
   ConfigurationBuilder& set_byte_code_file_path(const std::string& byte_code_file_path) {
     byte_code_file_path_ = byte_code_file_path;
@@ -75,9 +107,39 @@ class ConfigurationBuilder {
     return *this;
   }
 
+  /// Keep the compiled code in a directory, so that other processes building
+  /// the same expressions on the same kind of CPU skip the compilation. The
+  /// directory is created if needed.
+  ConfigurationBuilder& set_object_cache_directory(
+      const std::string& object_cache_directory) {
+    object_cache_directory_ = object_cache_directory;
+    return *this;
+  }
+
+  /// Bound the total size of the files in the object cache directory. The
+  /// least recently used ones are removed beyond it.
+  ConfigurationBuilder& set_object_cache_capacity(int64_t object_cache_capacity) {
+    object_cache_capacity_ = object_cache_capacity;
+    return *this;
+  }
+
+  /// Evaluate the batches larger than a slice in parallel, one slice per task.
+  ConfigurationBuilder& set_parallel_evaluation(bool parallel_evaluation) {
+    parallel_evaluation_ = parallel_evaluation;
+    return *this;
+  }
+
+  /// Set the number of records of the slices evaluated in parallel, rounded up to
+  /// a multiple of 64. The default keeps the slices of a few columns in the cache.
+  ConfigurationBuilder& set_slice_size(int64_t slice_size) {
+    slice_size_ = slice_size;
+    return *this;
+  }
+
   std::shared_ptr<Configuration> build() {
-    std::shared_ptr<Configuration> configuration(
-        new Configuration(byte_code_file_path_, helper_lib_file_path_));
+    std::shared_ptr<Configuration> configuration(new Configuration(
+        byte_code_file_path_, helper_lib_file_path_, object_cache_directory_,
+        object_cache_capacity_, parallel_evaluation_, slice_size_));
     return configuration;
   }
 
@@ -88,6 +150,10 @@ class ConfigurationBuilder {
  private:
   std::string byte_code_file_path_;
   std::string helper_lib_file_path_;
+  std::string object_cache_directory_;
+  int64_t object_cache_capacity_;
+  bool parallel_evaluation_;
+  int64_t slice_size_;
 
   static std::shared_ptr<Configuration> InitDefaultConfig() {
     std::shared_ptr<Configuration> configuration(
@@ -17,22 +17,31 @@
 
 #include "gandiva/engine.h"
 
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include <llvm/ADT/StringMap.h>
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Linker/Linker.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/TargetSelect.h>
+#include <llvm/Target/TargetMachine.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Transforms/IPO.h>
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
@@ -46,6 +55,7 @@ std::once_flag init_once_flag;
 
 bool Engine::init_once_done_ = false;
 std::set<std::string> Engine::loaded_libs_ = {};
+std::map<std::string, std::unique_ptr<llvm::MemoryBuffer>> Engine::byte_code_buffers_;
 std::mutex Engine::mtx_;
 
 // One-time initializations.
@@ -84,9 +94,17 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
     return Status::CodeGenError(engine_obj->llvm_error_);
   }
 
+  if (!config->object_cache_directory().empty()) {
+    auto status = DiskObjectCache::Make(config->object_cache_directory(),
+                                        config->object_cache_capacity(),
+                                        &engine_obj->object_cache_);
+    GANDIVA_RETURN_NOT_OK(status);
+  }
+
   auto status = engine_obj->LoadPreCompiledHelperLibs(config->helper_lib_file_path());
   GANDIVA_RETURN_NOT_OK(status);
 
+  engine_obj->byte_code_file_path_ = config->byte_code_file_path();
   status = engine_obj->LoadPreCompiledIRFiles(config->byte_code_file_path());
   GANDIVA_RETURN_NOT_OK(status);
 
@@ -113,22 +131,38 @@ Status Engine::LoadPreCompiledHelperLibs(const std::string& file_path) {
                                     " failed with error " + std::to_string(err));
 }
 
+Status Engine::GetPreCompiledByteCode(const std::string& byte_code_file_path,
+                                      llvm::MemoryBufferRef* buffer) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto it = byte_code_buffers_.find(byte_code_file_path);
+  if (it == byte_code_buffers_.end()) {
+    /// Read from file into memory buffer, kept for the other engines.
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_or_error =
+        llvm::MemoryBuffer::getFile(byte_code_file_path);
+    if (!buffer_or_error) {
+      std::stringstream ss;
+      ss << "Could not load module from IR " << byte_code_file_path << ": "
+         << buffer_or_error.getError().message();
+      return Status::CodeGenError(ss.str());
+    }
+    it = byte_code_buffers_
+             .insert(std::make_pair(byte_code_file_path, move(buffer_or_error.get())))
+             .first;
+  }
+  *buffer = it->second->getMemBufferRef();
+  return Status::OK();
+}
+
 // Handling for pre-compiled IR libraries.
 Status Engine::LoadPreCompiledIRFiles(const std::string& byte_code_file_path) {
-  /// Read from file into memory buffer.
-  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_or_error =
-      llvm::MemoryBuffer::getFile(byte_code_file_path);
-  if (!buffer_or_error) {
-    std::stringstream ss;
-    ss << "Could not load module from IR " << byte_code_file_path << ": "
-       << buffer_or_error.getError().message();
-    return Status::CodeGenError(ss.str());
-  }
-  std::unique_ptr<llvm::MemoryBuffer> buffer = move(buffer_or_error.get());
+  llvm::MemoryBufferRef buffer;
+  auto status = GetPreCompiledByteCode(byte_code_file_path, &buffer);
+  GANDIVA_RETURN_NOT_OK(status);
 
-  /// Parse the IR module.
+  /// Parse the IR module. The functions are only materialized when they are
+  /// linked into the main module.
   llvm::Expected<std::unique_ptr<llvm::Module>> module_or_error =
-      llvm::getOwningLazyBitcodeModule(move(buffer), *context());
+      llvm::getLazyBitcodeModule(buffer, *context());
   if (!module_or_error) {
     std::string error_string;
     llvm::handleAllErrors(module_or_error.takeError(), [&](llvm::ErrorInfoBase& eib) {
@@ -136,28 +170,96 @@ Status Engine::LoadPreCompiledIRFiles(const std::string& byte_code_file_path) {
     });
     return Status::CodeGenError(error_string);
   }
-  std::unique_ptr<llvm::Module> ir_module = move(module_or_error.get());
+  precompiled_module_ = move(module_or_error.get());
 
   /// Verify the IR module
-  if (llvm::verifyModule(*ir_module, &llvm::errs())) {
+  if (llvm::verifyModule(*precompiled_module_, &llvm::errs())) {
     return Status::CodeGenError("verify of IR Module failed");
   }
+  return Status::OK();
+}
 
-  // Link this to the primary module.
-  if (llvm::Linker::linkModules(*module_, move(ir_module))) {
-    return Status::CodeGenError("failed to link IR Modules");
+bool Engine::DeclarePreCompiledFunction(const std::string& name) {
+  DCHECK(!module_finalized_);
+  llvm::Function* fn = precompiled_module_->getFunction(name);
+  if (fn == nullptr) {
+    return false;
   }
-  return Status::OK();
+  module_->getOrInsertFunction(name, fn->getFunctionType(), fn->getAttributes());
+  return true;
+}
+
+std::string Engine::ObjectCacheKey(bool optimise_ir) const {
+  std::stringstream ss;
+  ss << "llvm " << LLVM_VERSION_STRING << "\n";
+
+  struct stat byte_code_stat;
+  if (stat(byte_code_file_path_.c_str(), &byte_code_stat) == 0) {
+    ss << "byte code " << byte_code_file_path_ << " " << byte_code_stat.st_size << " "
+       << byte_code_stat.st_mtime << "\n";
+  }
+
+  // The code is generated for the target machine of the execution engine, and
+  // may use any of its features.
+  llvm::TargetMachine* target_machine = execution_engine_->getTargetMachine();
+  ss << "target " << target_machine->getTargetTriple().str() << " "
+     << target_machine->getTargetCPU().str() << " "
+     << target_machine->getTargetFeatureString().str() << "\n";
+
+  // The host CPU as well, so that a cache directory shared between machines
+  // never mixes code built for different CPUs.
+  ss << "host " << llvm::sys::getHostCPUName().str();
+  llvm::StringMap<bool> host_features;
+  if (llvm::sys::getHostCPUFeatures(host_features)) {
+    std::vector<std::string> enabled_features;
+    for (auto& feature : host_features) {
+      if (feature.getValue()) {
+        enabled_features.push_back(feature.getKey().str());
+      }
+    }
+    std::sort(enabled_features.begin(), enabled_features.end());
+    for (auto& feature : enabled_features) {
+      ss << " +" << feature;
+    }
+  }
+  ss << "\n";
+
+  ss << "optimise " << optimise_ir << "\n";
+
+  // The IR built in the module, printed in full: any shorter description of
+  // the expressions risks giving two different modules the same key.
+  std::string ir;
+  llvm::raw_string_ostream ir_stream(ir);
+  module_->print(ir_stream, nullptr);
+  ss << ir_stream.str();
+  return ss.str();
 }
 
 // Optimise and compile the module.
 Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
+  // If the code of this module was compiled before, MCJIT loads it from the
+  // object cache and the module needs neither optimisation nor verification.
+  bool cached = false;
+  if (object_cache_ != nullptr && use_object_cache_) {
+    module_->setModuleIdentifier(ObjectCacheKey(optimise_ir));
+    cached = object_cache_->Lookup(module_->getModuleIdentifier());
+    loaded_from_object_cache_ = cached;
+    execution_engine_->setObjectCache(object_cache_.get());
+  }
+
+  // Link the pre-compiled functions used by the module, and the ones they use.
+  // The cached code already contains them.
+  if (!cached && llvm::Linker::linkModules(*module_, move(precompiled_module_),
+                                           llvm::Linker::Flags::LinkOnlyNeeded)) {
+    return Status::CodeGenError("failed to link IR Modules");
+  }
+
   if (dump_ir) {
     DumpIR("Before optimise");
   }
 
   // Setup an optimiser pipeline
-  if (optimise_ir) {
+  if (optimise_ir && !cached) {
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
 
@@ -203,7 +305,7 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
     }
   }
 
-  if (llvm::verifyModule(*module_, &llvm::errs())) {
+  if (!cached && llvm::verifyModule(*module_, &llvm::errs())) {
     return Status::CodeGenError("verify of module failed after optimisation passes");
   }
 
@@ -18,6 +18,7 @@
 #ifndef GANDIVA_ENGINE_H
 #define GANDIVA_ENGINE_H
 
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -27,11 +28,13 @@
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include "arrow/util/macros.h"
 
 #include "gandiva/configuration.h"
 #include "gandiva/logging.h"
+#include "gandiva/object_cache.h"
 #include "gandiva/status.h"
 
 namespace gandiva {
@@ -57,6 +60,24 @@ class Engine {
     functions_to_compile_.push_back(fname);
   }
 
+  /// Declare a function of the pre-compiled IR in the module. Only the functions
+  /// declared this way are linked into the module when it is finalized.
+  ///
+  /// \return false if there is no pre-compiled function with that name.
+  bool DeclarePreCompiledFunction(const std::string& name);
+
+  /// Reuse the code compiled for the module by earlier engines, possibly in
+  /// other processes, if the configuration enables the object cache. The code
+  /// is cached under the full IR of the module, so the IR must not embed
+  /// addresses of this process.
+  void EnableObjectCache() {
+    DCHECK(!module_finalized_);
+    use_object_cache_ = true;
+  }
+
+  /// Whether the code of the finalized module was loaded from the object cache.
+  bool loaded_from_object_cache() const { return loaded_from_object_cache_; }
+
   /// Optimise and compile the module.
   Status FinalizeModule(bool optimise_ir, bool dump_ir);
 
@@ -73,7 +94,10 @@ class Engine {
  private:
   /// private constructor to ensure engine is created
   /// only through the factory.
-  Engine() : module_finalized_(false) {}
+  Engine()
+      : module_finalized_(false),
+        use_object_cache_(false),
+        loaded_from_object_cache_(false) {}
 
   /// do one time inits.
   static void InitOnce();
@@ -84,24 +108,42 @@ class Engine {
   /// load pre-compiled so libraries and merge them into the main module.
   Status LoadPreCompiledHelperLibs(const std::string& helper_lib_file_path);
 
-  /// load pre-compiled IR modules and merge them into the main module.
+  /// load the pre-compiled IR module, without materializing its functions.
   Status LoadPreCompiledIRFiles(const std::string& byte_code_file_path);
 
+  /// read the pre-compiled IR file, only once per process.
+  static Status GetPreCompiledByteCode(const std::string& byte_code_file_path,
+                                       llvm::MemoryBufferRef* buffer);
+
   /// dump the IR code to stdout with the prefix string.
   void DumpIR(std::string prefix);
 
+  /// the key of the compiled code in the object cache: the IR of the module,
+  /// the version of LLVM and of the pre-compiled IR, and the target machine.
+  std::string ObjectCacheKey(bool optimise_ir) const;
+
   std::unique_ptr<llvm::LLVMContext> context_;
+  // Used by the execution engine while compiling, so destroyed after it.
+  std::unique_ptr<DiskObjectCache> object_cache_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
   llvm::Module* module_;  // This is owned by the execution_engine_, so doesn't need to be
                           // explicitly deleted.
+  // The pre-compiled IR, loaded lazily. The functions declared in module_ are
+  // linked from it when the module is finalized.
+  std::unique_ptr<llvm::Module> precompiled_module_;
 
   std::vector<std::string> functions_to_compile_;
 
   bool module_finalized_;
   std::string llvm_error_;
 
+  std::string byte_code_file_path_;
+  bool use_object_cache_;
+  bool loaded_from_object_cache_;
+
   static std::set<std::string> loaded_libs_;
+  static std::map<std::string, std::unique_ptr<llvm::MemoryBuffer>> byte_code_buffers_;
   static std::mutex mtx_;
 };
 
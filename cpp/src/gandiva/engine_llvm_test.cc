@@ -17,6 +17,12 @@
 
 #include "gandiva/engine.h"
 
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+
 #include <gtest/gtest.h>
 #include "gandiva/llvm_types.h"
 
@@ -26,10 +32,31 @@ typedef int64_t (*add_vector_func_t)(int64_t* elements, int nelements);
 
 class TestEngine : public ::testing::Test {
  protected:
-  llvm::Function* BuildVecAdd(Engine* engine, LLVMTypes* types);
+  llvm::Function* BuildVecAdd(Engine* engine, LLVMTypes* types,
+                              const std::string& func_name = "add_longs");
+
+  // Build and run the vector add with an object cache in the directory, and
+  // check whether its code was loaded from the cache.
+  void RunVecAddWithObjectCache(const std::string& directory, int64_t capacity,
+                                const std::string& func_name, bool expect_loaded);
 };
 
-llvm::Function* TestEngine::BuildVecAdd(Engine* engine, LLVMTypes* types) {
+// Number of compiled objects in the directory.
+static int CountObjectFiles(const std::string& directory) {
+  int count = 0;
+  DIR* dir = opendir(directory.c_str());
+  for (struct dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name.size() > 2 && name.compare(name.size() - 2, 2, ".o") == 0) {
+      ++count;
+    }
+  }
+  closedir(dir);
+  return count;
+}
+
+llvm::Function* TestEngine::BuildVecAdd(Engine* engine, LLVMTypes* types,
+                                        const std::string& func_name) {
   llvm::IRBuilder<>& builder = engine->ir_builder();
   llvm::LLVMContext* context = engine->context();
 
@@ -42,7 +69,6 @@ llvm::Function* TestEngine::BuildVecAdd(Engine* engine, LLVMTypes* types) {
       llvm::FunctionType::get(types->i64_type(), arguments, false /*isVarArg*/);
 
   // Create fn
-  std::string func_name = "add_longs";
   engine->AddFunctionToCompile(func_name);
   llvm::Function* fn = llvm::Function::Create(
       prototype, llvm::GlobalValue::ExternalLinkage, func_name, engine->module());
@@ -126,6 +152,52 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+void TestEngine::RunVecAddWithObjectCache(const std::string& directory,
+                                          int64_t capacity,
+                                          const std::string& func_name,
+                                          bool expect_loaded) {
+  auto config = ConfigurationBuilder()
+                    .set_object_cache_directory(directory)
+                    .set_object_cache_capacity(capacity)
+                    .build();
+  std::unique_ptr<Engine> engine;
+  ASSERT_TRUE(Engine::Make(config, &engine).ok());
+  LLVMTypes types(*engine->context());
+  llvm::Function* ir_func = BuildVecAdd(engine.get(), &types, func_name);
+  engine->EnableObjectCache();
+  ASSERT_TRUE(engine->FinalizeModule(true, false).ok());
+  EXPECT_EQ(engine->loaded_from_object_cache(), expect_loaded);
+
+  add_vector_func_t add_func =
+      reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+  EXPECT_EQ(add_func(my_array, 5), 17);
+}
+
+TEST_F(TestEngine, TestObjectCache) {
+  char directory[] = "/tmp/gandiva-object-cache-XXXXXX";
+  ASSERT_NE(mkdtemp(directory), nullptr);
+
+  // the first engine compiles the module and writes its object, the second one
+  // loads it.
+  RunVecAddWithObjectCache(directory, kDefaultObjectCacheCapacity, "add_longs", false);
+  EXPECT_EQ(CountObjectFiles(directory), 1);
+  RunVecAddWithObjectCache(directory, kDefaultObjectCacheCapacity, "add_longs", true);
+  EXPECT_EQ(CountObjectFiles(directory), 1);
+
+  // a module with a different IR gets its own object.
+  RunVecAddWithObjectCache(directory, kDefaultObjectCacheCapacity, "add_longs_again",
+                           false);
+  EXPECT_EQ(CountObjectFiles(directory), 2);
+
+  // a new object beyond the capacity evicts all of them.
+  RunVecAddWithObjectCache(directory, 1, "add_longs_once_more", false);
+  EXPECT_EQ(CountObjectFiles(directory), 0);
+
+  ASSERT_EQ(rmdir(directory), 0);
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -17,12 +17,18 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bit-util.h"
+#include "arrow/util/thread-pool.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
@@ -38,7 +44,13 @@ namespace gandiva {
   }
 
 LLVMGenerator::LLVMGenerator()
-    : dump_ir_(false), optimise_ir_(true), enable_ir_traces_(false) {}
+    : selection_vector_mode_(SelectionVector::MODE_NONE),
+      embeds_addresses_(false),
+      parallel_evaluation_(false),
+      slice_size_(kDefaultSliceSize),
+      dump_ir_(false),
+      optimise_ir_(true),
+      enable_ir_traces_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
@@ -46,6 +58,9 @@ Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
   Status status = Engine::Make(config, &(llvmgen_obj->engine_));
   GANDIVA_RETURN_NOT_OK(status);
   llvmgen_obj->types_.reset(new LLVMTypes(*(llvmgen_obj->engine_)->context()));
+  llvmgen_obj->parallel_evaluation_ = config->parallel_evaluation();
+  // the slices start on a word of the bitmaps.
+  llvmgen_obj->slice_size_ = std::max<int64_t>(64, (config->slice_size() + 63) / 64 * 64);
   *llvm_generator = std::move(llvmgen_obj);
   return Status::OK();
 }
@@ -71,8 +86,10 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
 }
 
 /// Build and optimise module for projection expression.
-Status LLVMGenerator::Build(const ExpressionVector& exprs) {
+Status LLVMGenerator::Build(const ExpressionVector& exprs,
+                            SelectionVector::Mode selection_vector_mode) {
   Status status;
+  selection_vector_mode_ = selection_vector_mode;
 
   for (auto& expr : exprs) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
@@ -80,6 +97,12 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs) {
     GANDIVA_RETURN_NOT_OK(status);
   }
 
+  // the compiled code is cached under the IR, which is only valid in another
+  // process if it doesn't embed addresses of this one.
+  if (!embeds_addresses_) {
+    engine_->EnableObjectCache();
+  }
+
   // optimise, compile and finalize the module
   status = engine_->FinalizeModule(optimise_ir_, dump_ir_);
   GANDIVA_RETURN_NOT_OK(status);
@@ -96,22 +119,102 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs) {
 /// Execute the compiled module against the provided vectors.
 Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
+  return Execute(record_batch, nullptr, output_vector);
+}
+
+/// Execute the compiled module against the selected records.
+Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
+                              const SelectionVector* selection_vector,
+                              const ArrayDataVector& output_vector) {
   DCHECK_GT(record_batch.num_rows(), 0);
 
-  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
+  int64_t num_output_records = record_batch.num_rows();
+  if (selection_vector != nullptr) {
+    DCHECK_EQ(selection_vector->GetMode(), selection_vector_mode_);
+    DCHECK(selection_vector->ValidateIndices(record_batch.num_rows()).ok());
+    num_output_records = selection_vector->GetNumSlots();
+  } else {
+    DCHECK_EQ(selection_vector_mode_, SelectionVector::MODE_NONE);
+  }
+
+  int64_t num_slices = (num_output_records + slice_size_ - 1) / slice_size_;
+  auto pool = arrow::internal::GetCpuThreadPool();
+  // A caller running on the pool would wait for tasks which may never get a
+  // free worker, so it evaluates the batch by itself.
+  if (!parallel_evaluation_ || num_slices <= 1 || pool->GetCapacity() <= 1 ||
+      pool->OwnsThisThread()) {
+    return ExecuteSlice(record_batch, selection_vector, output_vector, 0,
+                        num_output_records);
+  }
+
+  // The slices write disjoint ranges of the outputs, whose bitmaps start on a
+  // word boundary. The tasks and this thread take the next slice until none is
+  // left, so a slow task doesn't delay the others.
+  std::atomic<int64_t> next_slice(0);
+  auto execute_slices = [&]() {
+    Status status;
+    for (int64_t slice = next_slice++; slice < num_slices; slice = next_slice++) {
+      int64_t offset = slice * slice_size_;
+      int64_t length = std::min(slice_size_, num_output_records - offset);
+      Status s =
+          ExecuteSlice(record_batch, selection_vector, output_vector, offset, length);
+      if (status.ok()) {
+        status = s;
+      }
+    }
+    return status;
+  };
+
+  int64_t num_tasks = std::min<int64_t>(num_slices, pool->GetCapacity()) - 1;
+  std::vector<std::future<Status>> futures;
+  for (int64_t i = 0; i < num_tasks; ++i) {
+    futures.push_back(pool->Submit(execute_slices));
+  }
+  Status status = execute_slices();
+  // wait for all the tasks, since they refer to the arguments.
+  for (auto& future : futures) {
+    Status s = future.get();
+    if (status.ok()) {
+      status = s;
+    }
+  }
+  return status;
+}
+
+Status LLVMGenerator::ExecuteSlice(const arrow::RecordBatch& record_batch,
+                                   const SelectionVector* selection_vector,
+                                   const ArrayDataVector& output_vector,
+                                   int64_t offset, int64_t length) {
+  const uint8_t* selection_buffer = nullptr;
+  EvalBatchPtr eval_batch;
+  if (selection_vector != nullptr) {
+    // the selected records can be anywhere in the batch.
+    int index_size = selection_vector_mode_ == SelectionVector::MODE_UINT16
+                         ? sizeof(uint16_t)
+                         : sizeof(uint32_t);
+    selection_buffer = selection_vector->GetBuffer().data() + offset * index_size;
+    eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector, 0,
+                                             record_batch.num_rows(), offset);
+  } else {
+    eval_batch =
+        annotator_.PrepareEvalBatch(record_batch, output_vector, offset, length, offset);
+  }
   DCHECK_GT(eval_batch->GetNumBuffers(), 0);
 
   for (auto& compiled_expr : compiled_exprs_) {
-    // generate data/offset vectors.
-    EvalFunc jit_function = compiled_expr->jit_function();
-    jit_function(eval_batch->GetBufferArray(), eval_batch->GetLocalBitMapArray(),
-                 (int64_t)eval_batch->GetExecutionContext(), record_batch.num_rows());
+    // generate data/offset vectors. The generated loop runs at least once.
+    if (length > 0) {
+      EvalFunc jit_function = compiled_expr->jit_function();
+      jit_function(eval_batch->GetBufferArray(), eval_batch->GetLocalBitMapArray(),
+                   selection_buffer, (int64_t)eval_batch->GetExecutionContext(),
+                   length);
+    }
     // check for execution errors
     if (eval_batch->GetExecutionContext()->has_error()) {
       return Status::ExecutionError(eval_batch->GetExecutionContext()->get_error());
     }
     // generate validity vectors.
-    ComputeBitMapsForExpr(*compiled_expr, *eval_batch);
+    ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector, offset, length);
   }
   return Status::OK();
 }
@@ -169,7 +272,7 @@ llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, in
 //
 // The C-code equivalent is :
 // ------------------------------
-// int expr_0(int64_t *addrs, int64_t *local_bitmaps,
+// int expr_0(int64_t *addrs, int64_t *local_bitmaps, uint8_t *selection_vector,
 //            int64_t execution_context_ptr, int64_t nrecords) {
 //   int *outVec = (int *) addrs[5];
 //   int *c0Vec = (int *) addrs[1];
@@ -182,11 +285,14 @@ llvm::Value* LLVMGenerator::GetLocalBitMapReference(llvm::Value* arg_bitmaps, in
 //   }
 // }
 //
+// With a selection vector, nrecords is the number of selected records, and the
+// inputs are read at position = selection_vector[loop_var] instead of loop_var.
+//
 // IR Code
 // --------
 //
-// define i32 @expr_0(i64* %args, i64* %local_bitmaps, i64 %execution_context_ptr, , i64
-// %nrecords) { entry:
+// define i32 @expr_0(i64* %args, i64* %local_bitmaps, i8* %selection_vector,
+// i64 %execution_context_ptr, , i64 %nrecords) { entry:
 //   %outmemAddr = getelementptr i64, i64* %args, i32 5
 //   %outmem = load i64, i64* %outmemAddr
 //   %outVec = inttoptr i64 %outmem to i32*
@@ -218,10 +324,12 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   llvm::IRBuilder<>& builder = ir_builder();
 
   // Create fn prototype :
-  //   int expr_1 (long **addrs, long **bitmaps, long *context_ptr, long nrec)
+  //   int expr_1 (long **addrs, long **bitmaps, char *selection_vector,
+  //               long *context_ptr, long nrec)
   std::vector<llvm::Type*> arguments;
   arguments.push_back(types_->i64_ptr_type());
   arguments.push_back(types_->i64_ptr_type());
+  arguments.push_back(types_->i8_ptr_type());
   arguments.push_back(types_->i64_type());
   arguments.push_back(types_->i64_type());
   llvm::FunctionType* prototype =
@@ -242,6 +350,9 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   llvm::Value* arg_local_bitmaps = &*args;
   arg_local_bitmaps->setName("local_bitmaps");
   ++args;
+  llvm::Value* arg_selection_vector = &*args;
+  arg_selection_vector->setName("selection_vector");
+  ++args;
   llvm::Value* arg_context_ptr = &*args;
   arg_context_ptr->setName("context_ptr");
   ++args;
@@ -256,6 +367,14 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   builder.SetInsertPoint(loop_entry);
   llvm::Value* output_ref =
       GetDataReference(arg_addrs, output->data_idx(), output->field());
+  llvm::Value* selection_ref = nullptr;
+  if (selection_vector_mode_ == SelectionVector::MODE_UINT16) {
+    selection_ref = builder.CreateBitCast(
+        arg_selection_vector, types_->ptr_type(types_->i16_type()), "selection_array");
+  } else if (selection_vector_mode_ == SelectionVector::MODE_UINT32) {
+    selection_ref = builder.CreateBitCast(arg_selection_vector, types_->i32_ptr_type(),
+                                          "selection_array");
+  }
 
   // Loop body
   builder.SetInsertPoint(loop_body);
@@ -263,9 +382,18 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   // define loop_var : start with 0, +1 after each iter
   llvm::PHINode* loop_var = builder.CreatePHI(types_->i64_type(), 2, "loop_var");
 
+  // the position of the record to read : the loop_var, or the index in the
+  // selection vector. The output is always written at loop_var.
+  llvm::Value* position_var = loop_var;
+  if (selection_ref != nullptr) {
+    llvm::Value* slot = builder.CreateGEP(selection_ref, loop_var);
+    position_var = builder.CreateZExt(builder.CreateLoad(slot, "selection_index"),
+                                      types_->i64_type(), "position_var");
+  }
+
   // The visitor can add code to both the entry/loop blocks.
   Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, arg_context_ptr,
-                  loop_var);
+                  position_var);
   value_expr->Accept(visitor);
   LValuePtr output_value = visitor.result();
 
@@ -337,7 +465,9 @@ void LLVMGenerator::ClearPackedBitValueIfFalse(llvm::Value* bitmap, llvm::Value*
 
 /// Extract the bitmap addresses, and do an intersection.
 void LLVMGenerator::ComputeBitMapsForExpr(const CompiledExpr& compiled_expr,
-                                          const EvalBatch& eval_batch) {
+                                          const EvalBatch& eval_batch,
+                                          const SelectionVector* selection_vector,
+                                          int64_t offset, int64_t length) {
   auto validities = compiled_expr.value_validity()->validity_exprs();
 
   // Extract all the source bitmap addresses.
@@ -351,7 +481,23 @@ void LLVMGenerator::ComputeBitMapsForExpr(const CompiledExpr& compiled_expr,
   uint8_t* dst_bitmap = eval_batch.GetBuffer(out_idx);
 
   // Compute the destination bitmap.
-  accumulator.ComputeResult(dst_bitmap);
+  if (selection_vector == nullptr) {
+    accumulator.ComputeResult(dst_bitmap);
+    return;
+  }
+
+  // The source bitmaps have one bit per record of the batch. Intersect them in
+  // a temporary bitmap, then copy the bits of the selected records.
+  LocalBitMapsHolder bitmap_holder(eval_batch.num_records(), 1);
+  uint8_t* batch_bitmap = bitmap_holder.GetLocalBitMap(0);
+  accumulator.ComputeResult(batch_bitmap);
+
+  for (int64_t i = 0; i < length; ++i) {
+    arrow::BitUtil::SetBitTo(
+        dst_bitmap, i,
+        arrow::BitUtil::GetBit(batch_bitmap,
+                               selection_vector->GetIndex(static_cast<int>(offset + i))));
+  }
 }
 
 void LLVMGenerator::CheckAndAddPrototype(const std::string& full_name,
@@ -363,6 +509,11 @@ void LLVMGenerator::CheckAndAddPrototype(const std::string& full_name,
     return;
   }
 
+  if (engine_->DeclarePreCompiledFunction(full_name)) {
+    // the definition is linked in when the module is finalized.
+    return;
+  }
+
   // must be a function in the helper library.
   DCHECK_EQ(engine_->CheckFunctionFromLoadedLib(full_name), true)
       << "missing cpp function in library " + full_name;
@@ -556,8 +707,14 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = boost::get<std::string>(dex.holder());
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
-      value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
+      // copy the string into the module, so that the code doesn't depend on the
+      // address of the expression.
+      llvm::Constant* str_constant =
+          llvm::ConstantDataArray::getString(generator_->context(), str);
+      auto str_global = new llvm::GlobalVariable(
+          *module(), str_constant->getType(), true /*isConstant*/,
+          llvm::GlobalValue::PrivateLinkage, str_constant, "str_literal");
+      value = llvm::ConstantExpr::getPointerCast(str_global, types->i8_ptr_type());
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
     }
@@ -880,6 +1037,7 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer first.
   if (holder != nullptr) {
+    generator_->embeds_addresses_ = true;
     llvm::Constant* ptr_int_cast = types->i64_constant((int64_t)holder);
     auto ptr = llvm::ConstantExpr::getIntToPtr(ptr_int_cast, types->i8_ptr_type());
     params.push_back(ptr);
@@ -1030,6 +1188,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
   trace_strings_.push_back(dmsg);
 
   // cast this to an llvm pointer.
+  embeds_addresses_ = true;
   const char* str = trace_strings_.back().c_str();
   llvm::Constant* str_int_cast = types_->i64_constant((int64_t)str);
   llvm::Constant* str_ptr_cast =
@@ -37,6 +37,7 @@
 #include "gandiva/gandiva_aliases.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/lvalue.h"
+#include "gandiva/selection_vector.h"
 #include "gandiva/value_validity_pair.h"
 
 namespace gandiva {
@@ -52,12 +53,27 @@ class LLVMGenerator {
 
   /// \brief Build the code for the expression trees. Each element in the vector
   /// represents an expression tree
-  Status Build(const ExpressionVector& exprs);
+  ///
+  /// \param[in] : selection_vector_mode the type of the selection vectors given
+  ///              to Execute(), or MODE_NONE to evaluate all the records.
+  Status Build(const ExpressionVector& exprs,
+               SelectionVector::Mode selection_vector_mode = SelectionVector::MODE_NONE);
 
   /// \brief Execute the built expression against the provided arguments.
   Status Execute(const arrow::RecordBatch& record_batch,
                  const ArrayDataVector& output_vector);
 
+  /// \brief Execute the built expression against the records of the selection
+  /// vector, which must have the mode given to Build() and only indices of records
+  /// in the batch (see SelectionVector::ValidateIndices). The outputs have one slot
+  /// per selected record.
+  ///
+  /// With parallel evaluation, the output records are split into slices which are
+  /// evaluated on the Arrow CPU thread pool.
+  Status Execute(const arrow::RecordBatch& record_batch,
+                 const SelectionVector* selection_vector,
+                 const ArrayDataVector& output_vector);
+
   LLVMTypes& types() { return *types_; }
   llvm::Module* module() { return engine_->module(); }
 
@@ -67,6 +83,7 @@ class LLVMGenerator {
   FRIEND_TEST(TestLLVMGenerator, VerifyPCFunctions);
   FRIEND_TEST(TestLLVMGenerator, TestAdd);
   FRIEND_TEST(TestLLVMGenerator, TestNullInternal);
+  FRIEND_TEST(TestLLVMGenerator, TestObjectCacheKey);
 
   llvm::LLVMContext& context() { return *(engine_->context()); }
   llvm::IRBuilder<>& ir_builder() { return engine_->ir_builder(); }
@@ -176,13 +193,24 @@ class LLVMGenerator {
   llvm::Value* AddFunctionCall(const std::string& full_name, llvm::Type* ret_type,
                                const std::vector<llvm::Value*>& args);
 
+  /// Execute the built expressions for the output records [offset, offset + length),
+  /// whose bitmaps start on a word boundary.
+  Status ExecuteSlice(const arrow::RecordBatch& record_batch,
+                      const SelectionVector* selection_vector,
+                      const ArrayDataVector& output_vector, int64_t offset,
+                      int64_t length);
+
   /// Compute the result bitmap for the expression.
   ///
   /// \param[in] : the compiled expression (includes the bitmap indices to be used for
   ///              computing the validity bitmap of the result).
   /// \param[in] : eval_batch (includes input/output buffer addresses)
+  /// \param[in] : selection_vector the selected records, or null for all of them.
+  /// \param[in] : offset, length the slots of the selection vector of the eval_batch.
   void ComputeBitMapsForExpr(const CompiledExpr& compiled_expr,
-                             const EvalBatch& eval_batch);
+                             const EvalBatch& eval_batch,
+                             const SelectionVector* selection_vector, int64_t offset,
+                             int64_t length);
 
   /// Replace the %T in the trace msg with the correct type corresponding to 'type'
   /// eg. %d for int32, %ld for int64, ..
@@ -198,6 +226,16 @@ class LLVMGenerator {
   FunctionRegistry function_registry_;
   Annotator annotator_;
 
+  SelectionVector::Mode selection_vector_mode_;
+
+  // the code embeds the addresses of objects of this process (function holders,
+  // trace messages), so it can't be reused through the object cache.
+  bool embeds_addresses_;
+
+  // split the batches into slices of slice_size_ records, evaluated in parallel.
+  bool parallel_evaluation_;
+  int64_t slice_size_;
+
   // used for debug
   bool dump_ir_;
   bool optimise_ir_;
@@ -17,7 +17,12 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -26,6 +31,7 @@
 #include "gandiva/expression.h"
 #include "gandiva/func_descriptor.h"
 #include "gandiva/function_registry.h"
+#include "gandiva/tree_expr_builder.h"
 
 namespace gandiva {
 
@@ -46,11 +52,10 @@ TEST_F(TestLLVMGenerator, VerifyPCFunctions) {
   llvm::Module* module = generator->module();
   for (auto& iter : registry_) {
     bool found = false;
-    llvm::Function* fn = module->getFunction(iter.pc_name());
-    if (fn == nullptr) {
-      found = generator->engine_->CheckFunctionFromLoadedLib(iter.pc_name());
+    if (generator->engine_->DeclarePreCompiledFunction(iter.pc_name())) {
+      found = module->getFunction(iter.pc_name()) != nullptr;
     } else {
-      found = true;
+      found = generator->engine_->CheckFunctionFromLoadedLib(iter.pc_name());
     }
     EXPECT_EQ(found, true) << "function " << iter.pc_name()
                            << " missing in precompiled module\n";
@@ -112,7 +117,7 @@ TEST_F(TestLLVMGenerator, TestAdd) {
       reinterpret_cast<uint8_t*>(a1),  reinterpret_cast<uint8_t*>(&in_bitmap),
       reinterpret_cast<uint8_t*>(out), reinterpret_cast<uint8_t*>(&out_bitmap),
   };
-  eval_func(addrs, nullptr, 0 /* dummy context ptr */, num_records);
+  eval_func(addrs, nullptr, nullptr, 0 /* dummy context ptr */, num_records);
 
   uint32_t expected[] = {6, 8, 10, 12};
   for (int i = 0; i < num_records; i++) {
@@ -179,7 +184,8 @@ TEST_F(TestLLVMGenerator, TestNullInternal) {
       reinterpret_cast<uint8_t*>(&local_bitmap),
   };
 
-  eval_func(addrs, local_bitmap_addrs, 0 /* dummy context ptr */, num_records);
+  eval_func(addrs, local_bitmap_addrs, nullptr, 0 /* dummy context ptr */,
+            num_records);
 
   uint32_t expected_value[] = {0, 1, 0, 2};
   bool expected_validity[] = {false, true, false, true};
@@ -190,6 +196,49 @@ TEST_F(TestLLVMGenerator, TestNullInternal) {
   }
 }
 
+// Expressions printed the same way must still get their own compiled code.
+TEST_F(TestLLVMGenerator, TestObjectCacheKey) {
+  char directory[] = "/tmp/gandiva-object-cache-XXXXXX";
+  ASSERT_NE(mkdtemp(directory), nullptr);
+  auto config = ConfigurationBuilder().set_object_cache_directory(directory).build();
+
+  auto a = TreeExprBuilder::MakeField(arrow::field("a", arrow::boolean()));
+  auto b = TreeExprBuilder::MakeField(arrow::field("b", arrow::boolean()));
+  auto c = TreeExprBuilder::MakeField(arrow::field("c", arrow::boolean()));
+  auto result = arrow::field("res", arrow::boolean());
+  auto and_of_or = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeAnd({TreeExprBuilder::MakeOr({a, b}), c}), result);
+  auto or_of_and = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeOr({a, TreeExprBuilder::MakeAnd({b, c})}), result);
+  ASSERT_EQ(and_of_or->ToString(), or_of_and->ToString());
+
+  auto build = [&config](const ExpressionPtr& expr, bool* loaded) {
+    std::unique_ptr<LLVMGenerator> generator;
+    ASSERT_TRUE(LLVMGenerator::Make(config, &generator).ok());
+    ASSERT_TRUE(generator->Build({expr}, SelectionVector::MODE_NONE).ok());
+    *loaded = generator->engine_->loaded_from_object_cache();
+  };
+  bool loaded;
+  build(and_of_or, &loaded);
+  EXPECT_FALSE(loaded);
+  build(or_of_and, &loaded);
+  EXPECT_FALSE(loaded);
+  build(and_of_or, &loaded);
+  EXPECT_TRUE(loaded);
+  build(or_of_and, &loaded);
+  EXPECT_TRUE(loaded);
+
+  DIR* dir = opendir(directory);
+  for (struct dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+    std::string name = entry->d_name;
+    if (name != "." && name != "..") {
+      ASSERT_EQ(unlink((std::string(directory) + "/" + name).c_str()), 0);
+    }
+  }
+  closedir(dir);
+  ASSERT_EQ(rmdir(directory), 0);
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
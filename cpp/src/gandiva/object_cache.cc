@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "gandiva/object_cache.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <llvm/IR/Module.h>
+
+namespace gandiva {
+
+static const char kObjectFileSuffix[] = ".o";
+
+Status DiskObjectCache::Make(const std::string& directory, int64_t capacity,
+                             std::unique_ptr<DiskObjectCache>* cache) {
+  if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+    std::stringstream ss;
+    ss << "could not create the object cache directory " << directory << ": "
+       << strerror(errno);
+    return Status::Invalid(ss.str());
+  }
+  cache->reset(new DiskObjectCache(directory, capacity));
+  return Status::OK();
+}
+
+std::string DiskObjectCache::FilePath(const std::string& key) const {
+  std::stringstream ss;
+  ss << directory_ << "/" << std::hex << std::hash<std::string>()(key)
+     << kObjectFileSuffix;
+  return ss.str();
+}
+
+bool DiskObjectCache::Lookup(const std::string& key) {
+  key_.clear();
+  object_.reset();
+
+  std::string path = FilePath(key);
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer_or_error =
+      llvm::MemoryBuffer::getFile(path);
+  if (!buffer_or_error) {
+    return false;
+  }
+
+  // The file holds the size of the key, the key and then the object.
+  llvm::StringRef contents = buffer_or_error.get()->getBuffer();
+  uint64_t key_size;
+  if (contents.size() < sizeof(key_size)) {
+    return false;
+  }
+  memcpy(&key_size, contents.data(), sizeof(key_size));
+  if (key_size != key.size() || contents.size() < sizeof(key_size) + key_size ||
+      contents.substr(sizeof(key_size), key_size) != key) {
+    return false;
+  }
+
+  // Copy the object, since the file may be mapped and the object loader needs
+  // it to be aligned.
+  object_ = llvm::MemoryBuffer::getMemBufferCopy(
+      contents.substr(sizeof(key_size) + key_size), path);
+  key_ = key;
+
+  // Mark the file as recently used for the eviction.
+  utime(path.c_str(), nullptr);
+  return true;
+}
+
+std::unique_ptr<llvm::MemoryBuffer> DiskObjectCache::getObject(
+    const llvm::Module* module) {
+  if (object_ == nullptr || module->getModuleIdentifier() != key_) {
+    return nullptr;
+  }
+  return std::move(object_);
+}
+
+void DiskObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                           llvm::MemoryBufferRef object) {
+  Write(module->getModuleIdentifier(), object.getBuffer());
+}
+
+void DiskObjectCache::Write(const std::string& key, llvm::StringRef object) {
+  std::string path = FilePath(key);
+  std::stringstream tmp_path;
+  tmp_path << path << ".tmp." << getpid() << "."
+           << std::hash<std::thread::id>()(std::this_thread::get_id());
+
+  {
+    std::ofstream out(tmp_path.str(), std::ios::binary | std::ios::trunc);
+    uint64_t key_size = key.size();
+    out.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    out.write(key.data(), key.size());
+    out.write(object.data(), object.size());
+    out.close();
+    // Readers only ever see complete files, since the rename is atomic.
+    if (!out || rename(tmp_path.str().c_str(), path.c_str()) != 0) {
+      unlink(tmp_path.str().c_str());
+      return;
+    }
+  }
+  Evict();
+}
+
+void DiskObjectCache::Evict() {
+  struct CachedFile {
+    std::string path;
+    int64_t size;
+    time_t last_used;
+  };
+
+  DIR* dir = opendir(directory_.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+  std::vector<CachedFile> files;
+  int64_t total_size = 0;
+  const size_t suffix_length = strlen(kObjectFileSuffix);
+  for (struct dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+    // Skip the files being written by other processes.
+    std::string name = entry->d_name;
+    if (name.size() <= suffix_length ||
+        name.compare(name.size() - suffix_length, suffix_length, kObjectFileSuffix) !=
+            0) {
+      continue;
+    }
+    std::string path = directory_ + "/" + name;
+    struct stat file_stat;
+    if (stat(path.c_str(), &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+      continue;
+    }
+    files.push_back({path, static_cast<int64_t>(file_stat.st_size), file_stat.st_mtime});
+    total_size += file_stat.st_size;
+  }
+  closedir(dir);
+
+  if (total_size <= capacity_) {
+    return;
+  }
+  std::sort(files.begin(), files.end(), [](const CachedFile& a, const CachedFile& b) {
+    return a.last_used < b.last_used;
+  });
+  for (const auto& file : files) {
+    if (total_size <= capacity_) {
+      break;
+    }
+    // Another process may have removed the file already.
+    unlink(file.path.c_str());
+    total_size -= file.size;
+  }
+}
+
+}  // namespace gandiva
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#ifndef GANDIVA_OBJECT_CACHE_H
+#define GANDIVA_OBJECT_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include "gandiva/status.h"
+
+namespace gandiva {
+
+/// \brief Cache of the machine code of the modules, kept in the files of a
+/// local directory so that it outlives the process.
+///
+/// The files are named after a hash of the key of their module, and start with
+/// the key itself so that collisions are detected. They are written to a
+/// temporary file first and then renamed, so several processes can share the
+/// directory. Beyond the capacity, the least recently used files are removed.
+///
+/// The engine looks up the object of a module before compiling it, so that the
+/// optimisation passes are skipped on a hit, and MCJIT then takes the object
+/// through the llvm::ObjectCache interface instead of generating code. On a
+/// miss, MCJIT hands over the object it generated to be written.
+class DiskObjectCache : public llvm::ObjectCache {
+ public:
+  /// Create a cache in a directory, which is created if needed.
+  static Status Make(const std::string& directory, int64_t capacity,
+                     std::unique_ptr<DiskObjectCache>* cache);
+
+  /// Look up the object compiled for the key, and keep it for the module with
+  /// that identifier. Returns true on a hit.
+  bool Lookup(const std::string& key);
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+ private:
+  DiskObjectCache(const std::string& directory, int64_t capacity)
+      : directory_(directory), capacity_(capacity) {}
+
+  std::string FilePath(const std::string& key) const;
+
+  /// Write the object of the key, then evict files beyond the capacity. The
+  /// cache is only an optimisation, so failures are ignored.
+  void Write(const std::string& key, llvm::StringRef object);
+
+  /// Remove the least recently used files until the directory fits in the
+  /// capacity.
+  void Evict();
+
+  const std::string directory_;
+  const int64_t capacity_;
+
+  /// The key found by the last Lookup(), and its object.
+  std::string key_;
+  std::unique_ptr<llvm::MemoryBuffer> object_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_OBJECT_CACHE_H
@@ -31,10 +31,12 @@ namespace gandiva {
 
 Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                      const FieldVector& output_fields,
+                     SelectionVector::Mode selection_vector_mode,
                      std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
       output_fields_(output_fields),
+      selection_vector_mode_(selection_vector_mode),
       configuration_(configuration) {}
 
 Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
@@ -46,6 +48,14 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                        std::shared_ptr<Configuration> configuration,
                        std::shared_ptr<Projector>* projector) {
+  return Projector::Make(schema, exprs, SelectionVector::MODE_NONE, configuration,
+                         projector);
+}
+
+Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                       SelectionVector::Mode selection_vector_mode,
+                       std::shared_ptr<Configuration> configuration,
+                       std::shared_ptr<Projector>* projector) {
   GANDIVA_RETURN_FAILURE_IF_FALSE(schema != nullptr,
                                   Status::Invalid("schema cannot be null"));
   GANDIVA_RETURN_FAILURE_IF_FALSE(!exprs.empty(),
@@ -55,7 +65,7 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   // see if equivalent projector was already built
   static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
-  ProjectorCacheKey cache_key(schema, configuration, exprs);
+  ProjectorCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
   std::shared_ptr<Projector> cached_projector = cache.GetModule(cache_key);
   if (cached_projector != nullptr) {
     *projector = cached_projector;
@@ -78,7 +88,7 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     GANDIVA_RETURN_NOT_OK(status);
   }
 
-  status = llvm_gen->Build(exprs);
+  status = llvm_gen->Build(exprs, selection_vector_mode);
   GANDIVA_RETURN_NOT_OK(status);
 
   // save the output field types. Used for validation at Evaluate() time.
@@ -88,8 +98,8 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
   }
 
   // Instantiate the projector with the completely built llvm generator
-  *projector = std::shared_ptr<Projector>(
-      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
+  *projector = std::shared_ptr<Projector>(new Projector(
+      std::move(llvm_gen), schema, output_fields, selection_vector_mode, configuration));
   cache.PutModule(cache_key, *projector);
   std::cout << "llvm projector module cache insert : " << cache_key.ToString()
             << std::endl;
@@ -102,6 +112,10 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   Status status = ValidateEvaluateArgsCommon(batch);
   GANDIVA_RETURN_NOT_OK(status);
 
+  if (selection_vector_mode_ != SelectionVector::MODE_NONE) {
+    return Status::Invalid("projector was built to evaluate selection vectors");
+  }
+
   if (output_data_vecs.size() != output_fields_.size()) {
     std::stringstream ss;
     ss << "number of buffers for output_data_vecs is " << output_data_vecs.size()
@@ -127,6 +141,31 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
                            arrow::ArrayVector* output) {
+  if (selection_vector_mode_ != SelectionVector::MODE_NONE) {
+    return Status::Invalid("projector was built to evaluate selection vectors");
+  }
+  return EvaluateAndAllocate(batch, nullptr, pool, output);
+}
+
+Status Projector::Evaluate(const arrow::RecordBatch& batch,
+                           const SelectionVector& selection_vector,
+                           arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  if (selection_vector.GetMode() != selection_vector_mode_) {
+    std::stringstream ss;
+    ss << "selection vector has mode " << selection_vector.GetMode()
+       << ", the projector was built for mode " << selection_vector_mode_;
+    return Status::Invalid(ss.str());
+  }
+  // The generated code reads the records at the selected indices unchecked.
+  Status status = selection_vector.ValidateIndices(batch.num_rows());
+  GANDIVA_RETURN_NOT_OK(status);
+  return EvaluateAndAllocate(batch, &selection_vector, pool, output);
+}
+
+Status Projector::EvaluateAndAllocate(const arrow::RecordBatch& batch,
+                                      const SelectionVector* selection_vector,
+                                      arrow::MemoryPool* pool,
+                                      arrow::ArrayVector* output) {
   Status status = ValidateEvaluateArgsCommon(batch);
   GANDIVA_RETURN_NOT_OK(status);
 
@@ -138,20 +177,22 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* p
     return Status::Invalid("memory pool must be non-null.");
   }
 
-  // Allocate the output data vecs.
+  // Allocate the output data vecs, with one slot per evaluated record.
+  int num_output_records = selection_vector == nullptr
+                               ? static_cast<int>(batch.num_rows())
+                               : selection_vector->GetNumSlots();
   ArrayDataVector output_data_vecs;
   for (auto& field : output_fields_) {
     ArrayDataPtr output_data;
 
-    status = AllocArrayData(field->type(), static_cast<int>(batch.num_rows()), pool,
-                            &output_data);
+    status = AllocArrayData(field->type(), num_output_records, pool, &output_data);
     GANDIVA_RETURN_NOT_OK(status);
 
     output_data_vecs.push_back(output_data);
   }
 
   // Execute the expression(s).
-  status = llvm_generator_->Execute(batch, output_data_vecs);
+  status = llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
   GANDIVA_RETURN_NOT_OK(status);
 
   // Create and return array arrays.
@@ -26,6 +26,7 @@
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
 #include "gandiva/expression.h"
+#include "gandiva/selection_vector.h"
 #include "gandiva/status.h"
 
 namespace gandiva {
@@ -58,6 +59,20 @@ class Projector {
                      std::shared_ptr<Configuration>,
                      std::shared_ptr<Projector>* projector);
 
+  /// Build a projector for the given schema to evaluate the vector of expressions
+  /// over the records of selection vectors, e.g. the output of a Filter.
+  ///
+  /// \param[in] : schema schema for the record batches, and the expressions.
+  /// \param[in] : exprs vector of expressions.
+  /// \param[in] : selection_vector_mode mode of the selection vectors given to
+  ///              Evaluate(), or MODE_NONE to evaluate all the records.
+  /// \param[in] : run time configuration.
+  /// \param[out]: projector the returned projector object
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<Configuration>,
+                     std::shared_ptr<Projector>* projector);
+
   /// Evaluate the specified record batch, and return the allocated and populated output
   /// arrays. The output arrays will be allocated from the memory pool 'pool', and added
   /// to the vector 'output'.
@@ -68,6 +83,21 @@ class Projector {
   Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
                   arrow::ArrayVector* ouput);
 
+  /// Evaluate the records of the selection vector in the specified record batch,
+  /// and return the allocated and populated output arrays. The output arrays have
+  /// one slot per selected record, in the order of the selection vector. Only the
+  /// selected records are evaluated.
+  ///
+  /// \param[in] : batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] : selection_vector the indices of the records in the batch, with
+  ///              the mode given to 'Make'. The indices must be less than the
+  ///              number of records in the batch, else Invalid is returned.
+  /// \param[in] : pool memory pool used to allocate output arrays (if required).
+  /// \param[out]: output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  const SelectionVector& selection_vector, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
   /// Evaluate the specified record batch, and populate the output arrays. The output
   /// arrays of sufficient capacity must be allocated by the caller.
   ///
@@ -78,7 +108,14 @@ class Projector {
 
  private:
   Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-            const FieldVector& output_fields, std::shared_ptr<Configuration>);
+            const FieldVector& output_fields, SelectionVector::Mode selection_vector_mode,
+            std::shared_ptr<Configuration>);
+
+  /// Evaluate the selected records, or all of them if 'selection_vector' is null,
+  /// into output arrays allocated from 'pool'.
+  Status EvaluateAndAllocate(const arrow::RecordBatch& batch,
+                             const SelectionVector* selection_vector,
+                             arrow::MemoryPool* pool, arrow::ArrayVector* output);
 
   /// Allocate an ArrowData of length 'length'.
   Status AllocArrayData(const DataTypePtr& type, int length, arrow::MemoryPool* pool,
@@ -94,6 +131,7 @@ class Projector {
   const std::unique_ptr<LLVMGenerator> llvm_generator_;
   const SchemaPtr schema_;
   const FieldVector output_fields_;
+  const SelectionVector::Mode selection_vector_mode_;
   const std::shared_ptr<Configuration> configuration_;
 };
 
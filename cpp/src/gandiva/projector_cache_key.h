@@ -31,8 +31,12 @@ namespace gandiva {
 class ProjectorCacheKey {
  public:
   ProjectorCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
-                    ExpressionVector expression_vector)
-      : schema_(schema), configuration_(configuration), uniqifier_(0) {
+                    ExpressionVector expression_vector,
+                    SelectionVector::Mode selection_vector_mode)
+      : schema_(schema),
+        configuration_(configuration),
+        selection_vector_mode_(selection_vector_mode),
+        uniqifier_(0) {
     static const int kSeedValue = 4;
     size_t result = kSeedValue;
     for (auto& expr : expression_vector) {
@@ -43,6 +47,7 @@ class ProjectorCacheKey {
     }
     boost::hash_combine(result, configuration);
     boost::hash_combine(result, schema_->ToString());
+    boost::hash_combine(result, static_cast<int>(selection_vector_mode_));
     boost::hash_combine(result, uniqifier_);
     hash_code_ = result;
   }
@@ -63,6 +68,10 @@ class ProjectorCacheKey {
       return false;
     }
 
+    if (selection_vector_mode_ != other.selection_vector_mode_) {
+      return false;
+    }
+
     if (uniqifier_ != other.uniqifier_) {
       return false;
     }
@@ -91,6 +100,9 @@ class ProjectorCacheKey {
       ss << expr;
     }
     ss << "]";
+    if (selection_vector_mode_ != SelectionVector::MODE_NONE) {
+      ss << " Selection vector mode: " << selection_vector_mode_;
+    }
     return ss.str();
   }
 
@@ -107,6 +119,7 @@ class ProjectorCacheKey {
 
   const SchemaPtr schema_;
   const std::shared_ptr<Configuration> configuration_;
+  SelectionVector::Mode selection_vector_mode_;
   std::vector<std::string> expressions_as_strings_;
   size_t hash_code_;
   uint32_t uniqifier_;
@@ -73,6 +73,19 @@ Status SelectionVector::PopulateFromBitMap(const uint8_t* bitmap, int bitmap_siz
   return Status::OK();
 }
 
+Status SelectionVector::ValidateIndices(int64_t num_records) const {
+  const int num_slots = GetNumSlots();
+  for (int i = 0; i < num_slots; ++i) {
+    if (static_cast<int64_t>(GetIndex(i)) >= num_records) {
+      std::stringstream ss;
+      ss << "selection vector index " << GetIndex(i) << " at slot " << i
+         << " is out of bounds for a batch of " << num_records << " records";
+      return Status::Invalid(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
 Status SelectionVector::MakeInt16(int max_slots, std::shared_ptr<arrow::Buffer> buffer,
                                   std::shared_ptr<SelectionVector>* selection_vector) {
   auto status = SelectionVectorInt16::ValidateBuffer(max_slots, buffer);
@@ -111,8 +124,8 @@ Status SelectionVector::MakeInt32(int max_slots, arrow::MemoryPool* pool,
   return Status::OK();
 }
 
-template <typename C_TYPE, typename A_TYPE>
-Status SelectionVectorImpl<C_TYPE, A_TYPE>::AllocateBuffer(
+template <typename C_TYPE, typename A_TYPE, SelectionVector::Mode mode>
+Status SelectionVectorImpl<C_TYPE, A_TYPE, mode>::AllocateBuffer(
     int max_slots, arrow::MemoryPool* pool, std::shared_ptr<arrow::Buffer>* buffer) {
   auto buffer_len = max_slots * sizeof(C_TYPE);
   auto astatus = arrow::AllocateBuffer(pool, buffer_len, buffer);
@@ -121,8 +134,8 @@ Status SelectionVectorImpl<C_TYPE, A_TYPE>::AllocateBuffer(
   return Status::OK();
 }
 
-template <typename C_TYPE, typename A_TYPE>
-Status SelectionVectorImpl<C_TYPE, A_TYPE>::ValidateBuffer(
+template <typename C_TYPE, typename A_TYPE, SelectionVector::Mode mode>
+Status SelectionVectorImpl<C_TYPE, A_TYPE, mode>::ValidateBuffer(
     int max_slots, std::shared_ptr<arrow::Buffer> buffer) {
   // verify buffer is mutable
   if (!buffer->is_mutable()) {
@@ -30,8 +30,17 @@ namespace gandiva {
 /// backed by an arrow-array.
 class SelectionVector {
  public:
+  /// The type of the indices in the selection vector.
+  enum Mode : int { MODE_NONE, MODE_UINT16, MODE_UINT32 };
+
   virtual ~SelectionVector() = default;
 
+  /// The type of the indices.
+  virtual Mode GetMode() const = 0;
+
+  /// The buffer holding the indices.
+  virtual const arrow::Buffer& GetBuffer() const = 0;
+
   /// Get the value at a given index.
   virtual uint GetIndex(int index) const = 0;
 
@@ -61,6 +70,11 @@ class SelectionVector {
   ///              capacity in the bitmap, due to alignment/padding).
   Status PopulateFromBitMap(const uint8_t* bitmap, int bitmap_size, int max_bitmap_index);
 
+  /// \brief check that the indices in the slots are valid for a record batch.
+  ///
+  /// \param[in] : num_records number of records in the batch
+  Status ValidateIndices(int64_t num_records) const;
+
   /// \brief make selection vector with int16 type records.
   ///
   /// \param[in] : max_slots max number of slots
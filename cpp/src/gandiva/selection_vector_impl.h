@@ -32,7 +32,7 @@ namespace gandiva {
 
 /// \brief template implementation of selection vector with a specific ctype and arrow
 /// type.
-template <typename C_TYPE, typename A_TYPE>
+template <typename C_TYPE, typename A_TYPE, SelectionVector::Mode mode>
 class SelectionVectorImpl : public SelectionVector {
  public:
   SelectionVectorImpl(int max_slots, std::shared_ptr<arrow::Buffer> buffer)
@@ -40,6 +40,10 @@ class SelectionVectorImpl : public SelectionVector {
     raw_data_ = reinterpret_cast<C_TYPE*>(buffer->mutable_data());
   }
 
+  Mode GetMode() const override { return mode; }
+
+  const arrow::Buffer& GetBuffer() const override { return *buffer_; }
+
   uint GetIndex(int index) const override { return raw_data_[index]; }
 
   void SetIndex(int index, uint value) override {
@@ -77,15 +81,17 @@ class SelectionVectorImpl : public SelectionVector {
   C_TYPE* raw_data_;
 };
 
-template <typename C_TYPE, typename A_TYPE>
-ArrayPtr SelectionVectorImpl<C_TYPE, A_TYPE>::ToArray() const {
+template <typename C_TYPE, typename A_TYPE, SelectionVector::Mode mode>
+ArrayPtr SelectionVectorImpl<C_TYPE, A_TYPE, mode>::ToArray() const {
   auto data_type = arrow::TypeTraits<A_TYPE>::type_singleton();
   auto array_data = arrow::ArrayData::Make(data_type, num_slots_, {NULLPTR, buffer_});
   return arrow::MakeArray(array_data);
 }
 
-using SelectionVectorInt16 = SelectionVectorImpl<uint16_t, arrow::UInt16Type>;
-using SelectionVectorInt32 = SelectionVectorImpl<uint32_t, arrow::UInt32Type>;
+using SelectionVectorInt16 =
+    SelectionVectorImpl<uint16_t, arrow::UInt16Type, SelectionVector::MODE_UINT16>;
+using SelectionVectorInt32 =
+    SelectionVectorImpl<uint32_t, arrow::UInt32Type, SelectionVector::MODE_UINT32>;
 
 }  // namespace gandiva
 
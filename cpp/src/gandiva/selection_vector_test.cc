@@ -167,6 +167,33 @@ TEST_F(TestSelectionVector, TestInt32Set) {
   EXPECT_EQ(array.Value(2), 100000) << array_raw->ToString();
 }
 
+TEST_F(TestSelectionVector, TestInt32ValidateIndices) {
+  int max_slots = 10;
+
+  std::shared_ptr<SelectionVector> selection;
+  auto status = SelectionVector::MakeInt32(max_slots, pool_, &selection);
+  EXPECT_EQ(status.ok(), true) << status.message();
+
+  selection->SetIndex(0, 7);
+  selection->SetIndex(1, 2);
+  selection->SetNumSlots(2);
+  status = selection->ValidateIndices(8);
+  EXPECT_EQ(status.ok(), true) << status.message();
+
+  // the largest index is not the last one.
+  status = selection->ValidateIndices(7);
+  EXPECT_EQ(status.IsInvalid(), true);
+
+  // only the used slots are checked.
+  selection->SetIndex(2, 100000);
+  status = selection->ValidateIndices(8);
+  EXPECT_EQ(status.ok(), true) << status.message();
+
+  selection->SetNumSlots(0);
+  status = selection->ValidateIndices(0);
+  EXPECT_EQ(status.ok(), true) << status.message();
+}
+
 TEST_F(TestSelectionVector, TestInt32PopulateFromBitMap) {
   int max_slots = 200;
 
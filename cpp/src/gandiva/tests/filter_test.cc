@@ -290,4 +290,53 @@ TEST_F(TestFilter, TestSimpleSVInt32) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestParallelEvaluation) {
+  // schema for input fields
+  auto field0 = field("f0", arrow::int64());
+  auto schema = arrow::schema({field0});
+
+  // Build condition f0 % 3 == 0
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto literal_3 = TreeExprBuilder::MakeLiteral((int32_t)3);
+  auto literal_0 = TreeExprBuilder::MakeLiteral((int32_t)0);
+  auto mod_func = TreeExprBuilder::MakeFunction("mod", {node_f0, literal_3}, int32());
+  auto equal_0 =
+      TreeExprBuilder::MakeFunction("equal", {mod_func, literal_0}, arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(equal_0);
+
+  // slices of 64 records, so that the batch is evaluated in several slices.
+  auto configuration =
+      ConfigurationBuilder().set_parallel_evaluation(true).set_slice_size(64).build();
+
+  std::shared_ptr<Filter> filter;
+  Status status = Filter::Make(schema, condition, configuration, &filter);
+  EXPECT_TRUE(status.ok());
+
+  // Create a row-batch with some sample data
+  int num_records = 1000;
+  std::vector<int64_t> values;
+  std::vector<bool> validity;
+  std::vector<uint32_t> expected;
+  for (int i = 0; i < num_records; ++i) {
+    values.push_back(i);
+    validity.push_back(i % 4 != 0);
+    if (i % 3 == 0 && i % 4 != 0) {
+      expected.push_back(i);
+    }
+  }
+  auto array0 = MakeArrowArrayInt64(values, validity);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt32(num_records, pool_, &selection_vector);
+  EXPECT_TRUE(status.ok());
+
+  // Evaluate expression
+  status = filter->Evaluate(*in_batch, selection_vector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayUint32(expected), selection_vector->ToArray());
+}
+
 }  // namespace gandiva
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
+
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
 #include "gandiva/projector.h"
@@ -213,4 +215,41 @@ TEST_F(TestBenchmarks, TimedTestFilterLike) {
   EXPECT_LE(elapsed_millis, 600 * tolerance_ratio);
 }
 
+TEST_F(TestBenchmarks, TimedTestProjectorMake) {
+  // schema for input fields
+  auto field0 = field("f0", int64());
+  auto field1 = field("f1", int64());
+  auto field2 = field("f2", int64());
+  auto schema = arrow::schema({field0, field1, field2});
+
+  // output field
+  auto field_sum = field("add", int64());
+
+  // Build expression
+  auto part_sum = TreeExprBuilder::MakeFunction(
+      "add", {TreeExprBuilder::MakeField(field1), TreeExprBuilder::MakeField(field2)},
+      int64());
+  auto sum = TreeExprBuilder::MakeFunction(
+      "add", {TreeExprBuilder::MakeField(field0), part_sum}, int64());
+  auto sum_expr = TreeExprBuilder::MakeExpression(sum, field_sum);
+
+  // Each build uses a new configuration, so that the projector isn't taken from
+  // the cache of the earlier ones.
+  const int num_builds = 10;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_builds; ++i) {
+    std::shared_ptr<Projector> projector;
+    Status status =
+        Projector::Make(schema, {sum_expr}, ConfigurationBuilder().build(), &projector);
+    ASSERT_TRUE(status.ok());
+  }
+  auto finish = std::chrono::steady_clock::now();
+  int64_t elapsed_millis =
+      std::chrono::duration_cast<std::chrono::milliseconds>(finish - start).count() /
+      num_builds;
+  std::cout << "Time taken for Projector::Make " << elapsed_millis << " ms\n";
+
+  EXPECT_LE(elapsed_millis, 100 * tolerance_ratio);
+}
+
 }  // namespace gandiva
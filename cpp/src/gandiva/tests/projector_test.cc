@@ -18,6 +18,7 @@
 #include "gandiva/projector.h"
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
+#include "arrow/util/thread-pool.h"
 #include "gandiva/tests/test_util.h"
 #include "gandiva/tree_expr_builder.h"
 
@@ -717,6 +718,190 @@ TEST_F(TestProjector, TestDivideZero) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
 
+TEST_F(TestProjector, TestSelectionVector) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_div = field("divide", int32());
+
+  // Build expression
+  auto div_expr = TreeExprBuilder::MakeExpression("divide", {field0, field1}, field_div);
+
+  std::shared_ptr<Projector> projector;
+  Status status =
+      Projector::Make(schema, {div_expr}, SelectionVector::MODE_UINT16,
+                      ConfigurationBuilder::DefaultConfiguration(), &projector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Create a row-batch with some sample data
+  int num_records = 6;
+  auto array0 =
+      MakeArrowArrayInt32({2, 3, 4, 5, 6, 8}, {true, true, true, true, true, true});
+  auto array1 =
+      MakeArrowArrayInt32({1, 0, 2, 0, 3, 4}, {true, true, false, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // select the records with a non-zero divisor, in a different order.
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  EXPECT_TRUE(status.ok());
+  selection_vector->SetIndex(0, 5);
+  selection_vector->SetIndex(1, 2);
+  selection_vector->SetIndex(2, 0);
+  selection_vector->SetIndex(3, 4);
+  selection_vector->SetNumSlots(4);
+
+  // expected output, one slot per selected record.
+  auto exp = MakeArrowArrayInt32({2, 0, 2, 2}, {true, false, true, true});
+
+  // Evaluate expression : the records that would divide by zero are skipped.
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
+
+  // An empty selection gives empty outputs.
+  selection_vector->SetNumSlots(0);
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_EQ(outputs.at(0)->length(), 0);
+
+  // The selected indices must be in the batch.
+  selection_vector->SetIndex(0, 3);
+  selection_vector->SetIndex(1, static_cast<uint>(num_records));
+  selection_vector->SetNumSlots(2);
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+  selection_vector->SetIndex(1, 1000);
+  status = projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+
+  // The mode of the selection vector must match the projector.
+  std::shared_ptr<SelectionVector> selection_vector32;
+  status = SelectionVector::MakeInt32(num_records, pool_, &selection_vector32);
+  EXPECT_TRUE(status.ok());
+  status = projector->Evaluate(*in_batch, *selection_vector32, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+}
+
+TEST_F(TestProjector, TestParallelEvaluation) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  // slices of 50 records rounded up to 64, so that the batch is evaluated in
+  // several slices.
+  auto configuration =
+      ConfigurationBuilder().set_parallel_evaluation(true).set_slice_size(50).build();
+
+  std::shared_ptr<Projector> projector;
+  Status status = Projector::Make(schema, {sum_expr}, configuration, &projector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  std::shared_ptr<Projector> sv_projector;
+  status = Projector::Make(schema, {sum_expr}, SelectionVector::MODE_UINT16,
+                           configuration, &sv_projector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Create a row-batch with some sample data
+  int num_records = 1000;
+  std::vector<int32_t> values0, values1, sums;
+  std::vector<bool> validity0, validity1, sums_validity;
+  for (int i = 0; i < num_records; ++i) {
+    values0.push_back(i);
+    values1.push_back(2 * i);
+    validity0.push_back(i % 7 != 0);
+    validity1.push_back(i % 5 != 0);
+    sums.push_back(3 * i);
+    sums_validity.push_back(i % 7 != 0 && i % 5 != 0);
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity0);
+  auto array1 = MakeArrowArrayInt32(values1, validity1);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt32(sums, sums_validity), outputs.at(0));
+
+  // select every third record, from the last one.
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  EXPECT_TRUE(status.ok());
+  std::vector<int32_t> selected_sums;
+  std::vector<bool> selected_sums_validity;
+  int num_slots = 0;
+  for (int i = num_records - 1; i >= 0; i -= 3) {
+    selection_vector->SetIndex(num_slots++, i);
+    selected_sums.push_back(sums[i]);
+    selected_sums_validity.push_back(sums_validity[i]);
+  }
+  selection_vector->SetNumSlots(num_slots);
+
+  status = sv_projector->Evaluate(*in_batch, *selection_vector, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_ARROW_ARRAY_EQUALS(MakeArrowArrayInt32(selected_sums, selected_sums_validity),
+                            outputs.at(0));
+}
+
+TEST_F(TestProjector, TestParallelEvaluationFromPoolTasks) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("add", int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto configuration =
+      ConfigurationBuilder().set_parallel_evaluation(true).set_slice_size(50).build();
+  std::shared_ptr<Projector> projector;
+  Status status = Projector::Make(schema, {sum_expr}, configuration, &projector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  int num_records = 1000;
+  std::vector<int32_t> values0, values1, sums;
+  std::vector<bool> validity;
+  for (int i = 0; i < num_records; ++i) {
+    values0.push_back(i);
+    values1.push_back(2 * i);
+    sums.push_back(3 * i);
+    validity.push_back(true);
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity);
+  auto array1 = MakeArrowArrayInt32(values1, validity);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+  auto expected = MakeArrowArrayInt32(sums, validity);
+
+  // Occupy every worker of the pool with an evaluation, which must not wait for
+  // slices queued behind them
+  auto evaluate = [&]() {
+    arrow::ArrayVector outputs;
+    Status status = projector->Evaluate(*in_batch, pool_, &outputs);
+    return status.ok() && expected->Equals(outputs.at(0));
+  };
+  auto thread_pool = arrow::internal::GetCpuThreadPool();
+  std::vector<std::future<bool>> futures;
+  for (int i = 0; i < thread_pool->GetCapacity(); ++i) {
+    futures.push_back(thread_pool->Submit(evaluate));
+  }
+  for (auto& future : futures) {
+    EXPECT_TRUE(future.get());
+  }
+}
+
 TEST_F(TestProjector, TestModZero) {
   // schema for input fields
   auto field0 = field("f0", arrow::int64());
@@ -1675,6 +1675,157 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, batch);
 }
 
+TEST(TestArrowReadWrite, PreBufferedReads) {
+  const int num_columns = 10;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  // ReadTable consumes the column chunks column by column rather than in file
+  // order, which must not stall under a small memory limit
+  ReaderProperties properties;
+  properties.set_pre_buffer_memory_limit(1);
+  for (bool use_threads : {false, true}) {
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), properties, nullptr,
+                                &reader));
+    reader->set_use_threads(use_threads);
+    reader->set_pre_buffer(true);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+
+    ASSERT_OK_NO_THROW(reader->ReadTable({1, 3}, &result));
+    ASSERT_EQ(2, result->num_columns());
+    ASSERT_TRUE(table->column(1)->data()->Equals(result->column(0)->data()));
+    ASSERT_TRUE(table->column(3)->data()->Equals(result->column(1)->data()));
+
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({0, 1, 2, 3}, &result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+}
+
+TEST(TestArrowReadWrite, ReadFilteredRowGroup) {
+  const int num_columns = 4;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Select every 7th row and a run of rows
+  auto filter = [](const Table& predicate_columns,
+                   std::shared_ptr<::arrow::BooleanArray>* mask) {
+    EXPECT_EQ(1, predicate_columns.num_columns());
+    ::arrow::BooleanBuilder builder;
+    for (int64_t i = 0; i < predicate_columns.num_rows(); ++i) {
+      RETURN_NOT_OK(builder.Append(i % 7 == 0 || (i >= 300 && i < 350)));
+    }
+    std::shared_ptr<Array> array;
+    RETURN_NOT_OK(builder.Finish(&array));
+    *mask = std::static_pointer_cast<::arrow::BooleanArray>(array);
+    return Status::OK();
+  };
+
+  // With and without offset indexes to skip whole pages
+  for (bool page_index : {false, true}) {
+    WriterProperties::Builder builder;
+    builder.data_pagesize(512)->disable_dictionary();
+    if (page_index) {
+      builder.enable_page_index();
+    }
+    auto sink = std::make_shared<InMemoryOutputStream>();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  num_rows, builder.build(),
+                                  default_arrow_writer_properties()));
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(sink->GetBuffer()),
+                                ::arrow::default_memory_pool(),
+                                ::parquet::default_reader_properties(), nullptr,
+                                &reader));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadFilteredRowGroup(0, {0}, filter, {0, 2, 3}, &result));
+    ASSERT_EQ(3, result->num_columns());
+
+    for (int c = 0; c < result->num_columns(); ++c) {
+      const int column = c == 0 ? 0 : c + 1;
+      ASSERT_EQ(1, result->column(c)->data()->num_chunks());
+      auto expected = std::static_pointer_cast<::arrow::DoubleArray>(
+          table->column(column)->data()->chunk(0));
+      auto actual = std::static_pointer_cast<::arrow::DoubleArray>(
+          result->column(c)->data()->chunk(0));
+      int64_t position = 0;
+      for (int64_t i = 0; i < num_rows; ++i) {
+        if (i % 7 == 0 || (i >= 300 && i < 350)) {
+          ASSERT_EQ(expected->IsNull(i), actual->IsNull(position));
+          if (expected->IsValid(i)) {
+            ASSERT_EQ(expected->Value(i), actual->Value(position));
+          }
+          ++position;
+        }
+      }
+      ASSERT_EQ(position, actual->length());
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, ReadFilteredRowGroupReusesPredicateColumn) {
+  const int num_rows = 1000;
+
+  // A nullable string column is both the predicate and a requested column
+  ::arrow::StringBuilder values_builder, expected_builder;
+  for (int i = 0; i < num_rows; ++i) {
+    if (i % 5 == 0) {
+      ASSERT_OK(values_builder.AppendNull());
+    } else {
+      ASSERT_OK(values_builder.Append(std::to_string(i % 13)));
+    }
+    if (i % 3 == 0) {
+      ASSERT_OK(i % 5 == 0 ? expected_builder.AppendNull()
+                           : expected_builder.Append(std::to_string(i % 13)));
+    }
+  }
+  std::shared_ptr<Array> values, expected;
+  ASSERT_OK(values_builder.Finish(&values));
+  ASSERT_OK(expected_builder.Finish(&expected));
+  std::shared_ptr<Table> table = MakeSimpleTable(values, true);
+
+  auto filter = [](const Table& predicate_columns,
+                   std::shared_ptr<::arrow::BooleanArray>* mask) {
+    ::arrow::BooleanBuilder builder;
+    for (int64_t i = 0; i < predicate_columns.num_rows(); ++i) {
+      RETURN_NOT_OK(builder.Append(i % 3 == 0));
+    }
+    std::shared_ptr<Array> array;
+    RETURN_NOT_OK(builder.Finish(&array));
+    *mask = std::static_pointer_cast<::arrow::BooleanArray>(array);
+    return Status::OK();
+  };
+
+  auto sink = std::make_shared<InMemoryOutputStream>();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                default_writer_properties(),
+                                default_arrow_writer_properties()));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(sink->GetBuffer()),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadFilteredRowGroup(0, {0}, filter, {0}, &result));
+  ASSERT_EQ(1, result->num_columns());
+  ASSERT_EQ(1, result->column(0)->data()->num_chunks());
+  ::arrow::AssertArraysEqual(*expected, *result->column(0)->data()->chunk(0));
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2326,6 +2477,82 @@ TEST(TestArrowReaderAdHoc, Int96BadMemoryAccess) {
   ASSERT_OK_NO_THROW(arrow_reader->ReadTable(&table));
 }
 
+TEST(TestArrowReaderAdHoc, ReadStringColumnIntoChunkedArray) {
+  ::arrow::StringBuilder builder;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 10 == 0) {
+      ASSERT_OK(builder.AppendNull());
+    } else {
+      ASSERT_OK(builder.Append(std::to_string(i)));
+    }
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  auto table = MakeSimpleTable(values, true /* nullable */);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, 1000, default_arrow_writer_properties(), &buffer));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+
+  // Small enough for a single chunk, so both overloads succeed
+  std::shared_ptr<ChunkedArray> chunked_result;
+  ASSERT_OK_NO_THROW(reader->ReadColumn(0, &chunked_result));
+  ASSERT_EQ(1, chunked_result->num_chunks());
+  internal::AssertArraysEqual(*values, *chunked_result->chunk(0));
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK_NO_THROW(reader->RowGroup(0)->Column(0)->Read(&result));
+  internal::AssertArraysEqual(*values, *result);
+}
+
+TEST(TestArrowReaderAdHoc, DISABLED_LargeStringColumn) {
+  // More than 2GB of strings in a single row group
+  const int64_t num_values = 2200000;
+  const std::string value(1024, 'x');
+
+  ::arrow::StringBuilder builder;
+  ASSERT_OK(builder.Reserve(num_values / 2));
+  ASSERT_OK(builder.ReserveData(value.size() * num_values / 2));
+  for (int64_t i = 0; i < num_values / 2; ++i) {
+    builder.UnsafeAppend(value);
+  }
+  std::shared_ptr<Array> half;
+  ASSERT_OK(builder.Finish(&half));
+  auto column = std::make_shared<Column>(::arrow::field("x", ::arrow::utf8()),
+                                         ::arrow::ArrayVector{half, half});
+  auto table = Table::Make(::arrow::schema({column->field()}), {column});
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, num_values, default_arrow_writer_properties(), &buffer));
+  table.reset();
+  column.reset();
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+  ASSERT_EQ(1, reader->num_row_groups());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_EQ(num_values, result->num_rows());
+  const ChunkedArray& data = *result->column(0)->data();
+  ASSERT_GT(data.num_chunks(), 1);
+  ASSERT_EQ(0, data.null_count());
+  for (int i = 0; i < data.num_chunks(); ++i) {
+    ASSERT_TRUE(data.chunk(i)->type()->Equals(::arrow::utf8()));
+  }
+
+  // Can't be read into a single array
+  std::shared_ptr<Array> array;
+  ASSERT_RAISES(Invalid, reader->ReadColumn(0, &array));
+}
+
 class TestArrowReaderAdHocSparkAndHvr
     : public ::testing::TestWithParam<
           std::tuple<std::string, std::shared_ptr<::DataType>>> {};
@@ -21,6 +21,7 @@
 #include <climits>
 #include <cstring>
 #include <future>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <type_traits>
@@ -46,6 +47,7 @@
 
 using arrow::Array;
 using arrow::BooleanArray;
+using arrow::ChunkedArray;
 using arrow::Column;
 using arrow::Field;
 using arrow::Int32Array;
@@ -157,6 +159,21 @@ class SingleRowGroupIterator : public FileColumnIterator {
   bool done_;
 };
 
+// Iterates over a single column chunk, using the given page reader
+class SelectedPagesIterator : public FileColumnIterator {
+ public:
+  explicit SelectedPagesIterator(int column_index, ParquetFileReader* reader,
+                                 std::unique_ptr<::parquet::PageReader> page_reader)
+      : FileColumnIterator(column_index, reader), page_reader_(std::move(page_reader)) {}
+
+  std::unique_ptr<::parquet::PageReader> NextChunk() override {
+    return std::move(page_reader_);
+  }
+
+ private:
+  std::unique_ptr<::parquet::PageReader> page_reader_;
+};
+
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   explicit RowGroupRecordBatchReader(const std::vector<int>& row_group_indices,
@@ -216,20 +233,26 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
 class FileReader::Impl {
  public:
   Impl(MemoryPool* pool, std::unique_ptr<ParquetFileReader> reader)
-      : pool_(pool), reader_(std::move(reader)), use_threads_(false) {}
+      : pool_(pool),
+        reader_(std::move(reader)),
+        use_threads_(false),
+        pre_buffer_(false) {}
 
   virtual ~Impl() {}
 
   Status GetColumn(int i, std::unique_ptr<ColumnReader>* out);
-  Status ReadSchemaField(int i, std::shared_ptr<Array>* out);
+  Status ReadSchemaField(int i, std::shared_ptr<ChunkedArray>* out);
   Status ReadSchemaField(int i, const std::vector<int>& indices,
-                         std::shared_ptr<Array>* out);
+                         std::shared_ptr<ChunkedArray>* out);
   Status GetReaderForNode(int index, const Node* node, const std::vector<int>& indices,
                           int16_t def_level,
                           std::unique_ptr<ColumnReader::ColumnReaderImpl>* out);
-  Status ReadColumn(int i, std::shared_ptr<Array>* out);
+  Status ReadColumn(int i, std::shared_ptr<ChunkedArray>* out);
   Status ReadColumnChunk(int column_index, int row_group_index,
-                         std::shared_ptr<Array>* out);
+                         std::shared_ptr<ChunkedArray>* out);
+  Status ReadColumnChunkRows(int column_index, int row_group_index,
+                             const std::vector<RowRange>& row_ranges,
+                             std::shared_ptr<ChunkedArray>* out);
   Status GetSchema(std::shared_ptr<::arrow::Schema>* out);
   Status GetSchema(const std::vector<int>& indices,
                    std::shared_ptr<::arrow::Schema>* out);
@@ -242,6 +265,10 @@ class FileReader::Impl {
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        const std::vector<int>& indices,
                        std::shared_ptr<::arrow::Table>* out);
+  Status ReadFilteredRowGroup(int row_group_index,
+                              const std::vector<int>& predicate_indices,
+                              const RowFilter& filter, const std::vector<int>& indices,
+                              std::shared_ptr<::arrow::Table>* out);
 
   bool CheckForFlatColumn(const ColumnDescriptor* descr);
   bool CheckForFlatListColumn(const ColumnDescriptor* descr);
@@ -254,18 +281,24 @@ class FileReader::Impl {
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
   ParquetFileReader* reader() { return reader_.get(); }
 
  private:
   MemoryPool* pool_;
   std::unique_ptr<ParquetFileReader> reader_;
   bool use_threads_;
+  bool pre_buffer_;
 };
 
 class ColumnReader::ColumnReaderImpl {
  public:
   virtual ~ColumnReaderImpl() {}
-  virtual Status NextBatch(int64_t records_to_read, std::shared_ptr<Array>* out) = 0;
+  virtual Status NextBatch(int64_t records_to_read,
+                           std::shared_ptr<ChunkedArray>* out) = 0;
   virtual Status GetDefLevels(const int16_t** data, size_t* length) = 0;
   virtual Status GetRepLevels(const int16_t** data, size_t* length) = 0;
   virtual const std::shared_ptr<Field> field() = 0;
@@ -281,7 +314,13 @@ class PARQUET_NO_EXPORT PrimitiveImpl : public ColumnReader::ColumnReaderImpl {
     NextRowGroup();
   }
 
-  Status NextBatch(int64_t records_to_read, std::shared_ptr<Array>* out) override;
+  Status NextBatch(int64_t records_to_read,
+                   std::shared_ptr<ChunkedArray>* out) override;
+
+  // Read the indicated ranges of records of a single column chunk, skipping
+  // the records in between. Only supported for non-repeated columns
+  Status ReadRecordRanges(const std::vector<RowRange>& ranges,
+                          std::shared_ptr<ChunkedArray>* out);
 
   template <typename ParquetType>
   Status WrapIntoListArray(std::shared_ptr<Array>* array);
@@ -294,6 +333,12 @@ class PARQUET_NO_EXPORT PrimitiveImpl : public ColumnReader::ColumnReaderImpl {
  private:
   void NextRowGroup();
 
+  // Convert the records read by the record reader to an Arrow array
+  Status TransferRecords(std::shared_ptr<ChunkedArray>* out);
+
+  // BYTE_ARRAY values may be split into several chunks by the record reader
+  Status TransferBinary(std::shared_ptr<ChunkedArray>* out);
+
   MemoryPool* pool_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
@@ -312,7 +357,8 @@ class PARQUET_NO_EXPORT StructImpl : public ColumnReader::ColumnReaderImpl {
     InitField(node, children);
   }
 
-  Status NextBatch(int64_t records_to_read, std::shared_ptr<Array>* out) override;
+  Status NextBatch(int64_t records_to_read,
+                   std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, size_t* length) override;
   Status GetRepLevels(const int16_t** data, size_t* length) override;
   const std::shared_ptr<Field> field() override { return field_; }
@@ -393,7 +439,7 @@ Status FileReader::Impl::GetReaderForNode(
   return Status::OK();
 }
 
-Status FileReader::Impl::ReadSchemaField(int i, std::shared_ptr<Array>* out) {
+Status FileReader::Impl::ReadSchemaField(int i, std::shared_ptr<ChunkedArray>* out) {
   std::vector<int> indices(reader_->metadata()->num_columns());
 
   for (size_t j = 0; j < indices.size(); ++j) {
@@ -404,7 +450,7 @@ Status FileReader::Impl::ReadSchemaField(int i, std::shared_ptr<Array>* out) {
 }
 
 Status FileReader::Impl::ReadSchemaField(int i, const std::vector<int>& indices,
-                                         std::shared_ptr<Array>* out) {
+                                         std::shared_ptr<ChunkedArray>* out) {
   auto parquet_schema = reader_->metadata()->schema();
 
   auto node = parquet_schema->group_node()->field(i).get();
@@ -430,7 +476,7 @@ Status FileReader::Impl::ReadSchemaField(int i, const std::vector<int>& indices,
   return reader->NextBatch(records_to_read, out);
 }
 
-Status FileReader::Impl::ReadColumn(int i, std::shared_ptr<Array>* out) {
+Status FileReader::Impl::ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) {
   std::unique_ptr<ColumnReader> flat_column_reader;
   RETURN_NOT_OK(GetColumn(i, &flat_column_reader));
 
@@ -450,7 +496,7 @@ Status FileReader::Impl::GetSchema(const std::vector<int>& indices,
 }
 
 Status FileReader::Impl::ReadColumnChunk(int column_index, int row_group_index,
-                                         std::shared_ptr<Array>* out) {
+                                         std::shared_ptr<ChunkedArray>* out) {
   auto rg_metadata = reader_->metadata()->RowGroup(row_group_index);
   int64_t records_to_read = rg_metadata->ColumnChunk(column_index)->num_values();
 
@@ -460,11 +506,7 @@ Status FileReader::Impl::ReadColumnChunk(int column_index, int row_group_index,
   std::unique_ptr<ColumnReader::ColumnReaderImpl> impl(
       new PrimitiveImpl(pool_, std::move(input)));
   ColumnReader flat_column_reader(std::move(impl));
-
-  std::shared_ptr<Array> array;
-  RETURN_NOT_OK(flat_column_reader.NextBatch(records_to_read, &array));
-  *out = array;
-  return Status::OK();
+  return flat_column_reader.NextBatch(records_to_read, out);
 }
 
 Status FileReader::Impl::ReadRowGroup(int row_group_index,
@@ -483,7 +525,7 @@ Status FileReader::Impl::ReadRowGroup(int row_group_index,
   auto ReadColumnFunc = [&indices, &row_group_index, &schema, &columns, this](int i) {
     int column_index = indices[i];
 
-    std::shared_ptr<Array> array;
+    std::shared_ptr<ChunkedArray> array;
     RETURN_NOT_OK(ReadColumnChunk(column_index, row_group_index, &array));
     columns[i] = std::make_shared<Column>(schema->field(i), array);
     return Status::OK();
@@ -513,6 +555,242 @@ Status FileReader::Impl::ReadRowGroup(int row_group_index,
   return Status::OK();
 }
 
+Status FileReader::Impl::ReadColumnChunkRows(int column_index, int row_group_index,
+                                             const std::vector<RowRange>& row_ranges,
+                                             std::shared_ptr<ChunkedArray>* out) {
+  // Only the pages holding selected rows are read if the column chunk has an
+  // offset index
+  std::vector<RowRange> page_rows;
+  std::unique_ptr<PageReader> page_reader =
+      reader_->RowGroup(row_group_index)
+          ->GetColumnPageReader(column_index, row_ranges, &page_rows);
+
+  // Translate the row ranges to positions among the rows of these pages
+  std::vector<RowRange> record_ranges;
+  int64_t pages_position = 0;
+  auto page_range = page_rows.begin();
+  for (const RowRange& range : row_ranges) {
+    while (page_range != page_rows.end() && page_range->last < range.first) {
+      pages_position += page_range->last - page_range->first + 1;
+      ++page_range;
+    }
+    if (page_range == page_rows.end() || page_range->first > range.first ||
+        page_range->last < range.last) {
+      return Status::IOError("Selected rows are not covered by the column chunk pages");
+    }
+    const int64_t first = pages_position + range.first - page_range->first;
+    record_ranges.push_back({first, first + range.last - range.first});
+  }
+
+  std::unique_ptr<FileColumnIterator> input(
+      new SelectedPagesIterator(column_index, reader_.get(), std::move(page_reader)));
+  PrimitiveImpl impl(pool_, std::move(input));
+  return impl.ReadRecordRanges(record_ranges, out);
+}
+
+// Gather the rows of the given ranges of an already decoded column into a
+// single array, so that a predicate column which is also requested by a
+// filtered read is not decoded twice. Returns NotImplemented for the types
+// which are not handled here, which are decoded again instead.
+static Status SelectRows(const ChunkedArray& column,
+                         const std::vector<RowRange>& row_ranges, MemoryPool* pool,
+                         std::shared_ptr<Array>* out) {
+  const ::arrow::DataType& type = *column.type();
+  int64_t num_selected = 0;
+  for (const RowRange& range : row_ranges) {
+    num_selected += range.last - range.first + 1;
+  }
+  if (type.id() == ::arrow::Type::NA) {
+    *out = std::make_shared<::arrow::NullArray>(num_selected);
+    return Status::OK();
+  }
+  const bool is_binary =
+      type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  const auto fixed_width_type = dynamic_cast<const ::arrow::FixedWidthType*>(&type);
+  if (type.id() == ::arrow::Type::DICTIONARY ||
+      (!is_binary && fixed_width_type == nullptr)) {
+    return Status::NotImplemented("Selecting the rows of a " + type.ToString() +
+                                  " column");
+  }
+  const int bit_width = is_binary ? 0 : fixed_width_type->bit_width();
+
+  std::shared_ptr<Buffer> null_bitmap;
+  RETURN_NOT_OK(::arrow::AllocateEmptyBitmap(pool, num_selected, &null_bitmap));
+  uint8_t* out_valid_bits = null_bitmap->mutable_data();
+  std::shared_ptr<Buffer> values;
+  if (bit_width == 1) {
+    RETURN_NOT_OK(::arrow::AllocateEmptyBitmap(pool, num_selected, &values));
+  } else if (!is_binary) {
+    RETURN_NOT_OK(::arrow::AllocateBuffer(pool, num_selected * bit_width / 8, &values));
+  }
+  ::arrow::TypedBufferBuilder<int32_t> offsets_builder(pool);
+  ::arrow::BufferBuilder data_builder(pool);
+  if (is_binary) {
+    RETURN_NOT_OK(offsets_builder.Reserve((num_selected + 1) * sizeof(int32_t)));
+    offsets_builder.UnsafeAppend(0);
+  }
+
+  // Copy the selected rows piece by piece, a range may span several chunks
+  int64_t out_position = 0;
+  int chunk_index = 0;
+  int64_t chunk_start = 0;
+  for (const RowRange& range : row_ranges) {
+    int64_t row = range.first;
+    while (row <= range.last) {
+      while (chunk_start + column.chunk(chunk_index)->length() <= row) {
+        chunk_start += column.chunk(chunk_index)->length();
+        ++chunk_index;
+      }
+      const ::arrow::ArrayData& chunk = *column.chunk(chunk_index)->data();
+      const int64_t offset = chunk.offset + row - chunk_start;
+      const int64_t length =
+          std::min(range.last + 1, chunk_start + chunk.length) - row;
+
+      if (chunk.null_count != 0 && chunk.buffers[0] != nullptr) {
+        ::arrow::internal::CopyBitmap(chunk.buffers[0]->data(), offset, length,
+                                      out_valid_bits, out_position);
+      } else {
+        for (int64_t i = 0; i < length; ++i) {
+          ::arrow::BitUtil::SetBit(out_valid_bits, out_position + i);
+        }
+      }
+      if (is_binary) {
+        const int32_t* offsets =
+            reinterpret_cast<const int32_t*>(chunk.buffers[1]->data()) + offset;
+        const int64_t data_start = data_builder.length();
+        if (data_start + offsets[length] - offsets[0] > INT32_MAX) {
+          return Status::NotImplemented("Selected rows exceed the binary array capacity");
+        }
+        for (int64_t i = 1; i <= length; ++i) {
+          offsets_builder.UnsafeAppend(
+              static_cast<int32_t>(data_start + offsets[i] - offsets[0]));
+        }
+        RETURN_NOT_OK(data_builder.Append(chunk.buffers[2]->data() + offsets[0],
+                                          offsets[length] - offsets[0]));
+      } else if (bit_width == 1) {
+        ::arrow::internal::CopyBitmap(chunk.buffers[1]->data(), offset, length,
+                                      values->mutable_data(), out_position);
+      } else {
+        const int64_t byte_width = bit_width / 8;
+        std::memcpy(values->mutable_data() + out_position * byte_width,
+                    chunk.buffers[1]->data() + offset * byte_width, length * byte_width);
+      }
+      out_position += length;
+      row += length;
+    }
+  }
+
+  const int64_t null_count =
+      num_selected - ::arrow::internal::CountSetBits(out_valid_bits, 0, num_selected);
+  if (null_count == 0) {
+    null_bitmap = nullptr;
+  }
+  std::vector<std::shared_ptr<Buffer>> buffers = {null_bitmap};
+  if (is_binary) {
+    std::shared_ptr<Buffer> offsets, data;
+    RETURN_NOT_OK(offsets_builder.Finish(&offsets));
+    RETURN_NOT_OK(data_builder.Finish(&data));
+    buffers.push_back(offsets);
+    buffers.push_back(data);
+  } else {
+    buffers.push_back(values);
+  }
+  *out = ::arrow::MakeArray(::arrow::ArrayData::Make(column.type(), num_selected,
+                                                     std::move(buffers), null_count));
+  return Status::OK();
+}
+
+Status FileReader::Impl::ReadFilteredRowGroup(int row_group_index,
+                                              const std::vector<int>& predicate_indices,
+                                              const RowFilter& filter,
+                                              const std::vector<int>& indices,
+                                              std::shared_ptr<Table>* out) {
+  const SchemaDescriptor* parquet_schema = reader_->metadata()->schema();
+  for (int column_index : indices) {
+    if (column_index < 0 || column_index >= parquet_schema->num_columns()) {
+      return Status::Invalid("Invalid column index");
+    }
+    if (!parquet_schema->GetColumnRoot(column_index)->is_primitive()) {
+      return Status::NotImplemented("Filtered reads of nested columns");
+    }
+  }
+
+  // Decode the predicate columns and evaluate the filter
+  std::shared_ptr<Table> predicate_table;
+  RETURN_NOT_OK(ReadRowGroup(row_group_index, predicate_indices, &predicate_table));
+  std::shared_ptr<BooleanArray> mask;
+  RETURN_NOT_OK(filter(*predicate_table, &mask));
+  const int64_t num_rows = reader_->metadata()->RowGroup(row_group_index)->num_rows();
+  if (mask == nullptr || mask->length() != num_rows) {
+    return Status::Invalid("The row filter must return one mask entry per row");
+  }
+
+  std::vector<RowRange> row_ranges;
+  for (int64_t row = 0; row < num_rows; ++row) {
+    if (mask->IsValid(row) && mask->Value(row)) {
+      if (!row_ranges.empty() && row_ranges.back().last == row - 1) {
+        row_ranges.back().last = row;
+      } else {
+        row_ranges.push_back({row, row});
+      }
+    }
+  }
+
+  // Then decode the selected rows of the requested columns
+  std::shared_ptr<::arrow::Schema> schema;
+  RETURN_NOT_OK(GetSchema(indices, &schema));
+
+  int num_columns = static_cast<int>(indices.size());
+  std::vector<std::shared_ptr<Column>> columns(num_columns);
+
+  auto ReadColumnFunc = [&indices, &predicate_indices, &predicate_table,
+                         &row_group_index, &row_ranges, &schema, &columns, this](int i) {
+    std::shared_ptr<ChunkedArray> array;
+    auto predicate_it =
+        std::find(predicate_indices.begin(), predicate_indices.end(), indices[i]);
+    if (predicate_it != predicate_indices.end()) {
+      // Reuse the decoded predicate column
+      const int predicate_position =
+          static_cast<int>(predicate_it - predicate_indices.begin());
+      std::shared_ptr<Array> selected;
+      Status st = SelectRows(*predicate_table->column(predicate_position)->data(),
+                             row_ranges, pool_, &selected);
+      if (st.ok()) {
+        columns[i] = std::make_shared<Column>(schema->field(i), selected);
+        return Status::OK();
+      } else if (!st.IsNotImplemented()) {
+        return st;
+      }
+    }
+    RETURN_NOT_OK(ReadColumnChunkRows(indices[i], row_group_index, row_ranges, &array));
+    columns[i] = std::make_shared<Column>(schema->field(i), array);
+    return Status::OK();
+  };
+
+  if (use_threads_) {
+    std::vector<std::future<Status>> futures;
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    for (int i = 0; i < num_columns; i++) {
+      futures.push_back(pool->Submit(ReadColumnFunc, i));
+    }
+    Status final_status = Status::OK();
+    for (auto& fut : futures) {
+      Status st = fut.get();
+      if (!st.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    RETURN_NOT_OK(final_status);
+  } else {
+    for (int i = 0; i < num_columns; i++) {
+      RETURN_NOT_OK(ReadColumnFunc(i));
+    }
+  }
+
+  *out = Table::Make(schema, columns);
+  return Status::OK();
+}
+
 Status FileReader::Impl::ReadTable(const std::vector<int>& indices,
                                    std::shared_ptr<Table>* out) {
   std::shared_ptr<::arrow::Schema> schema;
@@ -526,11 +804,21 @@ Status FileReader::Impl::ReadTable(const std::vector<int>& indices,
     return Status::Invalid("Invalid column index");
   }
 
+  if (pre_buffer_) {
+    std::vector<int> row_groups(num_row_groups());
+    std::iota(row_groups.begin(), row_groups.end(), 0);
+    try {
+      reader_->PreBuffer(row_groups, indices);
+    } catch (const ::parquet::ParquetException& e) {
+      return Status::IOError(e.what());
+    }
+  }
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Column>> columns(num_fields);
 
   auto ReadColumnFunc = [&indices, &field_indices, &schema, &columns, this](int i) {
-    std::shared_ptr<Array> array;
+    std::shared_ptr<ChunkedArray> array;
     RETURN_NOT_OK(ReadSchemaField(field_indices[i], indices, &array));
     columns[i] = std::make_shared<Column>(schema->field(i), array);
     return Status::OK();
@@ -578,6 +866,13 @@ Status FileReader::Impl::ReadRowGroups(const std::vector<int>& row_groups,
   // continuous array.
   std::vector<std::shared_ptr<Table>> tables(row_groups.size(), nullptr);
 
+  if (pre_buffer_) {
+    try {
+      reader_->PreBuffer(row_groups, indices);
+    } catch (const ::parquet::ParquetException& e) {
+      return Status::IOError(e.what());
+    }
+  }
   for (size_t i = 0; i < row_groups.size(); ++i) {
     RETURN_NOT_OK(ReadRowGroup(row_groups[i], indices, &tables[i]));
   }
@@ -631,7 +926,23 @@ Status FileReader::GetSchema(const std::vector<int>& indices,
   return impl_->GetSchema(indices, out);
 }
 
-Status FileReader::ReadColumn(int i, std::shared_ptr<Array>* out) {
+// Unwrap the result of a read for the Array overloads of the API, which can't
+// return the columns that had to be split to fit in 32-bit offsets
+static Status GetSingleChunk(const std::shared_ptr<ChunkedArray>& chunked_array,
+                             std::shared_ptr<Array>* out) {
+  if (chunked_array == nullptr) {
+    *out = nullptr;
+    return Status::OK();
+  }
+  if (chunked_array->num_chunks() != 1) {
+    return Status::Invalid(
+        "The column doesn't fit in a single array, read it as a ChunkedArray");
+  }
+  *out = chunked_array->chunk(0);
+  return Status::OK();
+}
+
+Status FileReader::ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) {
   try {
     return impl_->ReadColumn(i, out);
   } catch (const ::parquet::ParquetException& e) {
@@ -639,7 +950,13 @@ Status FileReader::ReadColumn(int i, std::shared_ptr<Array>* out) {
   }
 }
 
-Status FileReader::ReadSchemaField(int i, std::shared_ptr<Array>* out) {
+Status FileReader::ReadColumn(int i, std::shared_ptr<Array>* out) {
+  std::shared_ptr<ChunkedArray> chunked_array;
+  RETURN_NOT_OK(ReadColumn(i, &chunked_array));
+  return GetSingleChunk(chunked_array, out);
+}
+
+Status FileReader::ReadSchemaField(int i, std::shared_ptr<ChunkedArray>* out) {
   try {
     return impl_->ReadSchemaField(i, out);
   } catch (const ::parquet::ParquetException& e) {
@@ -647,6 +964,12 @@ Status FileReader::ReadSchemaField(int i, std::shared_ptr<Array>* out) {
   }
 }
 
+Status FileReader::ReadSchemaField(int i, std::shared_ptr<Array>* out) {
+  std::shared_ptr<ChunkedArray> chunked_array;
+  RETURN_NOT_OK(ReadSchemaField(i, &chunked_array));
+  return GetSingleChunk(chunked_array, out);
+}
+
 Status FileReader::GetRecordBatchReader(const std::vector<int>& row_group_indices,
                                         std::shared_ptr<RecordBatchReader>* out) {
   std::vector<int> indices(impl_->num_columns());
@@ -676,6 +999,14 @@ Status FileReader::GetRecordBatchReader(const std::vector<int>& row_group_indice
     }
   }
 
+  if (impl_->pre_buffer()) {
+    try {
+      impl_->reader()->PreBuffer(row_group_indices, column_indices);
+    } catch (const ::parquet::ParquetException& e) {
+      return Status::IOError(e.what());
+    }
+  }
+
   *out = std::make_shared<RowGroupRecordBatchReader>(row_group_indices, column_indices,
                                                      schema, this);
   return Status::OK();
@@ -734,6 +1065,19 @@ Status FileReader::ReadRowGroups(const std::vector<int>& row_groups,
   }
 }
 
+Status FileReader::ReadFilteredRowGroup(int i,
+                                        const std::vector<int>& predicate_column_indices,
+                                        const RowFilter& filter,
+                                        const std::vector<int>& column_indices,
+                                        std::shared_ptr<Table>* out) {
+  try {
+    return impl_->ReadFilteredRowGroup(i, predicate_column_indices, filter,
+                                       column_indices, out);
+  } catch (const ::parquet::ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+}
+
 std::shared_ptr<RowGroupReader> FileReader::RowGroup(int row_group_index) {
   return std::shared_ptr<RowGroupReader>(
       new RowGroupReader(impl_.get(), row_group_index));
@@ -747,6 +1091,8 @@ void FileReader::set_use_threads(bool use_threads) {
   impl_->set_use_threads(use_threads);
 }
 
+void FileReader::set_pre_buffer(bool pre_buffer) { impl_->set_pre_buffer(pre_buffer); }
+
 Status FileReader::ScanContents(std::vector<int> columns, const int32_t column_batch_size,
                                 int64_t* num_rows) {
   try {
@@ -1041,22 +1387,16 @@ struct TransferFunctor<::arrow::Date64Type, Int32Type> {
   }
 };
 
-template <typename ArrowType, typename ParquetType>
-struct TransferFunctor<
-    ArrowType, ParquetType,
-    typename std::enable_if<std::is_same<ParquetType, ByteArrayType>::value ||
-                            std::is_same<ParquetType, FLBAType>::value>::type> {
+template <>
+struct TransferFunctor<::arrow::FixedSizeBinaryType, FLBAType> {
   Status operator()(RecordReader* reader, MemoryPool* pool,
                     const std::shared_ptr<::arrow::DataType>& type,
                     std::shared_ptr<Array>* out) {
-    RETURN_NOT_OK(reader->builder()->Finish(out));
-
-    if (type->id() == ::arrow::Type::STRING) {
-      // Convert from BINARY type to STRING
-      auto new_data = (*out)->data()->Copy();
-      new_data->type = type;
-      *out = ::arrow::MakeArray(new_data);
-    }
+    std::vector<std::shared_ptr<Array>> chunks;
+    RETURN_NOT_OK(reader->GetBuilderChunks(&chunks));
+    // Only BYTE_ARRAY values are ever split into several chunks
+    DCHECK_EQ(chunks.size(), 1);
+    *out = chunks[0];
     return Status::OK();
   }
 };
@@ -1178,8 +1518,10 @@ struct TransferFunctor<::arrow::Decimal128Type, FLBAType> {
     DCHECK_EQ(type->id(), ::arrow::Type::DECIMAL);
 
     // Finish the built data into a temporary array
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(reader->builder()->Finish(&array));
+    std::vector<std::shared_ptr<Array>> chunks;
+    RETURN_NOT_OK(reader->GetBuilderChunks(&chunks));
+    DCHECK_EQ(chunks.size(), 1);
+    const std::shared_ptr<Array>& array = chunks[0];
     const auto& fixed_size_binary_array =
         static_cast<const ::arrow::FixedSizeBinaryArray&>(*array);
 
@@ -1227,7 +1569,7 @@ struct TransferFunctor<::arrow::Decimal128Type, FLBAType> {
 
 /// \brief Convert an arrow::BinaryArray to an arrow::Decimal128Array
 /// We do this by:
-/// 1. Creating an arrow::BinaryArray from the RecordReader's builder
+/// 1. Creating the arrow::BinaryArray chunks from the RecordReader's builder
 /// 2. Allocating a buffer for the arrow::Decimal128Array
 /// 3. Converting the big-endian bytes in each BinaryArray entry to two integers
 ///    representing the high and low bits of each decimal value.
@@ -1238,12 +1580,16 @@ struct TransferFunctor<::arrow::Decimal128Type, ByteArrayType> {
                     std::shared_ptr<Array>* out) {
     DCHECK_EQ(type->id(), ::arrow::Type::DECIMAL);
 
-    // Finish the built data into a temporary array
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(reader->builder()->Finish(&array));
-    const auto& binary_array = static_cast<const ::arrow::BinaryArray&>(*array);
+    // Finish the built data into temporary arrays
+    std::vector<std::shared_ptr<Array>> chunks;
+    RETURN_NOT_OK(reader->GetBuilderChunks(&chunks));
 
-    const int64_t length = binary_array.length();
+    int64_t length = 0;
+    int64_t null_count = 0;
+    for (const auto& chunk : chunks) {
+      length += chunk->length();
+      null_count += chunk->null_count();
+    }
 
     const auto& decimal_type = static_cast<const ::arrow::Decimal128Type&>(*type);
     const int64_t type_length = decimal_type.byte_width();
@@ -1254,30 +1600,47 @@ struct TransferFunctor<::arrow::Decimal128Type, ByteArrayType> {
     // raw bytes that we can write to
     uint8_t* out_ptr = data->mutable_data();
 
-    const int64_t null_count = binary_array.null_count();
+    // The validity bitmap of a single chunk is reused as is
+    std::shared_ptr<Buffer> null_bitmap;
+    if (chunks.size() == 1) {
+      null_bitmap = chunks[0]->null_bitmap();
+    } else if (null_count > 0) {
+      RETURN_NOT_OK(AllocateEmptyBitmap(pool, length, &null_bitmap));
+    }
 
-    // convert each BinaryArray value to valid decimal bytes
-    for (int64_t i = 0; i < length; i++, out_ptr += type_length) {
-      int32_t record_len = 0;
-      const uint8_t* record_loc = binary_array.GetValue(i, &record_len);
+    int64_t position = 0;
+    for (const auto& chunk : chunks) {
+      const auto& binary_array = static_cast<const ::arrow::BinaryArray&>(*chunk);
+      const int64_t chunk_null_count = binary_array.null_count();
 
-      if ((record_len < 0) || (record_len > type_length)) {
-        return Status::Invalid("Invalid BYTE_ARRAY size");
-      }
+      // convert each BinaryArray value to valid decimal bytes
+      for (int64_t i = 0; i < binary_array.length();
+           i++, position++, out_ptr += type_length) {
+        int32_t record_len = 0;
+        const uint8_t* record_loc = binary_array.GetValue(i, &record_len);
 
-      auto out_ptr_view = reinterpret_cast<uint64_t*>(out_ptr);
-      out_ptr_view[0] = 0;
-      out_ptr_view[1] = 0;
+        if ((record_len < 0) || (record_len > type_length)) {
+          return Status::Invalid("Invalid BYTE_ARRAY size");
+        }
 
-      // only convert rows that are not null if there are nulls, or
-      // all rows, if there are not
-      if (((null_count > 0) && !binary_array.IsNull(i)) || (null_count <= 0)) {
-        RawBytesToDecimalBytes(record_loc, record_len, out_ptr);
+        auto out_ptr_view = reinterpret_cast<uint64_t*>(out_ptr);
+        out_ptr_view[0] = 0;
+        out_ptr_view[1] = 0;
+
+        // only convert rows that are not null if there are nulls, or
+        // all rows, if there are not
+        if (((chunk_null_count > 0) && !binary_array.IsNull(i)) ||
+            (chunk_null_count <= 0)) {
+          RawBytesToDecimalBytes(record_loc, record_len, out_ptr);
+          if (chunks.size() > 1 && null_count > 0) {
+            ::arrow::BitUtil::SetBit(null_bitmap->mutable_data(), position);
+          }
+        }
       }
     }
 
-    *out = std::make_shared<::arrow::Decimal128Array>(
-        type, length, data, binary_array.null_bitmap(), null_count);
+    *out = std::make_shared<::arrow::Decimal128Array>(type, length, data, null_bitmap,
+                                                      null_count);
 
     return Status::OK();
   }
@@ -1355,17 +1718,18 @@ struct TransferFunctor<::arrow::Decimal128Type, Int64Type> {
   }
 };
 
-#define TRANSFER_DATA(ArrowType, ParquetType)                            \
-  TransferFunctor<ArrowType, ParquetType> func;                          \
-  RETURN_NOT_OK(func(record_reader_.get(), pool_, field_->type(), out)); \
-  RETURN_NOT_OK(WrapIntoListArray<ParquetType>(out))
+#define TRANSFER_DATA(ArrowType, ParquetType)                                \
+  TransferFunctor<ArrowType, ParquetType> func;                              \
+  RETURN_NOT_OK(func(record_reader_.get(), pool_, field_->type(), &result)); \
+  RETURN_NOT_OK(WrapIntoListArray<ParquetType>(&result))
 
 #define TRANSFER_CASE(ENUM, ArrowType, ParquetType) \
   case ::arrow::Type::ENUM: {                       \
     TRANSFER_DATA(ArrowType, ParquetType);          \
   } break;
 
-Status PrimitiveImpl::NextBatch(int64_t records_to_read, std::shared_ptr<Array>* out) {
+Status PrimitiveImpl::NextBatch(int64_t records_to_read,
+                                std::shared_ptr<ChunkedArray>* out) {
   try {
     // Pre-allocation gives much better performance for flat columns
     record_reader_->Reserve(records_to_read);
@@ -1385,6 +1749,65 @@ Status PrimitiveImpl::NextBatch(int64_t records_to_read, std::shared_ptr<Array>*
     return ::arrow::Status::IOError(e.what());
   }
 
+  return TransferRecords(out);
+}
+
+Status PrimitiveImpl::ReadRecordRanges(const std::vector<RowRange>& ranges,
+                                       std::shared_ptr<ChunkedArray>* out) {
+  try {
+    int64_t records_to_read = 0;
+    for (const RowRange& range : ranges) {
+      records_to_read += range.last - range.first + 1;
+    }
+    record_reader_->Reserve(records_to_read);
+
+    record_reader_->Reset();
+    int64_t position = 0;
+    for (const RowRange& range : ranges) {
+      bool exhausted = record_reader_->SkipRecords(range.first - position) <
+                       range.first - position;
+      records_to_read = range.last - range.first + 1;
+      while (!exhausted && records_to_read > 0) {
+        int64_t records_read = record_reader_->ReadRecords(records_to_read);
+        records_to_read -= records_read;
+        exhausted = records_read == 0;
+      }
+      if (exhausted) {
+        return Status::IOError("Column chunk has fewer records than expected");
+      }
+      position = range.last + 1;
+    }
+  } catch (const ::parquet::ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+
+  return TransferRecords(out);
+}
+
+Status PrimitiveImpl::TransferBinary(std::shared_ptr<ChunkedArray>* out) {
+  std::vector<std::shared_ptr<Array>> chunks;
+  RETURN_NOT_OK(record_reader_->GetBuilderChunks(&chunks));
+  const std::shared_ptr<::arrow::DataType>& type = field_->type();
+  for (auto& chunk : chunks) {
+    if (!chunk->type()->Equals(*type)) {
+      // Convert from BINARY type to STRING
+      auto new_data = chunk->data()->Copy();
+      new_data->type = type;
+      chunk = ::arrow::MakeArray(new_data);
+    }
+  }
+  if (chunks.size() == 1) {
+    RETURN_NOT_OK(WrapIntoListArray<ByteArrayType>(&chunks[0]));
+  } else if (descr_->max_repetition_level() > 0) {
+    return Status::NotImplemented(
+        "Nested data conversions not implemented for chunked array outputs");
+  }
+  *out = std::make_shared<ChunkedArray>(chunks);
+  return Status::OK();
+}
+
+Status PrimitiveImpl::TransferRecords(std::shared_ptr<ChunkedArray>* out) {
+  std::shared_ptr<Array> result;
   switch (field_->type()->id()) {
     TRANSFER_CASE(BOOL, ::arrow::BooleanType, BooleanType)
     TRANSFER_CASE(UINT8, ::arrow::UInt8Type, Int32Type)
@@ -1397,14 +1820,15 @@ Status PrimitiveImpl::NextBatch(int64_t records_to_read, std::shared_ptr<Array>*
     TRANSFER_CASE(INT64, ::arrow::Int64Type, Int64Type)
     TRANSFER_CASE(FLOAT, ::arrow::FloatType, FloatType)
     TRANSFER_CASE(DOUBLE, ::arrow::DoubleType, DoubleType)
-    TRANSFER_CASE(STRING, ::arrow::StringType, ByteArrayType)
-    TRANSFER_CASE(BINARY, ::arrow::BinaryType, ByteArrayType)
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::BINARY:
+      return TransferBinary(out);
     TRANSFER_CASE(DATE32, ::arrow::Date32Type, Int32Type)
     TRANSFER_CASE(DATE64, ::arrow::Date64Type, Int32Type)
     TRANSFER_CASE(FIXED_SIZE_BINARY, ::arrow::FixedSizeBinaryType, FLBAType)
     case ::arrow::Type::NA: {
-      *out = std::make_shared<::arrow::NullArray>(record_reader_->values_written());
-      RETURN_NOT_OK(WrapIntoListArray<Int32Type>(out));
+      result = std::make_shared<::arrow::NullArray>(record_reader_->values_written());
+      RETURN_NOT_OK(WrapIntoListArray<Int32Type>(&result));
       break;
     }
     case ::arrow::Type::DECIMAL: {
@@ -1450,6 +1874,7 @@ Status PrimitiveImpl::NextBatch(int64_t records_to_read, std::shared_ptr<Array>*
       return Status::NotImplemented(ss.str());
   }
 
+  *out = std::make_shared<ChunkedArray>(::arrow::ArrayVector{result});
   return Status::OK();
 }
 
@@ -1475,10 +1900,17 @@ ColumnReader::ColumnReader(std::unique_ptr<ColumnReaderImpl> impl)
 
 ColumnReader::~ColumnReader() {}
 
-Status ColumnReader::NextBatch(int64_t records_to_read, std::shared_ptr<Array>* out) {
+Status ColumnReader::NextBatch(int64_t records_to_read,
+                               std::shared_ptr<ChunkedArray>* out) {
   return impl_->NextBatch(records_to_read, out);
 }
 
+Status ColumnReader::NextBatch(int64_t records_to_read, std::shared_ptr<Array>* out) {
+  std::shared_ptr<ChunkedArray> chunked_array;
+  RETURN_NOT_OK(NextBatch(records_to_read, &chunked_array));
+  return GetSingleChunk(chunked_array, out);
+}
+
 // StructImpl methods
 
 Status StructImpl::DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap_out,
@@ -1563,17 +1995,22 @@ Status StructImpl::GetRepLevels(const int16_t** data, size_t* length) {
   return Status::NotImplemented("GetRepLevels is not implemented for struct");
 }
 
-Status StructImpl::NextBatch(int64_t records_to_read, std::shared_ptr<Array>* out) {
+Status StructImpl::NextBatch(int64_t records_to_read,
+                             std::shared_ptr<ChunkedArray>* out) {
   std::vector<std::shared_ptr<Array>> children_arrays;
   std::shared_ptr<Buffer> null_bitmap;
   int64_t null_count;
 
   // Gather children arrays and def levels
   for (auto& child : children_) {
-    std::shared_ptr<Array> child_array;
+    std::shared_ptr<ChunkedArray> child_array;
 
     RETURN_NOT_OK(child->NextBatch(records_to_read, &child_array));
-    children_arrays.push_back(child_array);
+    if (child_array->num_chunks() != 1) {
+      return Status::NotImplemented(
+          "Nested data conversions not implemented for chunked array outputs");
+    }
+    children_arrays.push_back(child_array->chunk(0));
   }
 
   RETURN_NOT_OK(DefLevelsToNullArray(&null_bitmap, &null_count));
@@ -1587,8 +2024,9 @@ Status StructImpl::NextBatch(int64_t records_to_read, std::shared_ptr<Array>* ou
     }
   }
 
-  *out = std::make_shared<StructArray>(field()->type(), struct_length, children_arrays,
-                                       null_bitmap, null_count);
+  auto result = std::make_shared<StructArray>(field()->type(), struct_length,
+                                              children_arrays, null_bitmap, null_count);
+  *out = std::make_shared<ChunkedArray>(::arrow::ArrayVector{result});
   return Status::OK();
 }
 
@@ -1611,10 +2049,16 @@ RowGroupReader::~RowGroupReader() {}
 RowGroupReader::RowGroupReader(FileReader::Impl* impl, int row_group_index)
     : impl_(impl), row_group_index_(row_group_index) {}
 
-Status ColumnChunkReader::Read(std::shared_ptr<::arrow::Array>* out) {
+Status ColumnChunkReader::Read(std::shared_ptr<::arrow::ChunkedArray>* out) {
   return impl_->ReadColumnChunk(column_index_, row_group_index_, out);
 }
 
+Status ColumnChunkReader::Read(std::shared_ptr<::arrow::Array>* out) {
+  std::shared_ptr<ChunkedArray> chunked_array;
+  RETURN_NOT_OK(Read(&chunked_array));
+  return GetSingleChunk(chunked_array, out);
+}
+
 ColumnChunkReader::~ColumnChunkReader() {}
 
 ColumnChunkReader::ColumnChunkReader(FileReader::Impl* impl, int row_group_index,
@@ -19,6 +19,7 @@
 #define PARQUET_ARROW_READER_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -30,6 +31,8 @@
 namespace arrow {
 
 class Array;
+class BooleanArray;
+class ChunkedArray;
 class MemoryPool;
 class RecordBatchReader;
 class Schema;
@@ -50,6 +53,14 @@ class ColumnChunkReader;
 class ColumnReader;
 class RowGroupReader;
 
+/// \brief Evaluates a predicate on the rows of a row group
+///
+/// Receives the predicate columns of the row group and returns a mask with one
+/// entry per row. Rows whose entry is false or null are filtered out.
+using RowFilter =
+    std::function<::arrow::Status(const ::arrow::Table& predicate_columns,
+                                  std::shared_ptr<::arrow::BooleanArray>* mask)>;
+
 // Arrow read adapter class for deserializing Parquet files as Arrow row
 // batches.
 //
@@ -124,7 +135,14 @@ class PARQUET_EXPORT FileReader {
   ::arrow::Status GetSchema(const std::vector<int>& indices,
                             std::shared_ptr<::arrow::Schema>* out);
 
-  // Read column as a whole into an Array.
+  // Read column as a whole into a chunked Array.
+  //
+  // BYTE_ARRAY columns too large for a single BinaryArray are split into
+  // several chunks, otherwise the result has a single chunk.
+  ::arrow::Status ReadColumn(int i, std::shared_ptr<::arrow::ChunkedArray>* out);
+
+  // Read column as a whole into an Array. Fails if the column had to be
+  // split into several chunks.
   ::arrow::Status ReadColumn(int i, std::shared_ptr<::arrow::Array>* out);
 
   // NOTE: Experimental API
@@ -139,6 +157,11 @@ class PARQUET_EXPORT FileReader {
   // 2 foo3
   //
   // i=0 will read the entire foo struct, i=1 the foo2 primitive column etc
+  ::arrow::Status ReadSchemaField(int i, std::shared_ptr<::arrow::ChunkedArray>* out);
+
+  // NOTE: Experimental API
+  // Reads a specific top level schema field into an Array, as above. Fails if
+  // the field had to be split into several chunks.
   ::arrow::Status ReadSchemaField(int i, std::shared_ptr<::arrow::Array>* out);
 
   // NOTE: Experimental API
@@ -196,6 +219,26 @@ class PARQUET_EXPORT FileReader {
   ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                 std::shared_ptr<::arrow::Table>* out);
 
+  /// \brief Read the rows of a row group which pass a filter
+  ///
+  /// The predicate columns are decoded first and passed to the filter. The
+  /// indicated columns are then decoded for the selected rows only: the pages
+  /// without selected rows are not read when the columns have an offset index,
+  /// and the values of the other rows are skipped without being materialized.
+  /// Only columns which are not nested can be read this way.
+  ///
+  /// \param[in] i the row group index
+  /// \param[in] predicate_column_indices the columns passed to the filter
+  /// \param[in] filter the function selecting the rows
+  /// \param[in] column_indices the columns to read. The selected rows of the
+  /// predicate columns among them are taken from their decoded values
+  /// \param[out] out the selected rows of the indicated columns
+  ::arrow::Status ReadFilteredRowGroup(int i,
+                                       const std::vector<int>& predicate_column_indices,
+                                       const RowFilter& filter,
+                                       const std::vector<int>& column_indices,
+                                       std::shared_ptr<::arrow::Table>* out);
+
   /// \brief Scan file contents with one thread, return number of rows
   ::arrow::Status ScanContents(std::vector<int> columns, const int32_t column_batch_size,
                                int64_t* num_rows);
@@ -218,6 +261,12 @@ class PARQUET_EXPORT FileReader {
   /// By default only one thread is used.
   void set_use_threads(bool use_threads);
 
+  /// Set whether ReadTable, ReadRowGroups and GetRecordBatchReader read the selected
+  /// column chunks ahead of decoding with ParquetFileReader::PreBuffer. This reduces the
+  /// number of requests made on high-latency file systems. By default column
+  /// chunks are only read when decoded.
+  void set_pre_buffer(bool pre_buffer);
+
   virtual ~FileReader();
 
  private:
@@ -248,6 +297,9 @@ class PARQUET_EXPORT RowGroupReader {
 
 class PARQUET_EXPORT ColumnChunkReader {
  public:
+  ::arrow::Status Read(std::shared_ptr<::arrow::ChunkedArray>* out);
+
+  // Fails if the column chunk had to be split into several chunks
   ::arrow::Status Read(std::shared_ptr<::arrow::Array>* out);
 
   virtual ~ColumnChunkReader();
@@ -281,6 +333,13 @@ class PARQUET_EXPORT ColumnReader {
   //
   // Returns Status::OK on a successful read, including if you have exhausted
   // the data available in the file.
+  //
+  // BYTE_ARRAY values too large for a single BinaryArray are split into
+  // several chunks.
+  ::arrow::Status NextBatch(int64_t batch_size,
+                            std::shared_ptr<::arrow::ChunkedArray>* out);
+
+  // As above, but fails if the batch had to be split into several chunks
   ::arrow::Status NextBatch(int64_t batch_size, std::shared_ptr<::arrow::Array>* out);
 
  private:
@@ -24,7 +24,9 @@
 #include <sstream>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
@@ -83,7 +85,15 @@ class RecordReader::RecordReaderImpl {
     rep_levels_ = AllocateBuffer(pool);
 
     if (descr->physical_type() == Type::BYTE_ARRAY) {
-      builder_.reset(new ::arrow::BinaryBuilder(pool));
+      // Start a new chunk rather than overflow the 32-bit offsets
+      const auto max_chunk_size = static_cast<int32_t>(::arrow::kBinaryMemoryLimit);
+      if (descr->logical_type() == LogicalType::UTF8) {
+        chunked_builder_.reset(
+            new ::arrow::internal::ChunkedStringBuilder(max_chunk_size, pool));
+      } else {
+        chunked_builder_.reset(
+            new ::arrow::internal::ChunkedBinaryBuilder(max_chunk_size, pool));
+      }
     } else if (descr->physical_type() == Type::FIXED_LEN_BYTE_ARRAY) {
       int byte_width = descr->type_length();
       std::shared_ptr<::arrow::DataType> type = ::arrow::fixed_size_binary(byte_width);
@@ -96,6 +106,8 @@ class RecordReader::RecordReaderImpl {
 
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   // Dictionary decoders must be reset when advancing row groups
   virtual void ResetDecoders() = 0;
 
@@ -143,7 +155,15 @@ class RecordReader::RecordReaderImpl {
     return result;
   }
 
-  ::arrow::ArrayBuilder* builder() { return builder_.get(); }
+  ::arrow::Status GetBuilderChunks(std::vector<std::shared_ptr<::arrow::Array>>* out) {
+    if (chunked_builder_) {
+      return chunked_builder_->Finish(out);
+    }
+    std::shared_ptr<::arrow::Array> chunk;
+    RETURN_NOT_OK(builder_->Finish(&chunk));
+    *out = {chunk};
+    return ::arrow::Status::OK();
+  }
 
   // Process written repetition/definition levels to reach the end of
   // records. Process no more levels than necessary to delimit the indicated
@@ -346,6 +366,7 @@ class RecordReader::RecordReaderImpl {
 
   // TODO(wesm): ByteArray / FixedLenByteArray types
   std::unique_ptr<::arrow::ArrayBuilder> builder_;
+  std::unique_ptr<::arrow::internal::ChunkedBinaryBuilder> chunked_builder_;
 
   std::shared_ptr<::arrow::ResizableBuffer> values_;
 
@@ -389,6 +410,48 @@ class TypedRecordReader : public RecordReader::RecordReaderImpl {
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  // Decode values into a scratch buffer to advance the current decoder. Unlike
+  // ReadValuesDense, this doesn't copy the variable length values
+  void SkipValues(int64_t num_values) {
+    if (skip_buffer_ == nullptr) {
+      skip_buffer_ = AllocateBuffer(pool_);
+      PARQUET_THROW_NOT_OK(skip_buffer_->Resize(kMinLevelBatchSize * sizeof(T), false));
+    }
+    T* scratch = reinterpret_cast<T*>(skip_buffer_->mutable_data());
+    while (num_values > 0) {
+      const int batch_size = static_cast<int>(std::min(num_values, kMinLevelBatchSize));
+      if (current_decoder_->Decode(scratch, batch_size) != batch_size) {
+        throw ParquetException("Could not skip the expected number of values");
+      }
+      num_values -= batch_size;
+    }
+  }
+
+  // Skip the levels and values of records which are at the current position
+  // of the current data page
+  void SkipPageRecords(int64_t num_records) {
+    if (max_def_level_ == 0) {
+      SkipValues(num_records);
+    } else {
+      if (skip_levels_ == nullptr) {
+        skip_levels_ = AllocateBuffer(pool_);
+        PARQUET_THROW_NOT_OK(
+            skip_levels_->Resize(kMinLevelBatchSize * sizeof(int16_t), false));
+      }
+      int16_t* def_levels = reinterpret_cast<int16_t*>(skip_levels_->mutable_data());
+      int64_t levels_to_skip = num_records;
+      while (levels_to_skip > 0) {
+        const int64_t batch_size = std::min(levels_to_skip, kMinLevelBatchSize);
+        if (ReadDefinitionLevels(batch_size, def_levels) != batch_size) {
+          throw ParquetException("Could not skip the expected number of levels");
+        }
+        SkipValues(std::count(def_levels, def_levels + batch_size, max_def_level_));
+        levels_to_skip -= batch_size;
+      }
+    }
+    ConsumeBufferedValues(num_records);
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(const int64_t num_records) {
     // Conservative upper bound
@@ -515,6 +578,36 @@ class TypedRecordReader : public RecordReader::RecordReaderImpl {
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (max_rep_level_ > 0) {
+      ParquetException::NYI("Skipping records of repeated columns");
+    }
+    int64_t records_skipped = 0;
+
+    // Skip the levels decoded by previous reads first. Their values are still
+    // in the current data page.
+    if (levels_position_ < levels_written_) {
+      const int16_t* def_levels = this->def_levels() + levels_position_;
+      records_skipped = std::min(num_records, levels_written_ - levels_position_);
+      SkipValues(std::count(def_levels, def_levels + records_skipped, max_def_level_));
+      levels_position_ += records_skipped;
+      ConsumeBufferedValues(records_skipped);
+    }
+
+    while (records_skipped < num_records && HasNext()) {
+      const int64_t records_to_skip = std::min(num_records - records_skipped,
+                                               available_values_current_page());
+      if (records_to_skip == available_values_current_page()) {
+        // Nothing else is needed from this page, which is left undecoded
+        ConsumeBufferedValues(records_to_skip);
+      } else {
+        SkipPageRecords(records_to_skip);
+      }
+      records_skipped += records_to_skip;
+    }
+    return records_skipped;
+  }
+
  private:
   typedef Decoder<DType> DecoderType;
 
@@ -525,6 +618,10 @@ class TypedRecordReader : public RecordReader::RecordReaderImpl {
 
   DecoderType* current_decoder_;
 
+  // Scratch space for the values and levels decoded by SkipRecords
+  std::shared_ptr<ResizableBuffer> skip_buffer_;
+  std::shared_ptr<ResizableBuffer> skip_levels_;
+
   // Advance to the next data page
   bool ReadNewPage();
 
@@ -538,10 +635,15 @@ inline void TypedRecordReader<ByteArrayType>::ReadValuesDense(int64_t values_to_
       current_decoder_->Decode(values, static_cast<int>(values_to_read));
   DCHECK_EQ(num_decoded, values_to_read);
 
-  auto builder = static_cast<::arrow::BinaryBuilder*>(builder_.get());
+  int64_t data_length = 0;
+  for (int64_t i = 0; i < num_decoded; i++) {
+    data_length += values[i].len;
+  }
+  PARQUET_THROW_NOT_OK(chunked_builder_->Reserve(num_decoded));
+  PARQUET_THROW_NOT_OK(chunked_builder_->ReserveData(data_length));
   for (int64_t i = 0; i < num_decoded; i++) {
     PARQUET_THROW_NOT_OK(
-        builder->Append(values[i].ptr, static_cast<int32_t>(values[i].len)));
+        chunked_builder_->Append(values[i].ptr, static_cast<int32_t>(values[i].len)));
   }
   ResetValues();
 }
@@ -572,14 +674,21 @@ inline void TypedRecordReader<ByteArrayType>::ReadValuesSpaced(int64_t values_to
       valid_bits_offset);
   DCHECK_EQ(num_decoded, values_to_read);
 
-  auto builder = static_cast<::arrow::BinaryBuilder*>(builder_.get());
+  int64_t data_length = 0;
+  for (int64_t i = 0; i < num_decoded; i++) {
+    if (::arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+      data_length += values[i].len;
+    }
+  }
+  PARQUET_THROW_NOT_OK(chunked_builder_->Reserve(num_decoded));
+  PARQUET_THROW_NOT_OK(chunked_builder_->ReserveData(data_length));
 
   for (int64_t i = 0; i < num_decoded; i++) {
     if (::arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
       PARQUET_THROW_NOT_OK(
-          builder->Append(values[i].ptr, static_cast<int32_t>(values[i].len)));
+          chunked_builder_->Append(values[i].ptr, static_cast<int32_t>(values[i].len)));
     } else {
-      PARQUET_THROW_NOT_OK(builder->AppendNull());
+      PARQUET_THROW_NOT_OK(chunked_builder_->AppendNull());
     }
   }
   ResetValues();
@@ -786,6 +895,10 @@ int64_t RecordReader::ReadRecords(int64_t num_records) {
   return impl_->ReadRecords(num_records);
 }
 
+int64_t RecordReader::SkipRecords(int64_t num_records) {
+  return impl_->SkipRecords(num_records);
+}
+
 void RecordReader::Reset() { return impl_->Reset(); }
 
 void RecordReader::Reserve(int64_t num_values) { impl_->Reserve(num_values); }
@@ -804,7 +917,10 @@ std::shared_ptr<ResizableBuffer> RecordReader::ReleaseIsValid() {
   return impl_->ReleaseIsValid();
 }
 
-::arrow::ArrayBuilder* RecordReader::builder() { return impl_->builder(); }
+::arrow::Status RecordReader::GetBuilderChunks(
+    std::vector<std::shared_ptr<::arrow::Array>>* out) {
+  return impl_->GetBuilderChunks(out);
+}
 
 int64_t RecordReader::values_written() const { return impl_->values_written(); }
 
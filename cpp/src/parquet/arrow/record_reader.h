@@ -20,15 +20,17 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/memory_pool.h"
+#include "arrow/status.h"
 
 #include "parquet/util/macros.h"
 #include "parquet/util/memory.h"
 
 namespace arrow {
 
-class ArrayBuilder;
+class Array;
 
 }  // namespace arrow
 
@@ -68,6 +70,12 @@ class RecordReader {
   /// \return number of records read
   int64_t ReadRecords(int64_t num_records);
 
+  /// \brief Skip the indicated number of records without decoding their
+  /// values. The rest of a data page is skipped without decoding its levels
+  /// either. Only supported for non-repeated columns
+  /// \return number of records skipped
+  int64_t SkipRecords(int64_t num_records);
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   void Reserve(int64_t num_values);
 
@@ -77,7 +85,11 @@ class RecordReader {
 
   std::shared_ptr<ResizableBuffer> ReleaseValues();
   std::shared_ptr<ResizableBuffer> ReleaseIsValid();
-  ::arrow::ArrayBuilder* builder();
+
+  /// \brief Finish the values of BYTE_ARRAY and FIXED_LEN_BYTE_ARRAY columns
+  /// read so far into arrays. BYTE_ARRAY values are split into several arrays
+  /// when they don't fit in a single BinaryArray
+  ::arrow::Status GetBuilderChunks(std::vector<std::shared_ptr<::arrow::Array>>* out);
 
   /// \brief Number of values written including nulls (if any)
   int64_t values_written() const;
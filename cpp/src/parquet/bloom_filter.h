@@ -18,6 +18,7 @@
 #ifndef PARQUET_BLOOM_FILTER_H
 #define PARQUET_BLOOM_FILTER_H
 
+#include <cmath>
 #include <cstdint>
 #include <memory>
 
@@ -241,6 +242,59 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   std::unique_ptr<Hasher> hasher_;
 };
 
+// ----------------------------------------------------------------------
+// Typed helpers shared by the column writers and the read-side pruning
+
+/// Compute the Bloom filter hash of a value of the given physical type. The type
+/// length is only used for FIXED_LEN_BYTE_ARRAY values.
+template <typename DType>
+inline uint64_t BloomFilterHash(const BloomFilter& filter,
+                                const typename DType::c_type& value, int type_length) {
+  return filter.Hash(value);
+}
+
+template <>
+inline uint64_t BloomFilterHash<BooleanType>(const BloomFilter& filter,
+                                             const bool& value, int type_length) {
+  ParquetException::NYI("Bloom filters are not supported for BOOLEAN columns");
+  return 0;
+}
+
+template <>
+inline uint64_t BloomFilterHash<Int96Type>(const BloomFilter& filter,
+                                           const Int96& value, int type_length) {
+  return filter.Hash(&value);
+}
+
+template <>
+inline uint64_t BloomFilterHash<ByteArrayType>(const BloomFilter& filter,
+                                               const ByteArray& value, int type_length) {
+  return filter.Hash(&value);
+}
+
+template <>
+inline uint64_t BloomFilterHash<FLBAType>(const BloomFilter& filter, const FLBA& value,
+                                          int type_length) {
+  return filter.Hash(&value, static_cast<uint32_t>(type_length));
+}
+
+/// Evaluate an equality (one value) or IN (several values) predicate against a
+/// Bloom filter.
+///
+/// @return false if none of the values is in the set, true if any of them
+/// PROBABLY is.
+template <typename DType>
+bool BloomFilterMayContain(const BloomFilter& filter,
+                           const typename DType::c_type* values, int64_t num_values,
+                           int type_length = -1) {
+  for (int64_t i = 0; i < num_values; ++i) {
+    if (filter.FindHash(BloomFilterHash<DType>(filter, values[i], type_length))) {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace parquet
 
 #endif  // PARQUET_BLOOM_FILTER_H
@@ -95,15 +95,22 @@ class CompressedDataPage : public DataPage {
   CompressedDataPage(const std::shared_ptr<Buffer>& buffer, int32_t num_values,
                      Encoding::type encoding, Encoding::type definition_level_encoding,
                      Encoding::type repetition_level_encoding, int64_t uncompressed_size,
-                     const EncodedStatistics& statistics = EncodedStatistics())
+                     const EncodedStatistics& statistics = EncodedStatistics(),
+                     int64_t first_row_index = -1)
       : DataPage(buffer, num_values, encoding, definition_level_encoding,
                  repetition_level_encoding, statistics),
-        uncompressed_size_(uncompressed_size) {}
+        uncompressed_size_(uncompressed_size),
+        first_row_index_(first_row_index) {}
 
   int64_t uncompressed_size() const { return uncompressed_size_; }
 
+  // Index within the row group of the first row of the page, or -1 if the
+  // page doesn't start on a row boundary
+  int64_t first_row_index() const { return first_row_index_; }
+
  private:
   int64_t uncompressed_size_;
+  int64_t first_row_index_;
 };
 
 class DataPageV2 : public Page {
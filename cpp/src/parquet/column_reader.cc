@@ -107,11 +107,25 @@ class SerializedPageReader : public PageReader {
       : stream_(std::move(stream)),
         decompression_buffer_(AllocateBuffer(pool, 0)),
         seen_num_rows_(0),
-        total_num_rows_(total_num_rows) {
+        total_num_rows_(total_num_rows),
+        stream_position_(0),
+        has_page_selection_(false),
+        data_pages_start_(0),
+        next_selected_page_(0) {
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
     decompressor_ = GetCodecFromArrow(codec);
   }
 
+  SerializedPageReader(std::unique_ptr<InputStream> stream, int64_t total_num_rows,
+                       Compression::type codec,
+                       const std::vector<PageLocation>& data_pages,
+                       int64_t data_pages_start, ::arrow::MemoryPool* pool)
+      : SerializedPageReader(std::move(stream), total_num_rows, codec, pool) {
+    has_page_selection_ = true;
+    selected_pages_ = data_pages;
+    data_pages_start_ = data_pages_start;
+  }
+
   // Implement the PageReader interface
   std::shared_ptr<Page> NextPage() override;
 
@@ -135,6 +149,16 @@ class SerializedPageReader : public PageReader {
 
   // Number of rows in all the data pages
   int64_t total_num_rows_;
+
+  // Bytes consumed from the stream so far
+  int64_t stream_position_;
+
+  // When reading a subset of the data pages, their locations relative to the
+  // beginning of the stream
+  bool has_page_selection_;
+  std::vector<PageLocation> selected_pages_;
+  int64_t data_pages_start_;
+  size_t next_selected_page_;
 };
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
@@ -147,6 +171,19 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     const uint8_t* buffer;
     uint32_t allowed_page_size = kDefaultPageHeaderSize;
 
+    if (has_page_selection_ && stream_position_ >= data_pages_start_) {
+      // Seek over the data pages which were not selected
+      if (next_selected_page_ == selected_pages_.size()) {
+        return std::shared_ptr<Page>(nullptr);
+      }
+      int64_t page_offset = selected_pages_[next_selected_page_++].offset;
+      if (page_offset < stream_position_) {
+        throw ParquetException("Selected data pages must be ordered by offset");
+      }
+      stream_->Advance(page_offset - stream_position_);
+      stream_position_ = page_offset;
+    }
+
     // Page headers can be very large because of page statistics
     // We try to deserialize a larger buffer progressively
     // until a maximum allowed header limit
@@ -177,6 +214,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     int compressed_len = current_page_header_.compressed_page_size;
     int uncompressed_len = current_page_header_.uncompressed_page_size;
+    stream_position_ += header_size + compressed_len;
 
     // Read the compressed data page.
     buffer = stream_->Read(compressed_len, &bytes_read);
@@ -263,6 +301,16 @@ std::unique_ptr<PageReader> PageReader::Open(std::unique_ptr<InputStream> stream
       new SerializedPageReader(std::move(stream), total_num_rows, codec, pool));
 }
 
+std::unique_ptr<PageReader> PageReader::Open(std::unique_ptr<InputStream> stream,
+                                             int64_t total_num_rows,
+                                             Compression::type codec,
+                                             const std::vector<PageLocation>& data_pages,
+                                             int64_t data_pages_start,
+                                             ::arrow::MemoryPool* pool) {
+  return std::unique_ptr<PageReader>(new SerializedPageReader(
+      std::move(stream), total_num_rows, codec, data_pages, data_pages_start, pool));
+}
+
 // ----------------------------------------------------------------------
 
 ColumnReader::ColumnReader(const ColumnDescriptor* descr,
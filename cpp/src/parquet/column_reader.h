@@ -36,6 +36,7 @@
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/exception.h"
+#include "parquet/metadata.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
 #include "parquet/util/macros.h"
@@ -96,6 +97,15 @@ class PARQUET_EXPORT PageReader {
       Compression::type codec,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
 
+  // Only read the given data pages, seeking over the others. The page offsets
+  // are relative to the beginning of the stream and must be increasing. The
+  // pages before data_pages_start (i.e. the dictionary page) are always read.
+  static std::unique_ptr<PageReader> Open(
+      std::unique_ptr<InputStream> stream, int64_t total_num_rows,
+      Compression::type codec, const std::vector<PageLocation>& data_pages,
+      int64_t data_pages_start,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+
   // @returns: shared_ptr<Page>(nullptr) on EOS, std::shared_ptr<Page>
   // containing new Page otherwise
   virtual std::shared_ptr<Page> NextPage() = 0;
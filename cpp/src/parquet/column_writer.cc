@@ -233,7 +233,8 @@ class SerializedPageWriter : public PageWriter {
     // TODO(PARQUET-594) crc checksum
 
     int64_t start_pos = sink_->Tell();
-    if (data_page_offset_ == 0) {
+    // The first data page may be at offset 0 of an in-memory sink
+    if (num_values_ == 0) {
       data_page_offset_ = start_pos;
     }
 
@@ -245,7 +246,10 @@ class SerializedPageWriter : public PageWriter {
     total_compressed_size_ += compressed_data->size() + header_size;
     num_values_ += page.num_values();
 
-    return sink_->Tell() - start_pos;
+    int64_t page_size = sink_->Tell() - start_pos;
+    metadata_->AddPageIndexEntry(start_pos, static_cast<int32_t>(page_size),
+                                 page.first_row_index(), page.statistics());
+    return page_size;
   }
 
   bool has_compressor() override { return (compressor_ != nullptr); }
@@ -353,10 +357,10 @@ ColumnWriter::ColumnWriter(ColumnChunkMetaDataBuilder* metadata,
       encoding_(encoding),
       properties_(properties),
       allocator_(properties->memory_pool()),
-      pool_(properties->memory_pool()),
       num_buffered_values_(0),
       num_buffered_encoded_values_(0),
       rows_written_(0),
+      page_first_row_index_(0),
       total_bytes_written_(0),
       total_compressed_bytes_(0),
       closed_(false),
@@ -380,6 +384,15 @@ void ColumnWriter::InitSinks() {
   repetition_levels_sink_->Clear();
 }
 
+void ColumnWriter::StartPageIfEmpty(int64_t num_levels, const int16_t* rep_levels) {
+  if (num_buffered_values_ == 0) {
+    // A page continuing the previous page's last row has no valid first row
+    bool continues_row = descr_->max_repetition_level() > 0 && num_levels > 0 &&
+                         rep_levels[0] != 0;
+    page_first_row_index_ = continues_row ? -1 : rows_written_;
+  }
+}
+
 void ColumnWriter::WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
   DCHECK(!closed_);
   definition_levels_sink_->Write(reinterpret_cast<const uint8_t*>(levels),
@@ -468,13 +481,14 @@ void ColumnWriter::AddDataPage() {
                                                &compressed_data_copy));
     CompressedDataPage page(compressed_data_copy,
                             static_cast<int32_t>(num_buffered_values_), encoding_,
-                            Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats);
+                            Encoding::RLE, Encoding::RLE, uncompressed_size, page_stats,
+                            page_first_row_index_);
     total_compressed_bytes_ += page.size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page));
   } else {  // Eagerly write pages
     CompressedDataPage page(compressed_data, static_cast<int32_t>(num_buffered_values_),
                             encoding_, Encoding::RLE, Encoding::RLE, uncompressed_size,
-                            page_stats);
+                            page_stats, page_first_row_index_);
     WriteDataPage(page);
   }
 
@@ -547,7 +561,7 @@ TypedColumnWriter<Type>::TypedColumnWriter(ColumnChunkMetaDataBuilder* metadata,
     case Encoding::PLAIN_DICTIONARY:
     case Encoding::RLE_DICTIONARY:
       current_encoder_.reset(
-          new DictEncoder<Type>(descr_, &pool_, properties->memory_pool()));
+          new DictEncoder<Type>(descr_, properties->memory_pool()));
       break;
     default:
       ParquetException::NYI("Selected encoding is not supported");
@@ -558,6 +572,17 @@ TypedColumnWriter<Type>::TypedColumnWriter(ColumnChunkMetaDataBuilder* metadata,
     page_statistics_ = std::unique_ptr<TypedStats>(new TypedStats(descr_, allocator_));
     chunk_statistics_ = std::unique_ptr<TypedStats>(new TypedStats(descr_, allocator_));
   }
+
+  if (properties->bloom_filter_enabled(descr_->path()) &&
+      descr_->physical_type() != ::parquet::Type::BOOLEAN) {
+    // Sized once for the expected number of distinct values of the column chunk
+    uint32_t num_bits = BlockSplitBloomFilter::OptimalNumOfBits(
+        static_cast<uint32_t>(properties->bloom_filter_ndv(descr_->path())),
+        properties->bloom_filter_fpp(descr_->path()));
+    std::unique_ptr<BlockSplitBloomFilter> filter(new BlockSplitBloomFilter());
+    filter->Init(num_bits / 8);
+    bloom_filter_ = std::move(filter);
+  }
 }
 
 // Only one Dictionary Page is written.
@@ -582,8 +607,6 @@ void TypedColumnWriter<Type>::WriteDictionaryPage() {
   std::shared_ptr<ResizableBuffer> buffer =
       AllocateBuffer(properties_->memory_pool(), dict_encoder->dict_encoded_size());
   dict_encoder->WriteDict(buffer->mutable_data());
-  // TODO Get rid of this deep call
-  dict_encoder->mem_pool()->FreeAll();
 
   DictionaryPage page(buffer, dict_encoder->num_entries(),
                       properties_->dictionary_index_encoding());
@@ -664,6 +687,8 @@ inline int64_t TypedColumnWriter<DType>::WriteMiniBatch(int64_t num_values,
                                                         const int16_t* def_levels,
                                                         const int16_t* rep_levels,
                                                         const T* values) {
+  StartPageIfEmpty(num_values, rep_levels);
+
   int64_t values_to_write = 0;
   // If the field is required and non-repeated, there are no definition levels
   if (descr_->max_definition_level() > 0) {
@@ -705,6 +730,9 @@ inline int64_t TypedColumnWriter<DType>::WriteMiniBatch(int64_t num_values,
   if (page_statistics_ != nullptr) {
     page_statistics_->Update(values, values_to_write, num_values - values_to_write);
   }
+  if (bloom_filter_ != nullptr) {
+    UpdateBloomFilter(values_to_write, values);
+  }
 
   num_buffered_values_ += num_values;
   num_buffered_encoded_values_ += values_to_write;
@@ -724,6 +752,8 @@ inline int64_t TypedColumnWriter<DType>::WriteMiniBatchSpaced(
     int64_t num_values, const int16_t* def_levels, const int16_t* rep_levels,
     const uint8_t* valid_bits, int64_t valid_bits_offset, const T* values,
     int64_t* num_spaced_written) {
+  StartPageIfEmpty(num_values, rep_levels);
+
   int64_t values_to_write = 0;
   int64_t spaced_values_to_write = 0;
   // If the field is required and non-repeated, there are no definition levels
@@ -776,6 +806,14 @@ inline int64_t TypedColumnWriter<DType>::WriteMiniBatchSpaced(
     page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, values_to_write,
                                    num_values - values_to_write);
   }
+  if (bloom_filter_ != nullptr) {
+    if (descr_->schema_node()->is_optional()) {
+      UpdateBloomFilterSpaced(spaced_values_to_write, valid_bits, valid_bits_offset,
+                              values);
+    } else {
+      UpdateBloomFilter(values_to_write, values);
+    }
+  }
 
   num_buffered_values_ += num_values;
   num_buffered_encoded_values_ += values_to_write;
@@ -856,6 +894,32 @@ void TypedColumnWriter<DType>::WriteValuesSpaced(int64_t num_values,
                               valid_bits_offset);
 }
 
+template <typename DType>
+void TypedColumnWriter<DType>::UpdateBloomFilter(int64_t num_values, const T* values) {
+  const int type_length = descr_->type_length();
+  for (int64_t i = 0; i < num_values; i++) {
+    bloom_filter_->InsertHash(
+        BloomFilterHash<DType>(*bloom_filter_, values[i], type_length));
+  }
+}
+
+template <typename DType>
+void TypedColumnWriter<DType>::UpdateBloomFilterSpaced(int64_t num_values,
+                                                       const uint8_t* valid_bits,
+                                                       int64_t valid_bits_offset,
+                                                       const T* values) {
+  const int type_length = descr_->type_length();
+  ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+  for (int64_t i = 0; i < num_values; i++) {
+    if (valid_bits_reader.IsSet()) {
+      bloom_filter_->InsertHash(
+          BloomFilterHash<DType>(*bloom_filter_, values[i], type_length));
+    }
+    valid_bits_reader.Next();
+  }
+}
+
 template class PARQUET_TEMPLATE_EXPORT TypedColumnWriter<BooleanType>;
 template class PARQUET_TEMPLATE_EXPORT TypedColumnWriter<Int32Type>;
 template class PARQUET_TEMPLATE_EXPORT TypedColumnWriter<Int64Type>;
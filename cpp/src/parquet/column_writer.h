@@ -21,6 +21,7 @@
 #include <memory>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/metadata.h"
@@ -133,6 +134,11 @@ class PARQUET_EXPORT ColumnWriter {
 
   const WriterProperties* properties() { return properties_; }
 
+  // The Bloom filter built from the values written to this column chunk, or
+  // nullptr if Bloom filters are not enabled for the column. The caller takes
+  // ownership; it should only be released once the writer has been closed.
+  std::unique_ptr<BloomFilter> ReleaseBloomFilter() { return std::move(bloom_filter_); }
+
  protected:
   virtual std::shared_ptr<Buffer> GetValuesBuffer() = 0;
 
@@ -161,6 +167,9 @@ class PARQUET_EXPORT ColumnWriter {
   // Serializes Data Pages
   void WriteDataPage(const CompressedDataPage& page);
 
+  // Records the first row of the data page when a mini batch starts a new page
+  void StartPageIfEmpty(int64_t num_levels, const int16_t* rep_levels);
+
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels);
 
@@ -186,7 +195,6 @@ class PARQUET_EXPORT ColumnWriter {
   LevelEncoder level_encoder_;
 
   ::arrow::MemoryPool* allocator_;
-  ChunkedAllocator pool_;
 
   // The total number of values stored in the data page. This is the maximum of
   // the number of encoded definition levels or encoded values. For
@@ -203,6 +211,10 @@ class PARQUET_EXPORT ColumnWriter {
   // Total number of rows written with this ColumnWriter
   int rows_written_;
 
+  // Index of the first row of the buffered data page, -1 if the page doesn't
+  // start on a row boundary
+  int64_t page_first_row_index_;
+
   // Records the total number of bytes written by the serializer
   int64_t total_bytes_written_;
 
@@ -226,6 +238,9 @@ class PARQUET_EXPORT ColumnWriter {
 
   std::vector<CompressedDataPage> data_pages_;
 
+  // Populated with the hashes of all non-null values when enabled for the column
+  std::unique_ptr<BloomFilter> bloom_filter_;
+
  private:
   void InitSinks();
 };
@@ -305,6 +320,12 @@ class PARQUET_TEMPLATE_CLASS_EXPORT TypedColumnWriter : public ColumnWriter {
   void WriteValues(int64_t num_values, const T* values);
   void WriteValuesSpaced(int64_t num_values, const uint8_t* valid_bits,
                          int64_t valid_bits_offset, const T* values);
+
+  // Insert the hashes of the non-null values into the Bloom filter
+  void UpdateBloomFilter(int64_t num_values, const T* values);
+  void UpdateBloomFilterSpaced(int64_t num_values, const uint8_t* valid_bits,
+                               int64_t valid_bits_offset, const T* values);
+
   std::unique_ptr<EncoderType> current_encoder_;
 
   typedef TypedRowGroupStatistics<DType> TypedStats;
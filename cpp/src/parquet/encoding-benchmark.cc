@@ -17,11 +17,15 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/util/bpacking.h"
+#include "arrow/util/cpu-info.h"
+
 #include "parquet/encoding-internal.h"
 #include "parquet/util/memory.h"
 
 using arrow::default_memory_pool;
 using arrow::MemoryPool;
+using arrow::internal::CpuInfo;
 
 namespace parquet {
 
@@ -104,14 +108,12 @@ static void DecodeDict(std::vector<typename Type::c_type>& values,
   typedef typename Type::c_type T;
   int num_values = static_cast<int>(values.size());
 
-  ChunkedAllocator pool;
   MemoryPool* allocator = default_memory_pool();
   std::shared_ptr<ColumnDescriptor> descr = Int64Schema(Repetition::REQUIRED);
 
-  DictEncoder<Type> encoder(descr.get(), &pool, allocator);
+  DictEncoder<Type> encoder(descr.get(), allocator);
   for (int i = 0; i < num_values; ++i) {
-    // No SSE
-    encoder.template Put<false>(values[i]);
+    encoder.Put(values[i]);
   }
 
   std::shared_ptr<ResizableBuffer> dict_buffer =
@@ -162,6 +164,58 @@ static void BM_DictDecodingInt64_literals(::benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(1024, 65536);
 
+// ----------------------------------------------------------------------
+// Bit unpacking, one benchmark per bit width and implementation
+
+typedef int (*UnpackFunc)(const uint32_t*, uint32_t*, int, int);
+
+static void BenchmarkUnpack32(UnpackFunc unpack, ::benchmark::State& state) {
+  const int num_bits = static_cast<int>(state.range(0));
+  const int num_values = 4096;
+  // Any bit pattern is a valid packed input
+  std::vector<uint32_t> packed(num_values * num_bits / 32 + 1);
+  for (size_t i = 0; i < packed.size(); ++i) {
+    packed[i] = static_cast<uint32_t>(i * 2654435761U);
+  }
+  std::vector<uint32_t> unpacked(num_values);
+
+  while (state.KeepRunning()) {
+    ::benchmark::DoNotOptimize(
+        unpack(packed.data(), unpacked.data(), num_values, num_bits));
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+static void BM_Unpack32Scalar(::benchmark::State& state) {
+  BenchmarkUnpack32(arrow::internal::unpack32_default, state);
+}
+
+BENCHMARK(BM_Unpack32Scalar)->DenseRange(1, 32);
+
+#ifdef ARROW_HAVE_AVX2
+static void BM_Unpack32AVX2(::benchmark::State& state) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    state.SkipWithError("CPU does not support AVX2");
+    return;
+  }
+  BenchmarkUnpack32(arrow::internal::unpack32_avx2, state);
+}
+
+BENCHMARK(BM_Unpack32AVX2)->DenseRange(1, 32);
+#endif
+
+#ifdef ARROW_HAVE_AVX512
+static void BM_Unpack32AVX512(::benchmark::State& state) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    state.SkipWithError("CPU does not support AVX-512");
+    return;
+  }
+  BenchmarkUnpack32(arrow::internal::unpack32_avx512, state);
+}
+
+BENCHMARK(BM_Unpack32AVX512)->DenseRange(1, 32);
+#endif
+
 }  // namespace benchmark
 
 }  // namespace parquet
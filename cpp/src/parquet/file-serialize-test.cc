@@ -305,6 +305,334 @@ TYPED_TEST(TestSerialize, SmallFileZstd) {
   ASSERT_NO_FATAL_FAILURE(this->FileSerializeTest(Compression::ZSTD));
 }
 
+TEST(TestBloomFilterSerialize, PruneRowGroups) {
+  const int num_rowgroups = 4;
+  const int rows_per_rowgroup = 100;
+
+  auto gnode = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("a", Repetition::OPTIONAL, Type::INT64),
+       PrimitiveNode::Make("b", Repetition::REQUIRED, Type::INT64)}));
+
+  WriterProperties::Builder prop_builder;
+  prop_builder.enable_bloom_filter("a", 1000, 0.01);
+  std::shared_ptr<InMemoryOutputStream> sink(new InMemoryOutputStream());
+  auto file_writer = ParquetFileWriter::Open(sink, gnode, prop_builder.build());
+
+  // Row group rg holds the values [rg * 1000, rg * 1000 + rows_per_rowgroup), with
+  // every tenth value of the optional column being null
+  std::vector<int64_t> values(rows_per_rowgroup);
+  std::vector<int16_t> def_levels(rows_per_rowgroup);
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(rows_per_rowgroup), 0);
+  for (int rg = 0; rg < num_rowgroups; ++rg) {
+    for (int i = 0; i < rows_per_rowgroup; ++i) {
+      values[i] = rg * 1000 + i;
+      def_levels[i] = (i % 10 == 0) ? 0 : 1;
+      if (def_levels[i]) {
+        ::arrow::BitUtil::SetBit(valid_bits.data(), i);
+      } else {
+        ::arrow::BitUtil::ClearBit(valid_bits.data(), i);
+      }
+    }
+    // Alternate between unbuffered and buffered row groups and between the
+    // dense and spaced write paths
+    RowGroupWriter* row_group_writer = (rg % 2 == 0)
+                                           ? file_writer->AppendRowGroup()
+                                           : file_writer->AppendBufferedRowGroup();
+    for (int col = 0; col < 2; ++col) {
+      auto column_writer = static_cast<Int64Writer*>(
+          (rg % 2 == 0) ? row_group_writer->NextColumn() : row_group_writer->column(col));
+      if (col == 1) {
+        column_writer->WriteBatch(rows_per_rowgroup, nullptr, nullptr, values.data());
+      } else if (rg % 2 == 0) {
+        std::vector<int64_t> dense_values;
+        for (int i = 0; i < rows_per_rowgroup; ++i) {
+          if (def_levels[i]) dense_values.push_back(values[i]);
+        }
+        column_writer->WriteBatch(rows_per_rowgroup, def_levels.data(), nullptr,
+                                  dense_values.data());
+      } else {
+        column_writer->WriteBatchSpaced(rows_per_rowgroup, def_levels.data(), nullptr,
+                                        valid_bits.data(), 0, values.data());
+      }
+    }
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(sink->GetBuffer());
+  auto file_reader = ParquetFileReader::Open(source);
+  ASSERT_EQ(num_rowgroups, file_reader->metadata()->num_row_groups());
+
+  for (int rg = 0; rg < num_rowgroups; ++rg) {
+    auto rg_reader = file_reader->RowGroup(rg);
+    ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_EQ(nullptr, rg_reader->GetColumnBloomFilter(1));
+
+    std::unique_ptr<BloomFilter> filter = rg_reader->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, filter);
+    for (int i = 1; i < rows_per_rowgroup; ++i) {
+      if (i % 10 != 0) {
+        ASSERT_TRUE(filter->FindHash(filter->Hash(static_cast<int64_t>(rg * 1000 + i))));
+      }
+    }
+
+    // The Bloom filters don't disturb reading the column chunks
+    auto col_reader = std::static_pointer_cast<Int64Reader>(rg_reader->Column(1));
+    std::vector<int64_t> values_out(rows_per_rowgroup);
+    int64_t values_read;
+    col_reader->ReadBatch(rows_per_rowgroup, nullptr, nullptr, values_out.data(),
+                          &values_read);
+    ASSERT_EQ(rows_per_rowgroup, values_read);
+    ASSERT_EQ(rg * 1000, values_out[0]);
+  }
+
+  // Equality predicates
+  ASSERT_EQ(std::vector<int>({2}),
+            FilterRowGroupsByBloomFilter<Int64Type>(file_reader.get(), 0, {2005}));
+  ASSERT_EQ(std::vector<int>(),
+            FilterRowGroupsByBloomFilter<Int64Type>(file_reader.get(), 0, {500}));
+  // IN predicate
+  ASSERT_EQ(std::vector<int>({0, 3}), FilterRowGroupsByBloomFilter<Int64Type>(
+                                          file_reader.get(), 0, {1, 500, 3099}));
+  // Columns without Bloom filters can't be pruned
+  ASSERT_EQ(std::vector<int>({0, 1, 2, 3}),
+            FilterRowGroupsByBloomFilter<Int64Type>(file_reader.get(), 1, {500}));
+}
+
+TEST(TestBloomFilterSerialize, InvalidProperties) {
+  WriterProperties::Builder prop_builder;
+  ASSERT_THROW(prop_builder.enable_bloom_filter("a", 0), ParquetException);
+  ASSERT_THROW(prop_builder.enable_bloom_filter("a", 1000, 0.0), ParquetException);
+  ASSERT_THROW(prop_builder.enable_bloom_filter("a", 1000, 1.0), ParquetException);
+
+  auto props = prop_builder.enable_bloom_filter("a")->disable_bloom_filter("b")->build();
+  ASSERT_TRUE(props->bloom_filter_enabled(schema::ColumnPath::FromDotString("a")));
+  ASSERT_FALSE(props->bloom_filter_enabled(schema::ColumnPath::FromDotString("b")));
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_NDV,
+            props->bloom_filter_ndv(schema::ColumnPath::FromDotString("a")));
+}
+
+TEST(TestPageIndexSerialize, SkipPages) {
+  const int num_rowgroups = 2;
+  const int num_rows = 2000;
+
+  // Optional INT32 column "b" has different page boundaries than INT64 "a"
+  auto gnode = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT64),
+       PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::INT32)}));
+
+  WriterProperties::Builder prop_builder;
+  prop_builder.enable_page_index()
+      ->disable_dictionary()
+      ->data_pagesize(1024)
+      ->write_batch_size(100);
+  std::shared_ptr<InMemoryOutputStream> sink(new InMemoryOutputStream());
+  auto file_writer = ParquetFileWriter::Open(sink, gnode, prop_builder.build());
+
+  std::vector<int64_t> a_values(num_rows);
+  std::vector<int32_t> b_values;
+  std::vector<int16_t> b_def_levels(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    a_values[i] = i;
+    b_def_levels[i] = (i % 5 == 0) ? 0 : 1;
+    if (b_def_levels[i]) b_values.push_back(i % 7);
+  }
+  for (int rg = 0; rg < num_rowgroups; ++rg) {
+    bool buffered = rg % 2 == 1;
+    RowGroupWriter* row_group_writer = buffered ? file_writer->AppendBufferedRowGroup()
+                                                : file_writer->AppendRowGroup();
+    auto a_writer = static_cast<Int64Writer*>(buffered ? row_group_writer->column(0)
+                                                       : row_group_writer->NextColumn());
+    a_writer->WriteBatch(num_rows, nullptr, nullptr, a_values.data());
+    auto b_writer = static_cast<Int32Writer*>(buffered ? row_group_writer->column(1)
+                                                       : row_group_writer->NextColumn());
+    b_writer->WriteBatch(num_rows, b_def_levels.data(), nullptr, b_values.data());
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(sink->GetBuffer());
+  auto file_reader = ParquetFileReader::Open(source);
+
+  for (int rg = 0; rg < num_rowgroups; ++rg) {
+    auto rg_reader = file_reader->RowGroup(rg);
+    for (int col = 0; col < 2; ++col) {
+      ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(col)->has_column_index());
+      ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(col)->has_offset_index());
+    }
+
+    std::unique_ptr<OffsetIndex> offset_index = rg_reader->GetOffsetIndex(0);
+    std::unique_ptr<ColumnIndex> column_index = rg_reader->GetColumnIndex(0);
+    ASSERT_GT(offset_index->num_pages(), 1);
+    ASSERT_EQ(offset_index->num_pages(), column_index->num_pages());
+    const std::vector<PageLocation>& pages = offset_index->page_locations();
+    ASSERT_EQ(rg_reader->metadata()->ColumnChunk(0)->data_page_offset(), pages[0].offset);
+    for (int p = 0; p < offset_index->num_pages(); ++p) {
+      // The values of "a" are the row indices
+      int64_t min_value, max_value;
+      ASSERT_FALSE(column_index->null_page(p));
+      memcpy(&min_value, column_index->encoded_min(p).data(), sizeof(int64_t));
+      memcpy(&max_value, column_index->encoded_max(p).data(), sizeof(int64_t));
+      ASSERT_EQ(pages[p].first_row_index, min_value);
+      int64_t next_first_row =
+          p + 1 < offset_index->num_pages() ? pages[p + 1].first_row_index : num_rows;
+      ASSERT_EQ(next_first_row - 1, max_value);
+      ASSERT_EQ(0, column_index->null_count(p));
+    }
+    ASSERT_GT(rg_reader->GetColumnIndex(1)->null_count(0), 0);
+
+    std::vector<RowRange> selected_rows;
+    auto readers = rg_reader->ColumnsForRowRanges({0, 1}, {{1010, 1020}, {1500, 1500}},
+                                                  &selected_rows);
+    ASSERT_EQ(2, static_cast<int>(readers.size()));
+    int64_t num_selected_rows = 0;
+    for (const RowRange& range : selected_rows) {
+      num_selected_rows += range.last - range.first + 1;
+    }
+    ASSERT_LE(selected_rows[0].first, 1010);
+    ASSERT_GE(selected_rows.back().last, 1500);
+    ASSERT_LT(num_selected_rows, num_rows);
+
+    auto a_reader = std::static_pointer_cast<Int64Reader>(readers[0]);
+    auto b_reader = std::static_pointer_cast<Int32Reader>(readers[1]);
+    std::vector<int64_t> a_out(num_rows);
+    std::vector<int32_t> b_out(num_rows);
+    std::vector<int16_t> def_levels_out(num_rows);
+    int64_t a_read = 0, b_read = 0, values_read;
+    while (a_reader->HasNext()) {
+      a_read += a_reader->ReadBatch(num_rows, nullptr, nullptr, a_out.data() + a_read,
+                                    &values_read);
+    }
+    int64_t b_levels_read = 0;
+    while (b_reader->HasNext()) {
+      b_levels_read +=
+          b_reader->ReadBatch(num_rows, def_levels_out.data() + b_levels_read, nullptr,
+                              b_out.data() + b_read, &values_read);
+      b_read += values_read;
+    }
+    ASSERT_EQ(num_selected_rows, a_read);
+    ASSERT_EQ(num_selected_rows, b_levels_read);
+
+    // Both readers return the same rows
+    int64_t row_pos = 0, b_pos = 0;
+    for (const RowRange& range : selected_rows) {
+      for (int64_t row = range.first; row <= range.last; ++row, ++row_pos) {
+        ASSERT_EQ(row, a_out[row_pos]);
+        ASSERT_EQ(b_def_levels[row], def_levels_out[row_pos]);
+        if (b_def_levels[row]) {
+          ASSERT_EQ(row % 7, b_out[b_pos++]);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestPageIndexSerialize, BoundaryOrder) {
+  const int num_rows = 2000;
+
+  auto gnode = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("ascending", Repetition::REQUIRED, Type::INT64),
+       PrimitiveNode::Make("descending", Repetition::REQUIRED, Type::INT64),
+       PrimitiveNode::Make("unordered", Repetition::REQUIRED, Type::INT64),
+       PrimitiveNode::Make("constant", Repetition::OPTIONAL, Type::INT64)}));
+
+  WriterProperties::Builder prop_builder;
+  prop_builder.enable_page_index()
+      ->disable_dictionary()
+      ->data_pagesize(1024)
+      ->write_batch_size(100);
+  std::shared_ptr<InMemoryOutputStream> sink(new InMemoryOutputStream());
+  auto file_writer = ParquetFileWriter::Open(sink, gnode, prop_builder.build());
+
+  std::vector<std::vector<int64_t>> values(4, std::vector<int64_t>(num_rows));
+  std::vector<int16_t> def_levels(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    values[0][i] = i / 10 - 50;
+    values[1][i] = num_rows - i;
+    values[2][i] = (i % 1000 < 500) ? i : -i;
+    values[3][i] = 42;
+    // Nulls do not affect the order
+    def_levels[i] = (i >= 500 && i < 1000) ? 0 : 1;
+  }
+  RowGroupWriter* row_group_writer = file_writer->AppendRowGroup();
+  for (int col = 0; col < 4; ++col) {
+    auto writer = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+    writer->WriteBatch(num_rows, col == 3 ? def_levels.data() : nullptr, nullptr,
+                       values[col].data());
+  }
+  row_group_writer->Close();
+  file_writer->Close();
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(sink->GetBuffer());
+  auto file_reader = ParquetFileReader::Open(source);
+  auto rg_reader = file_reader->RowGroup(0);
+  for (int col = 0; col < 4; ++col) {
+    ASSERT_GT(rg_reader->GetColumnIndex(col)->num_pages(), 2);
+  }
+  ASSERT_EQ(BoundaryOrder::ASCENDING, rg_reader->GetColumnIndex(0)->boundary_order());
+  ASSERT_EQ(BoundaryOrder::DESCENDING, rg_reader->GetColumnIndex(1)->boundary_order());
+  ASSERT_EQ(BoundaryOrder::UNORDERED, rg_reader->GetColumnIndex(2)->boundary_order());
+  ASSERT_EQ(BoundaryOrder::ASCENDING, rg_reader->GetColumnIndex(3)->boundary_order());
+}
+
+TEST(TestPreBuffer, ReadPreBufferedColumnChunks) {
+  const int num_rowgroups = 3;
+  const int num_rows = 100;
+
+  auto gnode = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT64),
+       PrimitiveNode::Make("b", Repetition::REQUIRED, Type::INT64)}));
+
+  std::shared_ptr<InMemoryOutputStream> sink(new InMemoryOutputStream());
+  auto file_writer = ParquetFileWriter::Open(sink, gnode);
+  std::vector<int64_t> values(num_rows);
+  for (int rg = 0; rg < num_rowgroups; ++rg) {
+    RowGroupWriter* row_group_writer = file_writer->AppendRowGroup();
+    for (int col = 0; col < 2; ++col) {
+      for (int i = 0; i < num_rows; ++i) {
+        values[i] = (rg * 2 + col) * num_rows + i;
+      }
+      auto column_writer = static_cast<Int64Writer*>(row_group_writer->NextColumn());
+      column_writer->WriteBatch(num_rows, nullptr, nullptr, values.data());
+    }
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+
+  ReaderProperties properties;
+  properties.set_pre_buffer_memory_limit(1);
+  auto source = std::make_shared<::arrow::io::BufferReader>(sink->GetBuffer());
+  auto file_reader = ParquetFileReader::Open(source, properties);
+
+  ASSERT_THROW(file_reader->PreBuffer({num_rowgroups}, {0}), ParquetException);
+  ASSERT_THROW(file_reader->PreBuffer({0}, {2}), ParquetException);
+
+  // Pre-buffered column chunks are served once, and read again from the file
+  // afterwards
+  file_reader->PreBuffer({2, 0}, {1, 0});
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int rg : {0, 2}) {
+      auto rg_reader = file_reader->RowGroup(rg);
+      for (int col : {1, 0}) {
+        auto column_reader =
+            std::static_pointer_cast<Int64Reader>(rg_reader->Column(col));
+        int64_t values_read = 0;
+        ASSERT_EQ(num_rows, column_reader->ReadBatch(num_rows, nullptr, nullptr,
+                                                     values.data(), &values_read));
+        ASSERT_EQ(num_rows, values_read);
+        for (int i = 0; i < num_rows; ++i) {
+          ASSERT_EQ((rg * 2 + col) * num_rows + i, values[i]);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace test
 
 }  // namespace parquet
@@ -35,6 +35,7 @@
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
 #include "parquet/properties.h"
+#include "parquet/read_planner.h"
 #include "parquet/thrift.h"
 #include "parquet/types.h"
 #include "parquet/util/memory.h"
@@ -51,6 +52,29 @@ static constexpr uint8_t PARQUET_MAGIC[4] = {'P', 'A', 'R', '1'};
 // For PARQUET-816
 static constexpr int64_t kMaxDictHeaderSize = 100;
 
+static ReadRange ComputeColumnChunkRange(const FileMetaData& file_metadata,
+                                         int64_t source_size,
+                                         const ColumnChunkMetaData& col) {
+  int64_t col_start = col.data_page_offset();
+  if (col.has_dictionary_page() && col_start > col.dictionary_page_offset()) {
+    col_start = col.dictionary_page_offset();
+  }
+
+  int64_t col_length = col.total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata.writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t bytes_remaining = source_size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+  return {col_start, col_length};
+}
+
 // ----------------------------------------------------------------------
 // RowGroupReader public API
 
@@ -76,6 +100,159 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnBloomFilter(i);
+}
+
+std::unique_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::unique_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
+namespace {
+
+// Sort the ranges and merge the overlapping or adjacent ones
+std::vector<RowRange> NormalizeRowRanges(std::vector<RowRange> ranges) {
+  std::sort(ranges.begin(), ranges.end(),
+            [](const RowRange& a, const RowRange& b) { return a.first < b.first; });
+  std::vector<RowRange> result;
+  for (const RowRange& range : ranges) {
+    if (range.first > range.last) {
+      continue;
+    }
+    if (!result.empty() && range.first <= result.back().last + 1) {
+      result.back().last = std::max(result.back().last, range.last);
+    } else {
+      result.push_back(range);
+    }
+  }
+  return result;
+}
+
+bool Overlaps(const std::vector<RowRange>& ranges, const RowRange& span) {
+  for (const RowRange& range : ranges) {
+    if (range.first <= span.last && span.first <= range.last) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Rows held by the i-th page of a column chunk
+RowRange PageRowSpan(const std::vector<PageLocation>& pages, size_t i,
+                     int64_t num_rows) {
+  int64_t last = (i + 1 < pages.size()) ? pages[i + 1].first_row_index - 1 : num_rows - 1;
+  return {pages[i].first_row_index, last};
+}
+
+}  // namespace
+
+std::vector<std::shared_ptr<ColumnReader>> RowGroupReader::ColumnsForRowRanges(
+    const std::vector<int>& columns, const std::vector<RowRange>& row_ranges,
+    std::vector<RowRange>* selected_rows) {
+  const int64_t num_rows = metadata()->num_rows();
+  ::arrow::MemoryPool* pool =
+      const_cast<ReaderProperties*>(contents_->properties())->memory_pool();
+
+  std::vector<std::unique_ptr<OffsetIndex>> offset_indexes;
+  for (int i : columns) {
+    std::unique_ptr<OffsetIndex> offset_index = GetOffsetIndex(i);
+    if (offset_index == nullptr) {
+      // Can't skip pages of this column, read everything
+      *selected_rows = {{0, num_rows - 1}};
+      std::vector<std::shared_ptr<ColumnReader>> readers;
+      for (int j : columns) {
+        readers.push_back(Column(j));
+      }
+      return readers;
+    }
+    offset_indexes.push_back(std::move(offset_index));
+  }
+
+  std::vector<RowRange> ranges = row_ranges;
+  for (RowRange& range : ranges) {
+    range.first = std::max<int64_t>(range.first, 0);
+    range.last = std::min(range.last, num_rows - 1);
+  }
+  ranges = NormalizeRowRanges(std::move(ranges));
+
+  // Widen the ranges to whole pages of all the columns until reaching a fixed
+  // point: then the pages of each column overlapping the ranges cover exactly
+  // the ranges.
+  bool changed = true;
+  while (changed) {
+    std::vector<RowRange> widened = ranges;
+    for (const auto& offset_index : offset_indexes) {
+      const std::vector<PageLocation>& pages = offset_index->page_locations();
+      for (size_t p = 0; p < pages.size(); p++) {
+        RowRange span = PageRowSpan(pages, p, num_rows);
+        if (Overlaps(ranges, span)) {
+          widened.push_back(span);
+        }
+      }
+    }
+    widened = NormalizeRowRanges(std::move(widened));
+    changed = widened.size() != ranges.size() ||
+              !std::equal(ranges.begin(), ranges.end(), widened.begin(),
+                          [](const RowRange& a, const RowRange& b) {
+                            return a.first == b.first && a.last == b.last;
+                          });
+    ranges = std::move(widened);
+  }
+  *selected_rows = ranges;
+
+  std::vector<std::shared_ptr<ColumnReader>> readers;
+  for (size_t c = 0; c < columns.size(); c++) {
+    const std::vector<PageLocation>& pages = offset_indexes[c]->page_locations();
+    std::vector<PageLocation> selected_pages;
+    for (size_t p = 0; p < pages.size(); p++) {
+      if (Overlaps(ranges, PageRowSpan(pages, p, num_rows))) {
+        selected_pages.push_back(pages[p]);
+      }
+    }
+    const ColumnDescriptor* descr = metadata()->schema()->Column(columns[c]);
+    readers.push_back(ColumnReader::Make(
+        descr, contents_->GetColumnPageReader(columns[c], selected_pages), pool));
+  }
+  return readers;
+}
+
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const std::vector<RowRange>& row_ranges,
+    std::vector<RowRange>* selected_rows) {
+  const int64_t num_rows = metadata()->num_rows();
+  std::unique_ptr<OffsetIndex> offset_index = GetOffsetIndex(i);
+  if (offset_index == nullptr) {
+    *selected_rows = {{0, num_rows - 1}};
+    return contents_->GetColumnPageReader(i);
+  }
+
+  const std::vector<PageLocation>& pages = offset_index->page_locations();
+  std::vector<PageLocation> selected_pages;
+  std::vector<RowRange> page_rows;
+  for (size_t p = 0; p < pages.size(); p++) {
+    RowRange span = PageRowSpan(pages, p, num_rows);
+    if (Overlaps(row_ranges, span)) {
+      selected_pages.push_back(pages[p]);
+      page_rows.push_back(span);
+    }
+  }
+  *selected_rows = NormalizeRowRanges(std::move(page_rows));
+  return contents_->GetColumnPageReader(i, selected_pages);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -83,8 +260,12 @@ const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->met
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
   SerializedRowGroup(RandomAccessSource* source, FileMetaData* file_metadata,
-                     int row_group_number, const ReaderProperties& props)
-      : source_(source), file_metadata_(file_metadata), properties_(props) {
+                     int row_group_number, const ReaderProperties& props,
+                     const std::shared_ptr<ReadPlanner>& read_planner)
+      : source_(source),
+        file_metadata_(file_metadata),
+        properties_(props),
+        read_planner_(read_planner) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -96,36 +277,122 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
+    int64_t col_start, col_length;
+    GetColumnChunkRange(*col, &col_start, &col_length);
+    std::shared_ptr<Buffer> buffer;
+    if (read_planner_) {
+      // Only set if the column chunk was pre-buffered and not read yet
+      buffer = read_planner_->Read({col_start, col_length});
     }
-
-    int64_t col_length = col->total_compressed_size();
     std::unique_ptr<InputStream> stream;
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t bytes_remaining = source_->Size() - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+    if (buffer) {
+      stream.reset(new InMemoryInputStream(buffer));
+    } else {
+      stream = properties_.GetStream(source_, col_start, col_length);
     }
 
-    stream = properties_.GetStream(source_, col_start, col_length);
+    return PageReader::Open(std::move(stream), col->num_values(), col->compression(),
+                            properties_.memory_pool());
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const std::vector<PageLocation>& data_pages) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+
+    int64_t col_start, col_length;
+    GetColumnChunkRange(*col, &col_start, &col_length);
+
+    // The pages are read lazily as the page reader seeks to them, rather than
+    // reading the whole column chunk upfront
+    std::unique_ptr<InputStream> stream(new BufferedInputStream(
+        properties_.memory_pool(), properties_.buffer_size(), source_, col_start,
+        col_length));
 
+    std::vector<PageLocation> relative_pages(data_pages);
+    for (PageLocation& location : relative_pages) {
+      location.offset -= col_start;
+      if (location.offset < 0 || location.offset >= col_length) {
+        throw ParquetException("Page location is outside of the column chunk");
+      }
+    }
     return PageReader::Open(std::move(stream), col->num_values(), col->compression(),
+                            relative_pages, col->data_page_offset() - col_start,
                             properties_.memory_pool());
   }
 
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->column_index_offset(), col->column_index_length());
+    uint32_t length = static_cast<uint32_t>(buffer->size());
+    return ColumnIndex::Make(buffer->data(), &length);
+  }
+
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->offset_index_offset(), col->offset_index_length());
+    uint32_t length = static_cast<uint32_t>(buffer->size());
+    return OffsetIndex::Make(buffer->data(), &length);
+  }
+
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+
+    // The serialized filter starts with its bitset length followed by the hash
+    // strategy and algorithm; read the length first to size the whole read.
+    static constexpr int64_t kBloomFilterHeaderSize = 3 * sizeof(uint32_t);
+    int64_t filter_start = col->bloom_filter_offset();
+    uint32_t bitset_size = 0;
+    if (filter_start < 0 || filter_start + kBloomFilterHeaderSize > source_->Size() ||
+        source_->ReadAt(filter_start, sizeof(uint32_t),
+                        reinterpret_cast<uint8_t*>(&bitset_size)) != sizeof(uint32_t)) {
+      throw ParquetException("Invalid Bloom filter offset in column metadata");
+    }
+    if (bitset_size > BloomFilter::kMaximumBloomFilterBytes ||
+        filter_start + kBloomFilterHeaderSize + bitset_size > source_->Size()) {
+      throw ParquetException("Invalid Bloom filter size");
+    }
+
+    std::unique_ptr<InputStream> stream = properties_.GetStream(
+        source_, filter_start, kBloomFilterHeaderSize + bitset_size);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(stream.get())));
+  }
+
  private:
+  void GetColumnChunkRange(const ColumnChunkMetaData& col, int64_t* col_start,
+                           int64_t* col_length) {
+    ReadRange range = ComputeColumnChunkRange(*file_metadata_, source_->Size(), col);
+    *col_start = range.offset;
+    *col_length = range.length;
+  }
+
+  std::shared_ptr<Buffer> ReadIndex(int64_t offset, int32_t length) {
+    if (offset < 0 || length < 0 || offset + length > source_->Size()) {
+      throw ParquetException("Invalid page index location in column metadata");
+    }
+    std::shared_ptr<Buffer> buffer = source_->ReadAt(offset, length);
+    if (buffer->size() != length) {
+      throw ParquetException("Failed reading page index");
+    }
+    return buffer;
+  }
+
   RandomAccessSource* source_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
+  std::shared_ptr<ReadPlanner> read_planner_;
 };
 
 // ----------------------------------------------------------------------
@@ -151,10 +418,35 @@ class SerializedFile : public ParquetFileReader::Contents {
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
     std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_.get(), file_metadata_.get(), i, properties_));
+        new SerializedRowGroup(source_.get(), file_metadata_.get(), i, properties_,
+                               read_planner_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices) override {
+    std::vector<ReadRange> ranges;
+    const int64_t source_size = source_->Size();
+    for (int row_group : row_groups) {
+      if (row_group < 0 || row_group >= file_metadata_->num_row_groups()) {
+        throw ParquetException("Invalid row group index to pre-buffer");
+      }
+      std::unique_ptr<RowGroupMetaData> row_group_metadata =
+          file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        if (column < 0 || column >= row_group_metadata->num_columns()) {
+          throw ParquetException("Invalid column index to pre-buffer");
+        }
+        ranges.push_back(ComputeColumnChunkRange(
+            *file_metadata_, source_size, *row_group_metadata->ColumnChunk(column)));
+      }
+    }
+
+    // Row group readers created earlier keep the previous planner alive
+    read_planner_ = std::make_shared<ReadPlanner>(source_.get(), properties_);
+    read_planner_->Plan(ranges);
+  }
+
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
   void set_metadata(const std::shared_ptr<FileMetaData>& metadata) {
@@ -211,6 +503,7 @@ class SerializedFile : public ParquetFileReader::Contents {
   std::unique_ptr<RandomAccessSource> source_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
+  std::shared_ptr<ReadPlanner> read_planner_;
 };
 
 // ----------------------------------------------------------------------
@@ -302,6 +595,11 @@ std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   return contents_->GetRowGroup(i);
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices) {
+  contents_->PreBuffer(row_groups, column_indices);
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
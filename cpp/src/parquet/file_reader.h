@@ -25,6 +25,7 @@
 #include <string>
 #include <vector>
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/metadata.h"
 #include "parquet/properties.h"
@@ -38,6 +39,12 @@ namespace parquet {
 
 class ColumnReader;
 
+// A range of rows [first, last] within a row group
+struct PARQUET_EXPORT RowRange {
+  int64_t first;
+  int64_t last;
+};
+
 class PARQUET_EXPORT RowGroupReader {
  public:
   // Forward declare a virtual class 'Contents' to aid dependency injection and more
@@ -48,6 +55,17 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    // Returns nullptr if the column chunk has no Bloom filter
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) { return NULLPTR; }
+    // Return nullptr if the column chunk has no page index
+    virtual std::unique_ptr<ColumnIndex> GetColumnIndex(int i) { return NULLPTR; }
+    virtual std::unique_ptr<OffsetIndex> GetOffsetIndex(int i) { return NULLPTR; }
+    // Only read the given data pages of the column chunk
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const std::vector<PageLocation>& data_pages) {
+      ParquetException::NYI("Reading a subset of the data pages");
+      return NULLPTR;
+    }
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -61,6 +79,33 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the Bloom filter of the indicated row group-relative column, or
+  // nullptr if none was written for it
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Read the page indexes of the indicated row group-relative column, or
+  // nullptr if they were not written
+  std::unique_ptr<ColumnIndex> GetColumnIndex(int i);
+  std::unique_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  // Construct ColumnReaders for the indicated columns which only read the data
+  // pages holding the rows in `row_ranges`, located with the columns' offset
+  // indexes. As page boundaries differ between columns, the ranges are widened
+  // to whole pages of all these columns so that the readers stay aligned and
+  // all return the rows stored in `selected_rows`. If one of the columns has no
+  // offset index, all the rows of the row group are selected.
+  std::vector<std::shared_ptr<ColumnReader>> ColumnsForRowRanges(
+      const std::vector<int>& columns, const std::vector<RowRange>& row_ranges,
+      std::vector<RowRange>* selected_rows);
+
+  // Construct a PageReader for the indicated column which only returns the
+  // data pages holding rows in `row_ranges`, located with the column's offset
+  // index. The rows held by these pages are stored in `selected_rows`. If the
+  // column has no offset index, all the pages and rows are selected.
+  std::unique_ptr<PageReader> GetColumnPageReader(int i,
+                                                  const std::vector<RowRange>& row_ranges,
+                                                  std::vector<RowRange>* selected_rows);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -82,6 +127,8 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices) {}
   };
 
   ParquetFileReader();
@@ -120,6 +167,19 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  // Start reading the indicated columns of the indicated row groups in the
+  // background, coalescing nearby column chunks into larger requests. The
+  // column chunks are then served from memory to the page readers of these
+  // row groups, each of them once. The amount of memory and concurrency used
+  // are set with the ReaderProperties; column chunks which are requested ahead
+  // of the reads in progress and don't fit in memory are read from the source
+  // when decoded. A new call replaces the previous plan.
+  //
+  // This only pays off for sources which can be read concurrently, and whose
+  // requests have a high latency.
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -138,6 +198,32 @@ PARQUET_EXPORT
 int64_t ScanFileContents(std::vector<int> columns, const int32_t column_batch_size,
                          ParquetFileReader* reader);
 
+/// \brief Select the row groups which may satisfy an equality or IN predicate
+/// on a column, using the column chunks' Bloom filters. Row groups whose
+/// column chunk has no Bloom filter are always selected.
+/// \param[in] reader a ParquetFileReader instance
+/// \param[in] column the column number the predicate applies to
+/// \param[in] values the values of the predicate; a single value for equality
+/// \return the indices of the row groups which cannot be skipped
+template <typename DType>
+std::vector<int> FilterRowGroupsByBloomFilter(
+    ParquetFileReader* reader, int column,
+    const std::vector<typename DType::c_type>& values) {
+  std::shared_ptr<FileMetaData> metadata = reader->metadata();
+  const int type_length = metadata->schema()->Column(column)->type_length();
+  std::vector<int> row_groups;
+  for (int i = 0; i < metadata->num_row_groups(); i++) {
+    std::unique_ptr<BloomFilter> filter =
+        reader->RowGroup(i)->GetColumnBloomFilter(column);
+    if (filter == NULLPTR ||
+        BloomFilterMayContain<DType>(*filter, values.data(),
+                                     static_cast<int64_t>(values.size()), type_length)) {
+      row_groups.push_back(i);
+    }
+  }
+  return row_groups;
+}
+
 }  // namespace parquet
 
 #endif  // PARQUET_FILE_READER_H
@@ -92,6 +92,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       InitColumns();
     } else {
       column_writers_.push_back(nullptr);
+      column_metadata_.push_back(nullptr);
     }
   }
 
@@ -117,7 +118,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     auto col_meta = metadata_->NextColumnChunk();
 
     if (column_writers_[0]) {
-      total_bytes_written_ += column_writers_[0]->Close();
+      CloseColumn(0);
     }
 
     ++current_column_index_;
@@ -127,6 +128,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         PageWriter::Open(sink_, properties_->compression(column_descr->path()), col_meta,
                          properties_->memory_pool());
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+    column_metadata_[0] = col_meta;
     return column_writers_[0].get();
   }
 
@@ -171,12 +173,22 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
 
       for (size_t i = 0; i < column_writers_.size(); i++) {
         if (column_writers_[i]) {
-          total_bytes_written_ += column_writers_[i]->Close();
+          CloseColumn(i);
           column_writers_[i].reset();
         }
       }
 
       column_writers_.clear();
+      column_metadata_.clear();
+
+      // Bloom filters are laid out after all column chunks of the row group so
+      // that the chunks themselves stay contiguous. They are not accounted in
+      // the row group's total byte size.
+      for (auto& entry : bloom_filters_) {
+        entry.first->set_bloom_filter_offset(sink_->Tell());
+        entry.second->WriteTo(sink_);
+      }
+      bloom_filters_.clear();
 
       // Ensures all columns have been written
       metadata_->set_num_rows(num_rows_);
@@ -216,6 +228,14 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     }
   }
 
+  void CloseColumn(size_t i) {
+    total_bytes_written_ += column_writers_[i]->Close();
+    std::unique_ptr<BloomFilter> bloom_filter = column_writers_[i]->ReleaseBloomFilter();
+    if (bloom_filter) {
+      bloom_filters_.emplace_back(column_metadata_[i], std::move(bloom_filter));
+    }
+  }
+
   void InitColumns() {
     for (int i = 0; i < num_columns(); i++) {
       auto col_meta = metadata_->NextColumnChunk();
@@ -225,10 +245,15 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
                            col_meta, properties_->memory_pool(), buffered_row_group_);
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
+      column_metadata_.push_back(col_meta);
     }
   }
 
   std::vector<std::shared_ptr<ColumnWriter>> column_writers_;
+  std::vector<ColumnChunkMetaDataBuilder*> column_metadata_;
+  // Bloom filters of the closed column chunks, pending serialization
+  std::vector<std::pair<ColumnChunkMetaDataBuilder*, std::unique_ptr<BloomFilter>>>
+      bloom_filters_;
 };
 
 // ----------------------------------------------------------------------
@@ -257,6 +282,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      // The page indexes of all row groups go right before the footer
+      metadata_->WritePageIndex(sink_.get());
+
       // Write magic bytes and metadata
       auto metadata = metadata_->Finish();
       WriteFileMetaData(*metadata, sink_.get());
@@ -16,15 +16,18 @@
 // under the License.
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "parquet/encoding-internal.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
 #include "parquet/schema-internal.h"
 #include "parquet/schema.h"
 #include "parquet/thrift.h"
+#include "parquet/util/comparison.h"
 #include "parquet/util/memory.h"
 
 #include <boost/algorithm/string.hpp>
@@ -176,6 +179,26 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_->meta_data.total_uncompressed_size;
   }
 
+  inline bool has_bloom_filter() const {
+    return column_->meta_data.__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_->meta_data.bloom_filter_offset;
+  }
+
+  inline bool has_column_index() const { return column_->__isset.column_index_offset; }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const { return column_->__isset.offset_index_offset; }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
  private:
   mutable std::shared_ptr<RowGroupStatistics> possible_stats_;
   std::vector<Encoding::type> encodings_;
@@ -253,6 +276,32 @@ int64_t ColumnChunkMetaData::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -473,6 +522,104 @@ std::shared_ptr<const KeyValueMetadata> FileMetaData::key_value_metadata() const
 
 void FileMetaData::WriteTo(OutputStream* dst) const { return impl_->WriteTo(dst); }
 
+// page index
+class OffsetIndex::OffsetIndexImpl {
+ public:
+  explicit OffsetIndexImpl(const uint8_t* serialized_index, uint32_t* index_len) {
+    format::OffsetIndex offset_index;
+    DeserializeThriftMsg(serialized_index, index_len, &offset_index);
+    page_locations_.reserve(offset_index.page_locations.size());
+    for (const format::PageLocation& location : offset_index.page_locations) {
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+  }
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const uint8_t* serialized_index,
+                                               uint32_t* index_len) {
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(serialized_index, index_len));
+}
+
+OffsetIndex::OffsetIndex(const uint8_t* serialized_index, uint32_t* index_len)
+    : impl_{std::unique_ptr<OffsetIndexImpl>(
+          new OffsetIndexImpl(serialized_index, index_len))} {}
+
+OffsetIndex::~OffsetIndex() {}
+
+int OffsetIndex::num_pages() const { return impl_->num_pages(); }
+
+const std::vector<PageLocation>& OffsetIndex::page_locations() const {
+  return impl_->page_locations();
+}
+
+class ColumnIndex::ColumnIndexImpl {
+ public:
+  explicit ColumnIndexImpl(const uint8_t* serialized_index, uint32_t* index_len) {
+    DeserializeThriftMsg(serialized_index, index_len, &column_index_);
+    size_t num_pages = column_index_.null_pages.size();
+    if (column_index_.min_values.size() != num_pages ||
+        column_index_.max_values.size() != num_pages ||
+        (column_index_.__isset.null_counts &&
+         column_index_.null_counts.size() != num_pages)) {
+      throw ParquetException("Corrupt column index: mismatched list lengths");
+    }
+  }
+
+  int num_pages() const { return static_cast<int>(column_index_.null_pages.size()); }
+
+  bool null_page(int i) const { return column_index_.null_pages[i]; }
+
+  const std::string& encoded_min(int i) const { return column_index_.min_values[i]; }
+
+  const std::string& encoded_max(int i) const { return column_index_.max_values[i]; }
+
+  bool has_null_counts() const { return column_index_.__isset.null_counts; }
+
+  int64_t null_count(int i) const { return column_index_.null_counts[i]; }
+
+  BoundaryOrder::type boundary_order() const {
+    return FromThrift(column_index_.boundary_order);
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+};
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const uint8_t* serialized_index,
+                                               uint32_t* index_len) {
+  return std::unique_ptr<ColumnIndex>(new ColumnIndex(serialized_index, index_len));
+}
+
+ColumnIndex::ColumnIndex(const uint8_t* serialized_index, uint32_t* index_len)
+    : impl_{std::unique_ptr<ColumnIndexImpl>(
+          new ColumnIndexImpl(serialized_index, index_len))} {}
+
+ColumnIndex::~ColumnIndex() {}
+
+int ColumnIndex::num_pages() const { return impl_->num_pages(); }
+
+bool ColumnIndex::null_page(int i) const { return impl_->null_page(i); }
+
+const std::string& ColumnIndex::encoded_min(int i) const { return impl_->encoded_min(i); }
+
+const std::string& ColumnIndex::encoded_max(int i) const { return impl_->encoded_max(i); }
+
+bool ColumnIndex::has_null_counts() const { return impl_->has_null_counts(); }
+
+int64_t ColumnIndex::null_count(int i) const { return impl_->null_count(i); }
+
+BoundaryOrder::type ColumnIndex::boundary_order() const {
+  return impl_->boundary_order();
+}
+
 ApplicationVersion::ApplicationVersion(const std::string& application, int major,
                                        int minor, int patch)
     : application_(application), version{major, minor, patch, "", "", ""} {}
@@ -577,6 +724,27 @@ bool ApplicationVersion::HasCorrectStatistics(Type::type col_type,
 
 // MetaData Builders
 // row-group metadata
+namespace {
+
+// Page index bounds are plain-encoded like the column chunk statistics
+template <typename DType>
+void DecodeBound(const ColumnDescriptor* descr, const std::string& src,
+                 typename DType::c_type* dst) {
+  PlainDecoder<DType> decoder(descr);
+  decoder.SetData(1, reinterpret_cast<const uint8_t*>(src.data()),
+                  static_cast<int>(src.size()));
+  decoder.Decode(dst, 1);
+}
+
+template <>
+void DecodeBound<ByteArrayType>(const ColumnDescriptor* descr, const std::string& src,
+                                ByteArray* dst) {
+  dst->len = static_cast<uint32_t>(src.size());
+  dst->ptr = reinterpret_cast<const uint8_t*>(src.data());
+}
+
+}  // namespace
+
 class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
  public:
   explicit ColumnChunkMetaDataBuilderImpl(const std::shared_ptr<WriterProperties>& props,
@@ -626,6 +794,133 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(stats);
   }
 
+  void set_bloom_filter_offset(int64_t offset) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+  }
+
+  void AddPageIndexEntry(int64_t page_offset, int32_t compressed_page_size,
+                         int64_t first_row_index, const EncodedStatistics& page_stats) {
+    if (!page_index_enabled_) {
+      return;
+    }
+    format::PageLocation location;
+    location.__set_offset(page_offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    location.__set_first_row_index(first_row_index);
+    offset_index_.page_locations.push_back(location);
+    // The offset index requires pages to start on row boundaries
+    if (first_row_index < 0) {
+      offset_index_valid_ = false;
+    }
+
+    // The column index needs the null count of every page and the min/max values
+    // of every page with non-null values
+    if (!page_stats.has_null_count || page_stats.has_min != page_stats.has_max ||
+        (page_stats.has_min &&
+         std::max(page_stats.min().length(), page_stats.max().length()) >
+             properties_->max_statistics_size(column_->path()))) {
+      column_index_valid_ = false;
+    }
+    if (column_index_valid_) {
+      column_index_.null_pages.push_back(!page_stats.has_min);
+      column_index_.min_values.push_back(page_stats.has_min ? page_stats.min() : "");
+      column_index_.max_values.push_back(page_stats.has_max ? page_stats.max() : "");
+      column_index_.null_counts.push_back(page_stats.null_count);
+    }
+  }
+
+  void WriteColumnIndex(OutputStream* sink) {
+    if (page_index_enabled_ && column_index_valid_ && offset_index_valid_ &&
+        !column_index_.null_pages.empty()) {
+      column_index_.__set_boundary_order(ToThrift(ComputeBoundaryOrder()));
+      column_index_.__isset.null_counts = true;
+      int64_t start_pos = sink->Tell();
+      int64_t length = SerializeThriftMsg(&column_index_, 1024, sink);
+      column_chunk_->__set_column_index_offset(start_pos);
+      column_chunk_->__set_column_index_length(static_cast<int32_t>(length));
+    }
+    column_index_ = format::ColumnIndex();
+  }
+
+  // The bounds are ASCENDING (DESCENDING) if the min and max values of the
+  // non-null pages are both non-decreasing (non-increasing) in page order
+  template <typename DType>
+  BoundaryOrder::type ComputeBoundaryOrder() {
+    auto compare =
+        std::static_pointer_cast<CompareDefault<DType>>(Comparator::Make(column_));
+    bool ascending = true;
+    bool descending = true;
+    bool has_previous = false;
+    typename DType::c_type prev_min, prev_max, min, max;
+    for (size_t i = 0; i < column_index_.null_pages.size(); ++i) {
+      if (column_index_.null_pages[i]) {
+        continue;
+      }
+      DecodeBound<DType>(column_, column_index_.min_values[i], &min);
+      DecodeBound<DType>(column_, column_index_.max_values[i], &max);
+      if (has_previous) {
+        ascending = ascending && !(*compare)(min, prev_min) && !(*compare)(max, prev_max);
+        descending =
+            descending && !(*compare)(prev_min, min) && !(*compare)(prev_max, max);
+        if (!ascending && !descending) {
+          return BoundaryOrder::UNORDERED;
+        }
+      }
+      prev_min = min;
+      prev_max = max;
+      has_previous = true;
+    }
+    return ascending ? BoundaryOrder::ASCENDING : BoundaryOrder::DESCENDING;
+  }
+
+  BoundaryOrder::type ComputeBoundaryOrder() {
+    if (column_->sort_order() == SortOrder::SIGNED) {
+      switch (column_->physical_type()) {
+        case Type::BOOLEAN:
+          return ComputeBoundaryOrder<BooleanType>();
+        case Type::INT32:
+          return ComputeBoundaryOrder<Int32Type>();
+        case Type::INT64:
+          return ComputeBoundaryOrder<Int64Type>();
+        case Type::FLOAT:
+          return ComputeBoundaryOrder<FloatType>();
+        case Type::DOUBLE:
+          return ComputeBoundaryOrder<DoubleType>();
+        case Type::BYTE_ARRAY:
+          return ComputeBoundaryOrder<ByteArrayType>();
+        case Type::FIXED_LEN_BYTE_ARRAY:
+          return ComputeBoundaryOrder<FLBAType>();
+        default:
+          break;
+      }
+    } else if (column_->sort_order() == SortOrder::UNSIGNED) {
+      switch (column_->physical_type()) {
+        case Type::INT32:
+          return ComputeBoundaryOrder<Int32Type>();
+        case Type::INT64:
+          return ComputeBoundaryOrder<Int64Type>();
+        case Type::BYTE_ARRAY:
+          return ComputeBoundaryOrder<ByteArrayType>();
+        case Type::FIXED_LEN_BYTE_ARRAY:
+          return ComputeBoundaryOrder<FLBAType>();
+        default:
+          break;
+      }
+    }
+    return BoundaryOrder::UNORDERED;
+  }
+
+  void WriteOffsetIndex(OutputStream* sink) {
+    if (page_index_enabled_ && offset_index_valid_ &&
+        !offset_index_.page_locations.empty()) {
+      int64_t start_pos = sink->Tell();
+      int64_t length = SerializeThriftMsg(&offset_index_, 1024, sink);
+      column_chunk_->__set_offset_index_offset(start_pos);
+      column_chunk_->__set_offset_index_length(static_cast<int32_t>(length));
+    }
+    offset_index_ = format::OffsetIndex();
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -662,6 +957,15 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
       thrift_encodings.push_back(ToThrift(Encoding::PLAIN));
     }
     column_chunk_->meta_data.__set_encodings(thrift_encodings);
+
+    // The page locations were recorded relative to the page writer's sink, which
+    // may be an in-memory buffer. Make them absolute using the first data page.
+    if (!offset_index_.page_locations.empty()) {
+      int64_t shift = data_page_offset - offset_index_.page_locations[0].offset;
+      for (format::PageLocation& location : offset_index_.page_locations) {
+        location.offset += shift;
+      }
+    }
   }
 
   void WriteTo(OutputStream* sink) {
@@ -677,12 +981,22 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_path_in_schema(column_->path()->ToDotVector());
     column_chunk_->meta_data.__set_codec(
         ToThrift(properties_->compression(column_->path())));
+    page_index_enabled_ = properties_->page_index_enabled(column_->path());
+    column_index_valid_ = true;
+    offset_index_valid_ = true;
   }
 
   format::ColumnChunk* column_chunk_;
   std::unique_ptr<format::ColumnChunk> owned_column_chunk_;
   const std::shared_ptr<WriterProperties> properties_;
   const ColumnDescriptor* column_;
+
+  // Page index of the column chunk, only populated when enabled
+  bool page_index_enabled_;
+  bool column_index_valid_;
+  bool offset_index_valid_;
+  format::ColumnIndex column_index_;
+  format::OffsetIndex offset_index_;
 };
 
 std::unique_ptr<ColumnChunkMetaDataBuilder> ColumnChunkMetaDataBuilder::Make(
@@ -739,6 +1053,26 @@ void ColumnChunkMetaDataBuilder::SetStatistics(bool is_signed,
   impl_->SetStatistics(is_signed, result);
 }
 
+void ColumnChunkMetaDataBuilder::set_bloom_filter_offset(int64_t offset) {
+  impl_->set_bloom_filter_offset(offset);
+}
+
+void ColumnChunkMetaDataBuilder::AddPageIndexEntry(int64_t page_offset,
+                                                   int32_t compressed_page_size,
+                                                   int64_t first_row_index,
+                                                   const EncodedStatistics& page_stats) {
+  impl_->AddPageIndexEntry(page_offset, compressed_page_size, first_row_index,
+                           page_stats);
+}
+
+void ColumnChunkMetaDataBuilder::WriteColumnIndex(OutputStream* sink) {
+  impl_->WriteColumnIndex(sink);
+}
+
+void ColumnChunkMetaDataBuilder::WriteOffsetIndex(OutputStream* sink) {
+  impl_->WriteOffsetIndex(sink);
+}
+
 class RowGroupMetaDataBuilder::RowGroupMetaDataBuilderImpl {
  public:
   explicit RowGroupMetaDataBuilderImpl(const std::shared_ptr<WriterProperties>& props,
@@ -792,6 +1126,18 @@ class RowGroupMetaDataBuilder::RowGroupMetaDataBuilderImpl {
 
   void set_num_rows(int64_t num_rows) { row_group_->num_rows = num_rows; }
 
+  void WriteColumnIndexes(OutputStream* sink) {
+    for (auto& column_builder : column_builders_) {
+      column_builder->WriteColumnIndex(sink);
+    }
+  }
+
+  void WriteOffsetIndexes(OutputStream* sink) {
+    for (auto& column_builder : column_builders_) {
+      column_builder->WriteOffsetIndex(sink);
+    }
+  }
+
   int num_columns() { return static_cast<int>(row_group_->columns.size()); }
 
   int64_t num_rows() { return row_group_->num_rows; }
@@ -839,6 +1185,14 @@ void RowGroupMetaDataBuilder::Finish(int64_t total_bytes_written) {
   impl_->Finish(total_bytes_written);
 }
 
+void RowGroupMetaDataBuilder::WriteColumnIndexes(OutputStream* sink) {
+  impl_->WriteColumnIndexes(sink);
+}
+
+void RowGroupMetaDataBuilder::WriteOffsetIndexes(OutputStream* sink) {
+  impl_->WriteOffsetIndexes(sink);
+}
+
 // file metadata
 // TODO(PARQUET-595) Support key_value_metadata
 class FileMetaDataBuilder::FileMetaDataBuilderImpl {
@@ -861,6 +1215,15 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return row_group_ptr;
   }
 
+  void WritePageIndex(OutputStream* sink) {
+    for (auto& row_group_builder : row_group_builders_) {
+      row_group_builder->WriteColumnIndexes(sink);
+    }
+    for (auto& row_group_builder : row_group_builders_) {
+      row_group_builder->WriteOffsetIndexes(sink);
+    }
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     std::vector<format::RowGroup> row_groups;
@@ -951,6 +1314,10 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::WritePageIndex(OutputStream* sink) {
+  impl_->WritePageIndex(sink);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 }  // namespace parquet
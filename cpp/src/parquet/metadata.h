@@ -117,6 +117,15 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t index_page_offset() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  // page index
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
 
  private:
   explicit ColumnChunkMetaData(const uint8_t* metadata, const ColumnDescriptor* descr,
@@ -151,6 +160,62 @@ class PARQUET_EXPORT RowGroupMetaData {
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
 };
 
+// Location of a data page within the file, as stored in the OffsetIndex
+struct PARQUET_EXPORT PageLocation {
+  // Offset of the page header in the file
+  int64_t offset;
+  // Size of the page, including its header
+  int32_t compressed_page_size;
+  // Index within the row group of the first row of the page
+  int64_t first_row_index;
+};
+
+// Page locations of a column chunk, ordered by offset
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  // API convenience to get a MetaData accessor
+  static std::unique_ptr<OffsetIndex> Make(const uint8_t* serialized_index,
+                                           uint32_t* index_len);
+
+  ~OffsetIndex();
+
+  int num_pages() const;
+  const std::vector<PageLocation>& page_locations() const;
+
+ private:
+  explicit OffsetIndex(const uint8_t* serialized_index, uint32_t* index_len);
+  // PIMPL Idiom
+  class OffsetIndexImpl;
+  std::unique_ptr<OffsetIndexImpl> impl_;
+};
+
+// Per data page statistics of a column chunk. Page i is the page at
+// OffsetIndex::page_locations()[i]
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  // API convenience to get a MetaData accessor
+  static std::unique_ptr<ColumnIndex> Make(const uint8_t* serialized_index,
+                                           uint32_t* index_len);
+
+  ~ColumnIndex();
+
+  int num_pages() const;
+  // If true, the page only contains null values and has no min/max values
+  bool null_page(int i) const;
+  // Plain-encoded lower and upper bounds of the values of the page
+  const std::string& encoded_min(int i) const;
+  const std::string& encoded_max(int i) const;
+  bool has_null_counts() const;
+  int64_t null_count(int i) const;
+  BoundaryOrder::type boundary_order() const;
+
+ private:
+  explicit ColumnIndex(const uint8_t* serialized_index, uint32_t* index_len);
+  // PIMPL Idiom
+  class ColumnIndexImpl;
+  std::unique_ptr<ColumnIndexImpl> impl_;
+};
+
 class FileMetaDataBuilder;
 
 class PARQUET_EXPORT FileMetaData {
@@ -208,6 +273,17 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(bool is_signed, const EncodedStatistics& stats);
+  // Bloom filters are written after the column chunks of the row group
+  void set_bloom_filter_offset(int64_t offset);
+  // page index
+  // Record a data page for the column and offset indexes. The offset is relative
+  // to the stream the page writer writes to, it's made absolute on Finish()
+  void AddPageIndexEntry(int64_t page_offset, int32_t compressed_page_size,
+                         int64_t first_row_index, const EncodedStatistics& page_stats);
+  // Serialize the page indexes, if any, and record their location in the
+  // column chunk. Must be called after Finish()
+  void WriteColumnIndex(OutputStream* sink);
+  void WriteOffsetIndex(OutputStream* sink);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
   // commit the metadata
@@ -251,6 +327,10 @@ class PARQUET_EXPORT RowGroupMetaDataBuilder {
   // commit the metadata
   void Finish(int64_t total_bytes_written);
 
+  // Serialize the page indexes of the column chunks
+  void WriteColumnIndexes(OutputStream* sink);
+  void WriteOffsetIndexes(OutputStream* sink);
+
  private:
   explicit RowGroupMetaDataBuilder(const std::shared_ptr<WriterProperties>& props,
                                    const SchemaDescriptor* schema_, uint8_t* contents);
@@ -270,6 +350,10 @@ class PARQUET_EXPORT FileMetaDataBuilder {
 
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Serialize the column indexes then the offset indexes of all the row groups,
+  // as laid out by the format between the last row group and the footer
+  void WritePageIndex(OutputStream* sink);
+
   // commit the metadata
   std::unique_ptr<FileMetaData> Finish();
 
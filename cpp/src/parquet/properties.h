@@ -38,6 +38,10 @@ struct ParquetVersion {
 
 static int64_t DEFAULT_BUFFER_SIZE = 0;
 static bool DEFAULT_USE_BUFFERED_STREAM = false;
+static constexpr int64_t DEFAULT_IO_HOLE_SIZE_LIMIT = 8 * 1024;
+static constexpr int64_t DEFAULT_IO_RANGE_SIZE_LIMIT = 32 * 1024 * 1024;
+static constexpr int64_t DEFAULT_PRE_BUFFER_MEMORY_LIMIT = 256 * 1024 * 1024;
+static constexpr int DEFAULT_IO_CONCURRENCY = 8;
 
 class PARQUET_EXPORT ReaderProperties {
  public:
@@ -45,6 +49,10 @@ class PARQUET_EXPORT ReaderProperties {
       : pool_(pool) {
     buffered_stream_enabled_ = DEFAULT_USE_BUFFERED_STREAM;
     buffer_size_ = DEFAULT_BUFFER_SIZE;
+    io_hole_size_limit_ = DEFAULT_IO_HOLE_SIZE_LIMIT;
+    io_range_size_limit_ = DEFAULT_IO_RANGE_SIZE_LIMIT;
+    pre_buffer_memory_limit_ = DEFAULT_PRE_BUFFER_MEMORY_LIMIT;
+    io_concurrency_ = DEFAULT_IO_CONCURRENCY;
   }
 
   ::arrow::MemoryPool* memory_pool() const { return pool_; }
@@ -71,10 +79,44 @@ class PARQUET_EXPORT ReaderProperties {
 
   int64_t buffer_size() const { return buffer_size_; }
 
+  // The following settings apply to the column chunks read ahead with
+  // ParquetFileReader::PreBuffer.
+
+  // Column chunks separated by at most this many bytes are read with a single
+  // request
+  void set_io_hole_size_limit(int64_t limit) { io_hole_size_limit_ = limit; }
+
+  int64_t io_hole_size_limit() const { return io_hole_size_limit_; }
+
+  // Maximum size of a request made of several column chunks
+  void set_io_range_size_limit(int64_t limit) { io_range_size_limit_ = limit; }
+
+  int64_t io_range_size_limit() const { return io_range_size_limit_; }
+
+  // Maximum number of bytes read ahead and not released yet by the readers of
+  // the column chunks. A single request larger than the limit is still made.
+  void set_pre_buffer_memory_limit(int64_t limit) { pre_buffer_memory_limit_ = limit; }
+
+  int64_t pre_buffer_memory_limit() const { return pre_buffer_memory_limit_; }
+
+  // Maximum number of concurrent requests
+  void set_io_concurrency(int concurrency) {
+    if (concurrency < 1) {
+      throw ParquetException("IO concurrency must be at least 1");
+    }
+    io_concurrency_ = concurrency;
+  }
+
+  int io_concurrency() const { return io_concurrency_; }
+
  private:
   ::arrow::MemoryPool* pool_;
   int64_t buffer_size_;
   bool buffered_stream_enabled_;
+  int64_t io_hole_size_limit_;
+  int64_t io_range_size_limit_;
+  int64_t pre_buffer_memory_limit_;
+  int io_concurrency_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
@@ -86,6 +128,10 @@ static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.01;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
@@ -103,7 +149,11 @@ class PARQUET_EXPORT ColumnProperties {
         codec_(codec),
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
-        max_stats_size_(max_stats_size) {}
+        max_stats_size_(max_stats_size),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        bloom_filter_ndv_(DEFAULT_BLOOM_FILTER_NDV),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP),
+        page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -121,6 +171,18 @@ class PARQUET_EXPORT ColumnProperties {
     max_stats_size_ = max_stats_size;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_ndv(int32_t ndv) { bloom_filter_ndv_ = ndv; }
+
+  void set_bloom_filter_fpp(double fpp) { bloom_filter_fpp_ = fpp; }
+
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -131,12 +193,24 @@ class PARQUET_EXPORT ColumnProperties {
 
   size_t max_statistics_size() const { return max_stats_size_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  int32_t bloom_filter_ndv() const { return bloom_filter_ndv_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
+  bool page_index_enabled() const { return page_index_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
   bool dictionary_enabled_;
   bool statistics_enabled_;
   size_t max_stats_size_;
+  bool bloom_filter_enabled_;
+  int32_t bloom_filter_ndv_;
+  double bloom_filter_fpp_;
+  bool page_index_enabled_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -307,6 +381,74 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /**
+     * Write a Bloom filter for the column in each row group. The filter is sized
+     * for the expected number of distinct values per row group (ndv) at the given
+     * false positive probability (fpp). Not supported for BOOLEAN columns.
+     */
+    Builder* enable_bloom_filter(const std::string& path,
+                                 int32_t ndv = DEFAULT_BLOOM_FILTER_NDV,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      if (ndv <= 0) {
+        throw ParquetException("Bloom filter NDV must be positive");
+      }
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException("Bloom filter FPP must be in (0, 1)");
+      }
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_ndv_[path] = ndv;
+      bloom_filter_fpp_[path] = fpp;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 int32_t ndv = DEFAULT_BLOOM_FILTER_NDV,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      return this->enable_bloom_filter(path->ToDotString(), ndv, fpp);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /**
+     * Write the ColumnIndex (per page min/max values and null counts) and the
+     * OffsetIndex (page locations) of the column chunks, which allow readers
+     * to skip individual pages. The column index also requires statistics.
+     */
+    Builder* enable_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    Builder* enable_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_page_index(path->ToDotString());
+    }
+
+    Builder* disable_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_page_index(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -323,6 +465,14 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_ndv_)
+        get(item.first).set_bloom_filter_ndv(item.second);
+      for (const auto& item : bloom_filter_fpp_)
+        get(item.first).set_bloom_filter_fpp(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(
           new WriterProperties(pool_, dictionary_pagesize_limit_, write_batch_size_,
@@ -345,6 +495,10 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, Compression::type> codecs_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, int32_t> bloom_filter_ndv_;
+    std::unordered_map<std::string, double> bloom_filter_fpp_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
   };
 
   inline ::arrow::MemoryPool* memory_pool() const { return pool_; }
@@ -404,6 +558,22 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  int32_t bloom_filter_ndv(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_ndv();
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
  private:
   explicit WriterProperties(
       ::arrow::MemoryPool* pool, int64_t dictionary_pagesize_limit,
@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+
+#include "parquet/exception.h"
+#include "parquet/properties.h"
+#include "parquet/read_planner.h"
+#include "parquet/util/memory.h"
+
+namespace parquet {
+namespace test {
+
+// Counts the requests made to the underlying file
+class CountingInputFile : public ArrowInputFile {
+ public:
+  explicit CountingInputFile(const std::shared_ptr<Buffer>& buffer)
+      : ArrowInputFile(std::make_shared<::arrow::io::BufferReader>(buffer)),
+        num_reads_(0) {}
+
+  std::shared_ptr<Buffer> ReadAt(int64_t position, int64_t nbytes) override {
+    ++num_reads_;
+    return ArrowInputFile::ReadAt(position, nbytes);
+  }
+
+  int num_reads() const { return num_reads_; }
+
+ private:
+  std::atomic<int> num_reads_;
+};
+
+std::shared_ptr<Buffer> MakeFileContents(int64_t size) {
+  std::shared_ptr<ResizableBuffer> buffer = AllocateBuffer();
+  buffer->Resize(size);
+  for (int64_t i = 0; i < size; ++i) {
+    buffer->mutable_data()[i] = static_cast<uint8_t>(i % 251);
+  }
+  return buffer;
+}
+
+void AssertRangeContents(const ReadRange& range, const std::shared_ptr<Buffer>& buffer) {
+  ASSERT_NE(nullptr, buffer);
+  ASSERT_EQ(range.length, buffer->size());
+  for (int64_t i = 0; i < range.length; ++i) {
+    ASSERT_EQ(static_cast<uint8_t>((range.offset + i) % 251), buffer->data()[i]);
+  }
+}
+
+void AssertRangesEqual(const std::vector<ReadRange>& expected,
+                       const std::vector<ReadRange>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].offset, actual[i].offset);
+    ASSERT_EQ(expected[i].length, actual[i].length);
+  }
+}
+
+TEST(TestCoalesceReadRanges, Basics) {
+  AssertRangesEqual({}, CoalesceReadRanges({}, 10, 100));
+
+  // Ranges are sorted, and merged when the hole between them is small enough
+  AssertRangesEqual({{0, 35}, {60, 10}},
+                    CoalesceReadRanges({{30, 5}, {60, 10}, {0, 10}, {15, 10}}, 5, 100));
+  AssertRangesEqual({{0, 10}, {15, 10}, {30, 5}, {60, 10}},
+                    CoalesceReadRanges({{0, 10}, {15, 10}, {30, 5}, {60, 10}}, 4, 100));
+
+  // Merged ranges don't grow larger than the range size limit
+  AssertRangesEqual({{0, 25}, {30, 5}},
+                    CoalesceReadRanges({{0, 10}, {15, 10}, {30, 5}}, 5, 30));
+
+  // Overlapping ranges are always merged
+  AssertRangesEqual({{0, 40}},
+                    CoalesceReadRanges({{0, 20}, {10, 30}, {15, 5}}, 0, 10));
+}
+
+TEST(TestReadPlanner, CoalescedReads) {
+  std::shared_ptr<Buffer> contents = MakeFileContents(1000);
+  CountingInputFile source(contents);
+
+  ReaderProperties properties;
+  properties.set_io_hole_size_limit(10);
+  ReadPlanner planner(&source, properties);
+
+  std::vector<ReadRange> ranges = {{500, 100}, {0, 100}, {105, 50}, {700, 300}};
+  planner.Plan(ranges);
+  for (const ReadRange& range : ranges) {
+    AssertRangeContents(range, planner.Read(range));
+  }
+  // [0, 155), [500, 600) and [700, 1000)
+  ASSERT_EQ(3, source.num_reads());
+  ASSERT_EQ(0, planner.bytes_buffered());
+
+  // Planned ranges are only served once, and unplanned ones never
+  ASSERT_EQ(nullptr, planner.Read(ranges[0]));
+  ReadRange unplanned = {0, 50};
+  ASSERT_EQ(nullptr, planner.Read(unplanned));
+  ASSERT_THROW(planner.Plan(ranges), ParquetException);
+}
+
+TEST(TestReadPlanner, MemoryLimit) {
+  std::shared_ptr<Buffer> contents = MakeFileContents(1000);
+  CountingInputFile source(contents);
+
+  ReaderProperties properties;
+  properties.set_io_hole_size_limit(0);
+  properties.set_pre_buffer_memory_limit(250);
+  ReadPlanner planner(&source, properties);
+
+  std::vector<ReadRange> ranges = {{0, 100}, {200, 100}, {400, 300}, {800, 100}};
+  planner.Plan(ranges);
+  // The third range doesn't fit with the first two
+  ASSERT_EQ(200, planner.bytes_buffered());
+
+  AssertRangeContents(ranges[0], planner.Read(ranges[0]));
+  ASSERT_EQ(100, planner.bytes_buffered());
+  AssertRangeContents(ranges[1], planner.Read(ranges[1]));
+  // A range larger than the limit is read on its own
+  ASSERT_EQ(300, planner.bytes_buffered());
+  AssertRangeContents(ranges[2], planner.Read(ranges[2]));
+  ASSERT_EQ(100, planner.bytes_buffered());
+  AssertRangeContents(ranges[3], planner.Read(ranges[3]));
+  ASSERT_EQ(0, planner.bytes_buffered());
+  ASSERT_EQ(4, source.num_reads());
+}
+
+TEST(TestReadPlanner, ReadOutOfOrder) {
+  std::shared_ptr<Buffer> contents = MakeFileContents(1000);
+  CountingInputFile source(contents);
+
+  ReaderProperties properties;
+  properties.set_io_hole_size_limit(0);
+  properties.set_pre_buffer_memory_limit(200);
+  ReadPlanner planner(&source, properties);
+
+  std::vector<ReadRange> ranges = {{0, 100}, {200, 200}, {500, 50}, {600, 150}};
+  planner.Plan(ranges);
+  ASSERT_EQ(100, planner.bytes_buffered());
+
+  // A range which fits in the limit is read on demand, and not read again
+  // later
+  std::shared_ptr<Buffer> buffer = planner.Read(ranges[2]);
+  AssertRangeContents(ranges[2], buffer);
+  ASSERT_EQ(150, planner.bytes_buffered());
+
+  // One which doesn't is left to the caller
+  ASSERT_EQ(nullptr, planner.Read(ranges[3]));
+  ASSERT_EQ(nullptr, planner.Read(ranges[3]));
+  ASSERT_EQ(150, planner.bytes_buffered());
+
+  buffer.reset();
+  AssertRangeContents(ranges[0], planner.Read(ranges[0]));
+  AssertRangeContents(ranges[1], planner.Read(ranges[1]));
+  ASSERT_EQ(0, planner.bytes_buffered());
+  ASSERT_EQ(3, source.num_reads());
+}
+
+TEST(TestReadPlanner, SameOffsetRanges) {
+  std::shared_ptr<Buffer> contents = MakeFileContents(1000);
+  CountingInputFile source(contents);
+
+  ReaderProperties properties;
+  ReadPlanner planner(&source, properties);
+
+  std::vector<ReadRange> ranges = {{100, 50}, {100, 20}, {100, 80}, {100, 20}};
+  planner.Plan(ranges);
+  AssertRangeContents(ranges[0], planner.Read(ranges[0]));
+  AssertRangeContents(ranges[2], planner.Read(ranges[2]));
+  AssertRangeContents(ranges[1], planner.Read(ranges[1]));
+  ASSERT_EQ(nullptr, planner.Read(ranges[3]));
+  ASSERT_EQ(1, source.num_reads());
+}
+
+// The bytes handed out stay accounted for until the consumers release them,
+// as the column chunks of a row group are when reading a file column by column
+TEST(TestReadPlanner, MemoryLimitWithHeldBuffers) {
+  std::shared_ptr<Buffer> contents = MakeFileContents(1000);
+  CountingInputFile source(contents);
+
+  const int64_t memory_limit = 400;
+  ReaderProperties properties;
+  properties.set_io_hole_size_limit(0);
+  properties.set_io_range_size_limit(300);
+  properties.set_pre_buffer_memory_limit(memory_limit);
+  ReadPlanner planner(&source, properties);
+
+  // Three row groups of three columns, each row group being one coalesced
+  // range
+  const int num_row_groups = 3;
+  const int num_columns = 3;
+  auto column_chunk = [](int row_group, int column) -> ReadRange {
+    return {(row_group * num_columns + column) * 100, 100};
+  };
+  std::vector<ReadRange> ranges;
+  for (int row_group = 0; row_group < num_row_groups; ++row_group) {
+    for (int column = 0; column < num_columns; ++column) {
+      ranges.push_back(column_chunk(row_group, column));
+    }
+  }
+  planner.Plan(ranges);
+  ASSERT_EQ(300, planner.bytes_buffered());
+
+  std::vector<std::shared_ptr<Buffer>> held;
+  for (int column = 0; column < num_columns; ++column) {
+    for (int row_group = 0; row_group < num_row_groups; ++row_group) {
+      const ReadRange range = column_chunk(row_group, column);
+      std::shared_ptr<Buffer> buffer = planner.Read(range);
+      ASSERT_LE(planner.bytes_buffered(), memory_limit);
+      if (buffer == nullptr) {
+        buffer = source.ReadAt(range.offset, range.length);
+      }
+      AssertRangeContents(range, buffer);
+      held.push_back(buffer);
+    }
+  }
+  ASSERT_EQ(300, planner.bytes_buffered());
+
+  held.clear();
+  ASSERT_EQ(0, planner.bytes_buffered());
+}
+
+TEST(TestReadPlanner, InvalidRanges) {
+  std::shared_ptr<Buffer> contents = MakeFileContents(100);
+  CountingInputFile source(contents);
+  ReaderProperties properties;
+
+  std::vector<ReadRange> past_end = {{50, 51}};
+  ASSERT_THROW(ReadPlanner(&source, properties).Plan(past_end), ParquetException);
+  std::vector<ReadRange> negative_offset = {{-1, 10}};
+  ASSERT_THROW(ReadPlanner(&source, properties).Plan(negative_offset), ParquetException);
+  ASSERT_THROW(properties.set_io_concurrency(0), ParquetException);
+}
+
+}  // namespace test
+}  // namespace parquet
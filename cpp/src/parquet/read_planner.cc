@@ -0,0 +1,282 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/read_planner.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+#include "parquet/exception.h"
+
+namespace parquet {
+
+namespace {
+
+bool CompareByOffset(const ReadRange& left, const ReadRange& right) {
+  return left.offset < right.offset;
+}
+
+}  // namespace
+
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  std::vector<ReadRange> coalesced;
+  if (ranges.empty()) {
+    return coalesced;
+  }
+  std::sort(ranges.begin(), ranges.end(), CompareByOffset);
+
+  ReadRange current = ranges[0];
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    const ReadRange& next = ranges[i];
+    const int64_t current_end = current.offset + current.length;
+    const int64_t merged_length =
+        std::max(current_end, next.offset + next.length) - current.offset;
+    // Overlapping ranges are always merged so that every input range is
+    // contained in a single output range
+    if (next.offset < current_end || (next.offset - current_end <= hole_size_limit &&
+                                      merged_length <= range_size_limit)) {
+      current.length = merged_length;
+    } else {
+      coalesced.push_back(current);
+      current = next;
+    }
+  }
+  coalesced.push_back(current);
+  return coalesced;
+}
+
+// ----------------------------------------------------------------------
+// ReadPlanner
+
+namespace {
+
+bool CompareByOffsetAndLength(const ReadRange& left, const ReadRange& right) {
+  return left.offset < right.offset ||
+         (left.offset == right.offset && left.length < right.length);
+}
+
+}  // namespace
+
+struct ReadPlanner::Accounting {
+  std::mutex mutex;
+  // Reset when the planner is destroyed
+  ReadPlanner* planner;
+
+  void Release(int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (planner != nullptr) {
+      planner->ReleaseBytes(nbytes);
+    }
+  }
+};
+
+struct ReadPlanner::BufferedBytes {
+  std::shared_ptr<Accounting> accounting;
+  int64_t nbytes;
+
+  ~BufferedBytes() { accounting->Release(nbytes); }
+};
+
+// A planned range sliced from the bytes of its coalesced range, which are
+// counted as buffered for as long as any of those slices is alive
+class ReadPlanner::TrackedBuffer : public Buffer {
+ public:
+  TrackedBuffer(const std::shared_ptr<Buffer>& parent, int64_t offset, int64_t size,
+                std::shared_ptr<BufferedBytes> bytes)
+      : Buffer(parent, offset, size), bytes_(std::move(bytes)) {}
+
+ private:
+  std::shared_ptr<BufferedBytes> bytes_;
+};
+
+ReadPlanner::ReadPlanner(RandomAccessSource* source, const ReaderProperties& props)
+    : source_(source),
+      hole_size_limit_(props.io_hole_size_limit()),
+      range_size_limit_(props.io_range_size_limit()),
+      memory_limit_(props.pre_buffer_memory_limit()),
+      io_concurrency_(props.io_concurrency()),
+      accounting_(std::make_shared<Accounting>()),
+      next_read_(0),
+      bytes_buffered_(0) {
+  accounting_->planner = this;
+}
+
+ReadPlanner::~ReadPlanner() {
+  {
+    // Buffers released from now on don't start reads anymore
+    std::lock_guard<std::mutex> lock(accounting_->mutex);
+    accounting_->planner = nullptr;
+  }
+  // The reads reference the source, which may go away with the planner
+  for (const CoalescedRange& coalesced : coalesced_) {
+    if (coalesced.buffer.valid()) {
+      coalesced.buffer.wait();
+    }
+  }
+}
+
+void ReadPlanner::Plan(const std::vector<ReadRange>& ranges) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!planned_.empty()) {
+    throw ParquetException("The reads of this planner were already planned");
+  }
+
+  std::vector<ReadRange> sorted_ranges;
+  for (const ReadRange& range : ranges) {
+    if (range.offset < 0 || range.length <= 0 ||
+        range.offset + range.length > source_->Size()) {
+      throw ParquetException("Planned read range is outside of the file");
+    }
+    sorted_ranges.push_back(range);
+  }
+  std::sort(sorted_ranges.begin(), sorted_ranges.end(), CompareByOffsetAndLength);
+  // Reading the same column chunk twice is planned once
+  sorted_ranges.erase(std::unique(sorted_ranges.begin(), sorted_ranges.end(),
+                                  [](const ReadRange& left, const ReadRange& right) {
+                                    return left.offset == right.offset &&
+                                           left.length == right.length;
+                                  }),
+                      sorted_ranges.end());
+
+  for (const ReadRange& range :
+       CoalesceReadRanges(sorted_ranges, hole_size_limit_, range_size_limit_)) {
+    coalesced_.push_back({range, 0, false, {}, nullptr});
+  }
+
+  // Both vectors are sorted by offset, so each planned range belongs to the
+  // first coalesced range which ends after it
+  size_t coalesced_index = 0;
+  for (const ReadRange& range : sorted_ranges) {
+    while (coalesced_[coalesced_index].range.offset +
+               coalesced_[coalesced_index].range.length <
+           range.offset + range.length) {
+      ++coalesced_index;
+    }
+    coalesced_[coalesced_index].num_pending++;
+    planned_.push_back({range, coalesced_index, false});
+  }
+
+  if (!coalesced_.empty()) {
+    PARQUET_THROW_NOT_OK(::arrow::internal::ThreadPool::Make(
+        std::min(io_concurrency_, static_cast<int>(coalesced_.size())), &io_pool_));
+  }
+  LaunchReads();
+}
+
+void ReadPlanner::LaunchRead(CoalescedRange* coalesced) {
+  DCHECK(!coalesced->started);
+  coalesced->started = true;
+  bytes_buffered_ += coalesced->range.length;
+
+  coalesced->bytes = std::make_shared<BufferedBytes>();
+  coalesced->bytes->accounting = accounting_;
+  coalesced->bytes->nbytes = coalesced->range.length;
+
+  RandomAccessSource* source = source_;
+  const ReadRange range = coalesced->range;
+  coalesced->buffer = io_pool_
+                          ->Submit([source, range]() {
+                            std::shared_ptr<Buffer> buffer =
+                                source->ReadAt(range.offset, range.length);
+                            if (buffer->size() != range.length) {
+                              throw ParquetException("Failed reading planned range");
+                            }
+                            return buffer;
+                          })
+                          .share();
+}
+
+bool ReadPlanner::FitsInMemoryLimit(int64_t nbytes) const {
+  // Always keep at least one read going, even if it doesn't fit in the limit
+  return bytes_buffered_ == 0 || bytes_buffered_ + nbytes <= memory_limit_;
+}
+
+void ReadPlanner::LaunchReads() {
+  for (; next_read_ < coalesced_.size(); ++next_read_) {
+    CoalescedRange& coalesced = coalesced_[next_read_];
+    if (coalesced.started || coalesced.num_pending == 0) {
+      // Already read on demand, or consumed without being read
+      continue;
+    }
+    if (!FitsInMemoryLimit(coalesced.range.length)) {
+      break;
+    }
+    LaunchRead(&coalesced);
+  }
+}
+
+void ReadPlanner::ReleaseBytes(int64_t nbytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bytes_buffered_ -= nbytes;
+  LaunchReads();
+}
+
+std::shared_ptr<Buffer> ReadPlanner::Read(const ReadRange& range) {
+  std::shared_future<std::shared_ptr<Buffer>> buffer;
+  // Only released after unlocking the mutex, as releasing the bytes takes it
+  // again
+  std::shared_ptr<BufferedBytes> bytes;
+  int64_t buffer_offset;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::lower_bound(planned_.begin(), planned_.end(), range,
+                               [](const PlannedRange& planned, const ReadRange& value) {
+                                 return CompareByOffsetAndLength(planned.range, value);
+                               });
+    if (it == planned_.end() || it->range.offset != range.offset ||
+        it->range.length != range.length || it->consumed) {
+      return nullptr;
+    }
+    it->consumed = true;
+
+    CoalescedRange& coalesced = coalesced_[it->coalesced_index];
+    --coalesced.num_pending;
+    if (!coalesced.started) {
+      if (!FitsInMemoryLimit(coalesced.range.length)) {
+        // Consumed ahead of the reads in progress, and reading the whole
+        // coalesced range now would exceed the limit
+        return nullptr;
+      }
+      // Consumed out of order, read it now
+      LaunchRead(&coalesced);
+    }
+    buffer = coalesced.buffer;
+    bytes = coalesced.bytes;
+    buffer_offset = range.offset - coalesced.range.offset;
+
+    if (coalesced.num_pending == 0) {
+      // From now on the memory is only held by the consumers of the range
+      coalesced.buffer = std::shared_future<std::shared_ptr<Buffer>>();
+      coalesced.bytes.reset();
+    }
+  }
+  return std::make_shared<TrackedBuffer>(buffer.get(), buffer_offset, range.length,
+                                         std::move(bytes));
+}
+
+int64_t ReadPlanner::bytes_buffered() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_buffered_;
+}
+
+}  // namespace parquet
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PARQUET_READ_PLANNER_H
+#define PARQUET_READ_PLANNER_H
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "parquet/properties.h"
+#include "parquet/util/macros.h"
+#include "parquet/util/memory.h"
+#include "parquet/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+}  // namespace arrow
+
+namespace parquet {
+
+// A contiguous range of bytes of a file
+struct PARQUET_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+};
+
+// Merge the given ranges into fewer, larger ranges, sorted by offset. Two
+// neighbouring ranges are merged if they overlap, or if the gap between them is
+// at most `hole_size_limit` bytes and the merged range is at most
+// `range_size_limit` bytes long. Bytes in the gaps are read and thrown away, trading some
+// bandwidth for fewer round trips on high-latency storage.
+PARQUET_EXPORT
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit);
+
+// Reads a planned set of byte ranges (e.g. column chunks) of a file ahead of
+// their consumption. The ranges are coalesced with CoalesceReadRanges and read
+// concurrently on a dedicated pool of io_concurrency() threads, in file order,
+// for as long as the coalesced ranges held in memory fit in the
+// pre_buffer_memory_limit() of the ReaderProperties. The memory of a coalesced
+// range is accounted for until all the planned ranges it contains have been
+// consumed and the buffers returned for them are destroyed, which lets the
+// following reads start.
+//
+// This class is thread-safe.
+class PARQUET_EXPORT ReadPlanner {
+ public:
+  // The source must be safe to read concurrently with ReadAt and outlive the
+  // planner
+  ReadPlanner(RandomAccessSource* source, const ReaderProperties& props);
+
+  // Waits for the reads in progress
+  ~ReadPlanner();
+
+  // Plan the reads of the given ranges and start reading the first ones. May
+  // only be called once. Ranges may be given in any order.
+  void Plan(const std::vector<ReadRange>& ranges);
+
+  // Return the bytes of a planned range, waiting for them to be read if
+  // needed. Every planned range can only be consumed once; nullptr is returned
+  // for a range which was not planned or was already consumed, and for a range
+  // consumed ahead of the reads in progress whose coalesced range doesn't fit
+  // in the memory limit. The caller must then read the range from the file.
+  std::shared_ptr<Buffer> Read(const ReadRange& range);
+
+  // The number of bytes of coalesced ranges read or being read, and not
+  // released yet by the planner and the consumers of their planned ranges
+  int64_t bytes_buffered() const;
+
+ private:
+  // Shared with the buffers of the coalesced ranges, which may outlive the
+  // planner
+  struct Accounting;
+  // Held by the planner and the buffers returned for a coalesced range
+  struct BufferedBytes;
+  class TrackedBuffer;
+
+  struct CoalescedRange {
+    ReadRange range;
+    // Planned ranges within this one which were not consumed yet
+    int num_pending;
+    bool started;
+    // Both reset when the range is released
+    std::shared_future<std::shared_ptr<Buffer>> buffer;
+    std::shared_ptr<BufferedBytes> bytes;
+  };
+
+  struct PlannedRange {
+    ReadRange range;
+    size_t coalesced_index;
+    bool consumed;
+  };
+
+  // Start reading the next coalesced ranges which fit in the memory limit.
+  // Must be called with the mutex held
+  void LaunchReads();
+  void LaunchRead(CoalescedRange* coalesced);
+  // Whether reading that many more bytes stays within the memory limit. Must
+  // be called with the mutex held
+  bool FitsInMemoryLimit(int64_t nbytes) const;
+  // Called once the bytes of a coalesced range are released by the planner and
+  // all of its consumers
+  void ReleaseBytes(int64_t nbytes);
+
+  RandomAccessSource* source_;
+  int64_t hole_size_limit_;
+  int64_t range_size_limit_;
+  int64_t memory_limit_;
+  int io_concurrency_;
+  std::shared_ptr<::arrow::internal::ThreadPool> io_pool_;
+
+  std::shared_ptr<Accounting> accounting_;
+
+  mutable std::mutex mutex_;
+  // Both sorted by offset, and planned_ then by length
+  std::vector<CoalescedRange> coalesced_;
+  std::vector<PlannedRange> planned_;
+  // The first coalesced range whose read may not have been started yet
+  size_t next_read_;
+  int64_t bytes_buffered_;
+
+  PARQUET_DISALLOW_COPY_AND_ASSIGN(ReadPlanner);
+};
+
+}  // namespace parquet
+
+#endif  // PARQUET_READ_PLANNER_H
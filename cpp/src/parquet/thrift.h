@@ -80,6 +80,10 @@ static inline Compression::type FromThrift(format::CompressionCodec::type type)
   return static_cast<Compression::type>(type);
 }
 
+static inline BoundaryOrder::type FromThrift(format::BoundaryOrder::type type) {
+  return static_cast<BoundaryOrder::type>(type);
+}
+
 static inline format::Type::type ToThrift(Type::type type) {
   return static_cast<format::Type::type>(type);
 }
@@ -102,6 +106,10 @@ static inline format::CompressionCodec::type ToThrift(Compression::type type) {
   return static_cast<format::CompressionCodec::type>(type);
 }
 
+static inline format::BoundaryOrder::type ToThrift(BoundaryOrder::type type) {
+  return static_cast<format::BoundaryOrder::type>(type);
+}
+
 // ----------------------------------------------------------------------
 // Thrift struct serialization / deserialization utilities
 
@@ -135,6 +135,12 @@ struct SortOrder {
   enum type { SIGNED, UNSIGNED, UNKNOWN };
 };
 
+// Order of the page bounds stored in a column index. Readers may binary search
+// the bounds of an ASCENDING or DESCENDING index
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
 class ColumnOrder {
  public:
   enum type { UNDEFINED, TYPE_DEFINED_ORDER };
@@ -25,6 +25,7 @@
 
 #include <fcntl.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <strings.h>
@@ -37,8 +38,10 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -47,6 +50,7 @@
 #include "arrow/util/thread-pool.h"
 
 #include "plasma/common.h"
+#include "plasma/fast_path.h"
 #include "plasma/fling.h"
 #include "plasma/io.h"
 #include "plasma/malloc.h"
@@ -85,6 +89,11 @@ constexpr int64_t kBytesInMB = 1 << 20;
 // Use 100MB as an overestimate of the L3 cache size.
 constexpr int64_t kL3CacheSizeBytes = 100000000;
 
+// Number of times we poll the fast path channel for a response before yielding
+// the CPU, and number of yields between checks that the store is still alive.
+constexpr int64_t kFastPathSpinCount = 1000;
+constexpr int64_t kFastPathLivenessCheckInterval = 1000;
+
 // ----------------------------------------------------------------------
 // GPU support
 
@@ -174,6 +183,11 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
 
+  Status CreateBatch(const std::vector<ObjectID>& object_ids,
+                     const std::vector<int64_t>& data_sizes,
+                     const std::vector<std::string>& metadata,
+                     std::vector<std::shared_ptr<Buffer>>* data);
+
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
@@ -190,6 +204,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Seal(const ObjectID& object_id);
 
+  Status SealBatch(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
@@ -227,12 +243,35 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status PerformRelease(const ObjectID& object_id);
 
+  /// Tell the store that the client no longer uses an object, through the fast
+  /// path channel if possible.
+  Status ReleaseInStore(const ObjectID& object_id);
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
                         const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
                     ObjectBuffer* object_buffers);
 
+  /// Get the objects which are not filled out yet in object_buffers through the
+  /// fast path channel. Only sealed objects in memory-mapped files which the
+  /// client has already mapped can be gotten this way, the others are left for
+  /// a request over the socket.
+  ///
+  /// @param all_present Set to whether all the objects are now filled out.
+  Status GetBuffersFastPath(
+      const ObjectID* object_ids, int64_t num_objects,
+      const std::function<std::shared_ptr<Buffer>(
+          const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+      ObjectBuffer* object_buffers, bool* all_present);
+
+  /// Wake up the store if it is blocked waiting for events, after requests were
+  /// pushed to the fast path channel.
+  Status RingFastPathDoorbell();
+
+  /// Wait for the response to the oldest Get request of the fast path channel.
+  Status WaitForFastPathResponse(FastPathResponse* response);
+
   uint8_t* LookupOrMmap(int fd, int store_fd_val, int64_t map_size);
 
   uint8_t* LookupMmappedFile(int store_fd_val);
@@ -274,6 +313,13 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   int64_t store_capacity_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// The shared-memory channel used to get sealed objects and to release
+  /// objects without a round trip over the socket. nullptr if the store could
+  /// not allocate it.
+  FastPathChannel* fast_path_;
+  /// The store file descriptor of the memory-mapped file containing the fast
+  /// path channel. The file stays mapped for as long as the channel is used.
+  int fast_path_store_fd_;
 
 #ifdef PLASMA_GPU
   /// Cuda Device Manager.
@@ -283,7 +329,7 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() {
+PlasmaClient::Impl::Impl() : fast_path_(nullptr), fast_path_store_fd_(-1) {
 #ifdef PLASMA_GPU
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
@@ -432,6 +478,57 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::CreateBatch(const std::vector<ObjectID>& object_ids,
+                                       const std::vector<int64_t>& data_sizes,
+                                       const std::vector<std::string>& metadata,
+                                       std::vector<std::shared_ptr<Buffer>>* data) {
+  if (data_sizes.size() != object_ids.size() || metadata.size() != object_ids.size()) {
+    return Status::Invalid("CreateBatch() needs a data size and metadata per object");
+  }
+  ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " for "
+                   << object_ids.size() << " objects";
+  std::vector<int64_t> metadata_sizes;
+  metadata_sizes.reserve(metadata.size());
+  for (const auto& object_metadata : metadata) {
+    metadata_sizes.push_back(static_cast<int64_t>(object_metadata.size()));
+  }
+  RETURN_NOT_OK(
+      SendCreateBatchRequest(store_conn_, object_ids, data_sizes, metadata_sizes));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(
+      PlasmaReceive(store_conn_, MessageType::PlasmaCreateBatchReply, &buffer));
+  std::vector<PlasmaObject> objects;
+  std::vector<int> store_fds;
+  std::vector<int64_t> mmap_sizes;
+  // If the reply included an error, then the store will not send file
+  // descriptors.
+  RETURN_NOT_OK(ReadCreateBatchReply(buffer.data(), buffer.size(), &objects, &store_fds,
+                                     &mmap_sizes));
+  for (size_t i = 0; i < store_fds.size(); ++i) {
+    int fd = recv_fd(store_conn_);
+    ARROW_CHECK(fd >= 0) << "recv not successful";
+    LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+  }
+  ARROW_CHECK(objects.size() == object_ids.size());
+
+  data->clear();
+  data->reserve(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    PlasmaObject& object = objects[i];
+    ARROW_CHECK(object.data_size == data_sizes[i]);
+    ARROW_CHECK(object.metadata_size == metadata_sizes[i]);
+    // The metadata should come right after the data.
+    ARROW_CHECK(object.metadata_offset == object.data_offset + object.data_size);
+    uint8_t* pointer = LookupMmappedFile(object.store_fd) + object.data_offset;
+    memcpy(pointer + object.data_size, metadata[i].data(), metadata[i].size());
+    data->push_back(std::make_shared<MutableBuffer>(pointer, object.data_size));
+    // As in Create, the second reference is released by Seal.
+    IncrementObjectCount(object_ids[i], &object, false);
+    IncrementObjectCount(object_ids[i], &object, false);
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::GetBuffers(
     const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
     const std::function<std::shared_ptr<Buffer>(
@@ -479,6 +576,14 @@ Status PlasmaClient::Impl::GetBuffers(
     return Status::OK();
   }
 
+  if (fast_path_ != nullptr) {
+    RETURN_NOT_OK(GetBuffersFastPath(object_ids, num_objects, wrap_buffer, object_buffers,
+                                     &all_present));
+    if (all_present) {
+      return Status::OK();
+    }
+  }
+
   // If we get here, then the objects aren't all currently in use by this
   // client, so we need to send a request to the plasma store.
   RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
@@ -558,6 +663,120 @@ Status PlasmaClient::Impl::GetBuffers(
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::GetBuffersFastPath(
+    const ObjectID* object_ids, int64_t num_objects,
+    const std::function<std::shared_ptr<Buffer>(
+        const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
+    ObjectBuffer* object_buffers, bool* all_present) {
+  // The same object ID may appear several times, so request each object once
+  // and remember all its positions.
+  std::vector<ObjectID> requested_ids;
+  std::unordered_map<ObjectID, std::vector<int64_t>> positions;
+  for (int64_t i = 0; i < num_objects; ++i) {
+    if (object_buffers[i].data) {
+      continue;
+    }
+    std::vector<int64_t>& object_positions = positions[object_ids[i]];
+    if (object_positions.empty()) {
+      requested_ids.push_back(object_ids[i]);
+    }
+    object_positions.push_back(i);
+  }
+
+  int64_t num_found = 0;
+  size_t next = 0;
+  while (next < requested_ids.size()) {
+    // Push as many requests as the channel can take. The response ring has the
+    // same capacity as the request ring, so the store can always respond.
+    size_t num_pushed = 0;
+    while (next + num_pushed < requested_ids.size() &&
+           fast_path_->requests.Push(
+               {FastPathRequestType::Get, requested_ids[next + num_pushed]})) {
+      ++num_pushed;
+    }
+    if (num_pushed == 0) {
+      // The channel is full of releases, get the remaining objects over the
+      // socket.
+      break;
+    }
+    RETURN_NOT_OK(RingFastPathDoorbell());
+    for (size_t k = 0; k < num_pushed; ++k) {
+      FastPathResponse response;
+      RETURN_NOT_OK(WaitForFastPathResponse(&response));
+      const ObjectID& object_id = requested_ids[next + k];
+      DCHECK(response.object_id == object_id);
+      // If the object lives in a memory-mapped file that the client hasn't
+      // mapped yet, the file descriptor must be sent over the socket. The store
+      // already records the object as used by this client, which the Get over
+      // the socket won't do twice.
+      if (!response.found || mmap_table_.count(response.store_fd) == 0) {
+        continue;
+      }
+      PlasmaObject object;
+      object.store_fd = response.store_fd;
+      object.data_offset = response.data_offset;
+      object.metadata_offset = response.data_offset + response.data_size;
+      object.data_size = response.data_size;
+      object.metadata_size = response.metadata_size;
+      object.device_num = 0;
+      uint8_t* data = LookupMmappedFile(object.store_fd);
+      for (int64_t i : positions[object_id]) {
+        std::shared_ptr<Buffer> physical_buf = std::make_shared<Buffer>(
+            data + object.data_offset, object.data_size + object.metadata_size);
+        physical_buf = wrap_buffer(object_id, physical_buf);
+        object_buffers[i].data = SliceBuffer(physical_buf, 0, object.data_size);
+        object_buffers[i].metadata =
+            SliceBuffer(physical_buf, object.data_size, object.metadata_size);
+        object_buffers[i].device_num = 0;
+        // Increment the count of the number of instances of this object that
+        // this client is using. Cache the reference to the object.
+        IncrementObjectCount(object_id, &object, true);
+      }
+      ++num_found;
+    }
+    next += num_pushed;
+  }
+  *all_present = num_found == static_cast<int64_t>(requested_ids.size());
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::RingFastPathDoorbell() {
+  // Order the push of the requests before reading the flag. The store sets the
+  // flag before checking for requests, so either it sees our requests or we
+  // see the flag.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (fast_path_->store_sleeping.load(std::memory_order_relaxed) == 0) {
+    return Status::OK();
+  }
+  // One doorbell is enough until the store goes back to sleep, since it
+  // processes the channel on every iteration of its event loop.
+  fast_path_->store_sleeping.store(0, std::memory_order_relaxed);
+  return SendFastPathDoorbell(store_conn_);
+}
+
+Status PlasmaClient::Impl::WaitForFastPathResponse(FastPathResponse* response) {
+  const FastPathResponse* front;
+  int64_t num_spins = 0;
+  while ((front = fast_path_->responses.Front()) == nullptr) {
+    ++num_spins;
+    if (num_spins < kFastPathSpinCount) {
+      continue;
+    }
+    std::this_thread::yield();
+    if (num_spins % kFastPathLivenessCheckInterval == 0) {
+      // The store never sends anything on the socket unless asked to, so the
+      // socket only becomes readable if the store hung up.
+      struct pollfd poll_fd = {store_conn_, POLLIN, 0};
+      if (poll(&poll_fd, 1, 0) != 0) {
+        return Status::IOError("The plasma store hung up");
+      }
+    }
+  }
+  *response = *front;
+  fast_path_->responses.Pop();
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Get(const std::vector<ObjectID>& object_ids,
                                int64_t timeout_ms, std::vector<ObjectBuffer>* out) {
   const auto wrap_buffer = [=](const ObjectID& object_id,
@@ -632,7 +851,7 @@ Status PlasmaClient::Impl::PerformRelease(const ObjectID& object_id) {
   if (object_entry->second->count == 0) {
     // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(UnmapObject(object_id));
-    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
+    RETURN_NOT_OK(ReleaseInStore(object_id));
     auto iter = deletion_cache_.find(object_id);
     if (iter != deletion_cache_.end()) {
       deletion_cache_.erase(object_id);
@@ -642,6 +861,17 @@ Status PlasmaClient::Impl::PerformRelease(const ObjectID& object_id) {
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::ReleaseInStore(const ObjectID& object_id) {
+  // Releases have no reply, so they only need a doorbell if the store sleeps.
+  // If the channel is full, the release goes over the socket, which the store
+  // processes after the requests of the channel.
+  if (fast_path_ != nullptr &&
+      fast_path_->requests.Push({FastPathRequestType::Release, object_id})) {
+    return RingFastPathDoorbell();
+  }
+  return SendReleaseRequest(store_conn_, object_id);
+}
+
 Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   // If the client is already disconnected, ignore release requests.
   if (store_conn_ < 0) {
@@ -805,6 +1035,88 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::SealBatch(const std::vector<ObjectID>& object_ids) {
+  // Check all the objects before sealing any of them.
+  std::vector<ObjectInUseEntry*> entries;
+  std::unordered_set<ObjectID> unique_ids;
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return Status::PlasmaObjectNonexistent(
+          "SealBatch() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed || !unique_ids.insert(object_id).second) {
+      return Status::PlasmaObjectAlreadySealed(
+          "SealBatch() called on an already sealed object");
+    }
+    entries.push_back(object_entry->second.get());
+  }
+
+  // Small objects are hashed concurrently by groups, while each large object is
+  // hashed in parallel by ComputeObjectHash.
+  std::vector<ObjectBuffer> object_buffers(object_ids.size());
+  std::vector<uint64_t> hashes(object_ids.size(), 0);
+  std::vector<size_t> small_objects;
+  std::vector<size_t> large_objects;
+  int64_t small_objects_bytes = 0;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const PlasmaObject& object = entries[i]->object;
+    if (object.device_num != 0) {
+      // TODO(wap): Create cuda program to hash data on gpu.
+      continue;
+    }
+    uint8_t* pointer = LookupMmappedFile(object.store_fd) + object.data_offset;
+    object_buffers[i].data = std::make_shared<Buffer>(pointer, object.data_size);
+    object_buffers[i].metadata =
+        std::make_shared<Buffer>(pointer + object.data_size, object.metadata_size);
+    object_buffers[i].device_num = 0;
+    if (object.data_size >= kBytesInMB) {
+      large_objects.push_back(i);
+    } else {
+      small_objects.push_back(i);
+      small_objects_bytes += object.data_size + object.metadata_size;
+    }
+  }
+  // Don't hand few bytes over to other threads.
+  const size_t num_groups =
+      small_objects_bytes >= kBytesInMB
+          ? std::min(small_objects.size(), static_cast<size_t>(kHashingConcurrency))
+          : 0;
+  auto hash_group = [this, &small_objects, &object_buffers, &hashes](size_t group,
+                                                                     size_t stride) {
+    for (size_t k = group; k < small_objects.size(); k += stride) {
+      hashes[small_objects[k]] = ComputeObjectHash(object_buffers[small_objects[k]]);
+    }
+  };
+  auto pool = arrow::internal::GetCpuThreadPool();
+  std::vector<std::future<void>> futures;
+  for (size_t group = 0; group < num_groups; ++group) {
+    futures.push_back(pool->Submit(hash_group, group, num_groups));
+  }
+  if (num_groups == 0) {
+    hash_group(0, 1);
+  }
+  for (size_t i : large_objects) {
+    hashes[i] = ComputeObjectHash(object_buffers[i]);
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+
+  std::vector<uint8_t> digests(object_ids.size() * kDigestSize);
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    memcpy(&digests[i * kDigestSize], &hashes[i], sizeof(hashes[i]));
+    entries[i]->is_sealed = true;
+  }
+  RETURN_NOT_OK(SendSealBatchRequest(store_conn_, object_ids, digests));
+  // Release the references taken by Create or CreateBatch to keep the objects
+  // alive until they are sealed.
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(Release(object_id));
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end())
@@ -939,6 +1251,24 @@ Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaConnectReply, &buffer));
   RETURN_NOT_OK(ReadConnectReply(buffer.data(), buffer.size(), &store_capacity_));
+  // Set up the shared-memory fast path. If the store is out of memory, the
+  // client only uses the socket.
+  RETURN_NOT_OK(SendFastPathRequest(store_conn_));
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaFastPathReply, &buffer));
+  int store_fd;
+  int64_t offset;
+  int64_t mmap_size;
+  Status s = ReadFastPathReply(buffer.data(), buffer.size(), &store_fd, &offset,
+                               &mmap_size);
+  if (s.ok()) {
+    int fd = recv_fd(store_conn_);
+    ARROW_CHECK(fd >= 0) << "recv not successful";
+    uint8_t* pointer = LookupOrMmap(fd, store_fd, mmap_size);
+    // Count the channel as an object in use, so that the file stays mapped.
+    mmap_table_[store_fd].count += 1;
+    fast_path_ = reinterpret_cast<FastPathChannel*>(pointer + offset);
+    fast_path_store_fd_ = store_fd;
+  }
   return Status::OK();
 }
 
@@ -955,6 +1285,23 @@ Status PlasmaClient::Impl::Disconnect() {
     close(manager_conn_);
     manager_conn_ = -1;
   }
+
+  // Stop using the fast path channel. The store processes the requests left in
+  // it when it notices the disconnection.
+  if (fast_path_ != nullptr) {
+    fast_path_ = nullptr;
+    auto entry = mmap_table_.find(fast_path_store_fd_);
+    ARROW_CHECK(entry != mmap_table_.end());
+    if (entry->second.count == 1) {
+      int err = munmap(entry->second.pointer, entry->second.length - kMmapRegionsGap);
+      if (err == -1) {
+        return Status::IOError("Error during munmap");
+      }
+      mmap_table_.erase(entry);
+    } else {
+      entry->second.count -= 1;
+    }
+  }
   return Status::OK();
 }
 
@@ -1046,6 +1393,13 @@ Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
   return impl_->Create(object_id, data_size, metadata, metadata_size, data, device_num);
 }
 
+Status PlasmaClient::CreateBatch(const std::vector<ObjectID>& object_ids,
+                                 const std::vector<int64_t>& data_sizes,
+                                 const std::vector<std::string>& metadata,
+                                 std::vector<std::shared_ptr<Buffer>>* data) {
+  return impl_->CreateBatch(object_ids, data_sizes, metadata, data);
+}
+
 Status PlasmaClient::Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
                          std::vector<ObjectBuffer>* object_buffers) {
   return impl_->Get(object_ids, timeout_ms, object_buffers);
@@ -1070,6 +1424,10 @@ Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(obje
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::SealBatch(const std::vector<ObjectID>& object_ids) {
+  return impl_->SealBatch(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
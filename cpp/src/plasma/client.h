@@ -95,6 +95,25 @@ class ARROW_EXPORT PlasmaClient {
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
                 int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
 
+  /// Create several objects on the host with a single request to the Plasma
+  /// Store. Either all of the objects are created, or none of them is.
+  ///
+  /// \param object_ids The IDs to use for the newly created objects.
+  /// \param data_sizes The sizes in bytes of the space to be allocated for the
+  ///        data of each object (this does not include space used for
+  ///        metadata).
+  /// \param metadata The metadata of each object, which may be empty.
+  /// \param data The addresses of the newly created objects will be written
+  ///        here, in the same order as their IDs.
+  /// \return The return status.
+  ///
+  /// Like with Create, each returned object must be released once it is done
+  /// with, and must be either sealed or aborted.
+  Status CreateBatch(const std::vector<ObjectID>& object_ids,
+                     const std::vector<int64_t>& data_sizes,
+                     const std::vector<std::string>& metadata,
+                     std::vector<std::shared_ptr<Buffer>>* data);
+
   /// Get some objects from the Plasma Store. This function will block until the
   /// objects have all been created and sealed in the Plasma Store or the
   /// timeout expires.
@@ -179,6 +198,14 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal several objects in the object store with a single request. The
+  /// digests of the objects are computed in parallel.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status. If it is not OK, none of the objects are
+  ///         sealed.
+  Status SealBatch(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -339,6 +366,7 @@ class ARROW_EXPORT PlasmaClient {
   FRIEND_TEST(TestPlasmaStore, GetTest);
   FRIEND_TEST(TestPlasmaStore, LegacyGetTest);
   FRIEND_TEST(TestPlasmaStore, AbortTest);
+  FRIEND_TEST(TestPlasmaStore, ManyGetReleaseTest);
 
   /// This is a helper method that flushes all pending release calls to the
   /// store.
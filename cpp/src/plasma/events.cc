@@ -66,7 +66,26 @@ void EventLoop::RemoveFileEvent(int fd) {
   file_callbacks_.erase(fd);
 }
 
-void EventLoop::Start() { aeMain(loop_); }
+void EventLoop::Start() {
+  if (!before_poll_) {
+    aeMain(loop_);
+    return;
+  }
+  loop_->stop = 0;
+  while (!loop_->stop) {
+    before_poll_(false);
+    // Process the pending events without blocking first, so that the handlers
+    // know when the loop is about to block.
+    if (aeProcessEvents(loop_, AE_ALL_EVENTS | AE_DONT_WAIT) > 0) {
+      continue;
+    }
+    before_poll_(true);
+    aeProcessEvents(loop_, AE_ALL_EVENTS);
+    if (wake_up_) {
+      wake_up_();
+    }
+  }
+}
 
 void EventLoop::Stop() { aeStop(loop_); }
 
@@ -87,4 +106,10 @@ int EventLoop::RemoveTimer(int64_t timer_id) {
   return err;
 }
 
+void EventLoop::SetPollCallbacks(const PollCallback& before_poll,
+                                 const WakeUpCallback& wake_up) {
+  before_poll_ = before_poll;
+  wake_up_ = wake_up;
+}
+
 }  // namespace plasma
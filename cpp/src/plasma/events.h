@@ -53,6 +53,14 @@ class EventLoop {
   // triggered again.
   using TimerCallback = std::function<int(int64_t)>;
 
+  // This handler is called on every iteration of the event loop, before it
+  // polls for events. The argument tells whether the loop is idle, in which
+  // case it will then block until the next event.
+  using PollCallback = std::function<void(bool)>;
+
+  // This handler is called when the event loop wakes up after blocking.
+  using WakeUpCallback = std::function<void()>;
+
   EventLoop();
 
   /// Add a new file event handler to the event loop.
@@ -82,6 +90,13 @@ class EventLoop {
   /// @return The ae.c error code. TODO(pcm): needs to be standardized
   int RemoveTimer(int64_t timer_id);
 
+  /// Register handlers to run work that is not triggered by a file descriptor.
+  /// This replaces the previously registered handlers.
+  ///
+  /// @param before_poll The callback called before polling for events.
+  /// @param wake_up The callback called after waking up from blocking.
+  void SetPollCallbacks(const PollCallback& before_poll, const WakeUpCallback& wake_up);
+
   /// \brief Run the event loop.
   void Start();
 
@@ -98,6 +113,8 @@ class EventLoop {
   aeEventLoop* loop_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
+  PollCallback before_poll_;
+  WakeUpCallback wake_up_;
 };
 
 }  // namespace plasma
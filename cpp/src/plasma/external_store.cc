@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/external_store.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <future>
+#include <sstream>
+#include <utility>
+
+#include "arrow/io/file.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+namespace plasma {
+
+using arrow::internal::ThreadPool;
+
+LocalFileExternalStore::LocalFileExternalStore(const std::string& directory,
+                                               std::shared_ptr<ThreadPool> pool)
+    : directory_(directory), pool_(std::move(pool)) {}
+
+LocalFileExternalStore::~LocalFileExternalStore() { DCHECK_OK(pool_->Shutdown()); }
+
+Status LocalFileExternalStore::Make(const std::string& directory, int num_threads,
+                                    std::shared_ptr<ExternalStore>* out) {
+  if (mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST) {
+    std::stringstream ss;
+    ss << "Cannot create the spill directory " << directory << ": " << strerror(errno);
+    return Status::IOError(ss.str());
+  }
+  std::shared_ptr<ThreadPool> pool;
+  RETURN_NOT_OK(ThreadPool::Make(num_threads, &pool));
+  out->reset(new LocalFileExternalStore(directory, std::move(pool)));
+  return Status::OK();
+}
+
+std::string LocalFileExternalStore::ObjectPath(const ObjectID& object_id) const {
+  return directory_ + "/" + object_id.hex();
+}
+
+Status LocalFileExternalStore::WriteObject(const ObjectID& object_id,
+                                           const Buffer& buffer) const {
+  std::shared_ptr<arrow::io::FileOutputStream> file;
+  RETURN_NOT_OK(arrow::io::FileOutputStream::Open(ObjectPath(object_id), &file));
+  Status s = file->Write(buffer.data(), buffer.size());
+  Status close_status = file->Close();
+  return s.ok() ? close_status : s;
+}
+
+Status LocalFileExternalStore::Put(const std::vector<ObjectID>& object_ids,
+                                   const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  DCHECK_EQ(object_ids.size(), buffers.size());
+  // The files are not synced: the page cache writes them back to disk in the
+  // background, and they only need to outlive the eviction, not the store.
+  std::vector<std::future<Status>> futures;
+  futures.reserve(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    const ObjectID& object_id = object_ids[i];
+    const Buffer* buffer = buffers[i].get();
+    futures.push_back(pool_->Submit(
+        [this, object_id, buffer]() { return WriteObject(object_id, *buffer); }));
+  }
+  // Wait for all the writes, since the caller reuses the memory of the objects.
+  Status status;
+  for (auto& future : futures) {
+    Status s = future.get();
+    if (status.ok()) {
+      status = s;
+    }
+  }
+  if (!status.ok()) {
+    ARROW_UNUSED(Delete(object_ids));
+  }
+  return status;
+}
+
+Status LocalFileExternalStore::Get(const ObjectID& object_id, int64_t size,
+                                   uint8_t* out) {
+  if (size == 0) {
+    // Empty files can't be memory mapped.
+    return Status::OK();
+  }
+  std::shared_ptr<arrow::io::MemoryMappedFile> file;
+  RETURN_NOT_OK(arrow::io::MemoryMappedFile::Open(ObjectPath(object_id),
+                                                  arrow::io::FileMode::READ, &file));
+  // Reading from a memory mapped file returns a slice of the mapping.
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(file->ReadAt(0, size, &buffer));
+  if (buffer->size() != size) {
+    std::stringstream ss;
+    ss << "The spilled object " << object_id.hex() << " has " << buffer->size()
+       << " bytes instead of " << size;
+    return Status::IOError(ss.str());
+  }
+  memcpy(out, buffer->data(), static_cast<size_t>(size));
+  return file->Close();
+}
+
+Status LocalFileExternalStore::Delete(const std::vector<ObjectID>& object_ids) {
+  for (const auto& object_id : object_ids) {
+    if (unlink(ObjectPath(object_id).c_str()) != 0 && errno != ENOENT) {
+      std::stringstream ss;
+      ss << "Cannot remove the spilled object " << object_id.hex() << ": "
+         << strerror(errno);
+      return Status::IOError(ss.str());
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace plasma
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_EXTERNAL_STORE_H
+#define PLASMA_EXTERNAL_STORE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+
+#include "plasma/common.h"
+
+namespace arrow {
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+}  // namespace arrow
+
+namespace plasma {
+
+using arrow::Buffer;
+using arrow::Status;
+
+// ==== The external store ====
+//
+// An external store keeps the sealed objects evicted from the Plasma store, so
+// that they can be restored when they are needed again instead of having to be
+// recomputed. The store only calls it from its event loop.
+
+class ExternalStore {
+ public:
+  virtual ~ExternalStore() = default;
+
+  /// Write a batch of objects to the external store.
+  ///
+  /// @param object_ids The IDs of the objects to write.
+  /// @param buffers The contents of the objects, i.e. the data followed by the
+  ///        metadata. The buffers point to the memory of the Plasma store,
+  ///        which is reused as soon as this call returns.
+  /// @return The status of the call. If it is not OK, none of the objects may
+  ///         be read back.
+  virtual Status Put(const std::vector<ObjectID>& object_ids,
+                     const std::vector<std::shared_ptr<Buffer>>& buffers) = 0;
+
+  /// Read an object from the external store.
+  ///
+  /// @param object_id The ID of the object to read.
+  /// @param size The size of the object, i.e. of its data and metadata.
+  /// @param out The memory where the object is copied, of the given size.
+  /// @return The status of the call.
+  virtual Status Get(const ObjectID& object_id, int64_t size, uint8_t* out) = 0;
+
+  /// Remove objects from the external store. Objects which are not present
+  /// are ignored.
+  ///
+  /// @param object_ids The IDs of the objects to remove.
+  /// @return The status of the call.
+  virtual Status Delete(const std::vector<ObjectID>& object_ids) = 0;
+};
+
+/// External store keeping each object in a file of a local directory. The
+/// files of a batch are written concurrently by a pool of I/O threads, and
+/// objects are restored from a memory mapping of their file.
+class LocalFileExternalStore : public ExternalStore {
+ public:
+  ~LocalFileExternalStore() override;
+
+  /// Create an external store in a directory, which is created if needed.
+  ///
+  /// @param directory The directory where the objects are written.
+  /// @param num_threads The number of threads writing the objects.
+  /// @param out The external store.
+  /// @return The status of the call.
+  static Status Make(const std::string& directory, int num_threads,
+                     std::shared_ptr<ExternalStore>* out);
+
+  Status Put(const std::vector<ObjectID>& object_ids,
+             const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
+  Status Get(const ObjectID& object_id, int64_t size, uint8_t* out) override;
+
+  Status Delete(const std::vector<ObjectID>& object_ids) override;
+
+ private:
+  LocalFileExternalStore(const std::string& directory,
+                         std::shared_ptr<arrow::internal::ThreadPool> pool);
+
+  std::string ObjectPath(const ObjectID& object_id) const;
+
+  Status WriteObject(const ObjectID& object_id, const Buffer& buffer) const;
+
+  std::string directory_;
+  std::shared_ptr<arrow::internal::ThreadPool> pool_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_EXTERNAL_STORE_H
@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Shared-memory channel between a client and the store, used to get sealed
+// objects and to release objects without a round trip over the Unix domain
+// socket. The channel is allocated by the store in its dlmalloc arena, so the
+// client maps it through the same file descriptor as the objects.
+
+#ifndef PLASMA_FAST_PATH_H
+#define PLASMA_FAST_PATH_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "plasma/common.h"
+
+namespace plasma {
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "The fast path needs lock-free atomics, which are address-free and "
+              "thus usable across processes");
+
+/// Number of entries of each ring of the channel.
+constexpr uint64_t kFastPathCapacity = 256;
+
+enum class FastPathRequestType : int32_t { Get = 1, Release = 2 };
+
+struct FastPathRequest {
+  FastPathRequestType type;
+  ObjectID object_id;
+};
+
+struct FastPathResponse {
+  ObjectID object_id;
+  /// Whether the object is sealed and was added to the objects used by the
+  /// client. If not, the client falls back to a Get over the socket.
+  int32_t found;
+  /// The file descriptor of the memory mapped file in the store.
+  int32_t store_fd;
+  int64_t data_offset;
+  int64_t data_size;
+  int64_t metadata_size;
+};
+
+/// Single-producer single-consumer ring of fixed-size entries. The producer
+/// only writes head and the consumer only writes tail, and both keep growing:
+/// the slot of an entry is its position modulo the capacity.
+template <typename T>
+struct FastPathRing {
+  // Keep the two indices on different cache lines so that the producer and the
+  // consumer don't invalidate each other's lines.
+  alignas(64) std::atomic<uint64_t> head;
+  alignas(64) std::atomic<uint64_t> tail;
+  alignas(64) T slots[kFastPathCapacity];
+
+  /// Append an entry. Returns false if the ring is full. Producer side only.
+  bool Push(const T& entry) {
+    uint64_t position = head.load(std::memory_order_relaxed);
+    if (position - tail.load(std::memory_order_acquire) >= kFastPathCapacity) {
+      return false;
+    }
+    slots[position % kFastPathCapacity] = entry;
+    head.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Return the oldest entry without consuming it, or nullptr if the ring is
+  /// empty. Consumer side only.
+  const T* Front() const {
+    uint64_t position = tail.load(std::memory_order_relaxed);
+    if (head.load(std::memory_order_acquire) == position) {
+      return nullptr;
+    }
+    return &slots[position % kFastPathCapacity];
+  }
+
+  /// Consume the entry returned by Front(). Consumer side only.
+  void Pop() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /// Whether the indices are consistent. The store checks this before trusting
+  /// a ring that is also written by the client.
+  bool IsValid() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire) <=
+           kFastPathCapacity;
+  }
+
+  bool IsFull() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire) >=
+           kFastPathCapacity;
+  }
+};
+
+/// The channel of one client. Requests are processed in order, and only Get
+/// requests have a response.
+struct FastPathChannel {
+  FastPathRing<FastPathRequest> requests;
+  FastPathRing<FastPathResponse> responses;
+  /// Set by the store while it is blocked waiting for events, in which case the
+  /// client must ring the doorbell on the socket after pushing requests.
+  alignas(64) std::atomic<int32_t> store_sleeping;
+
+  void Init() {
+    requests.head.store(0);
+    requests.tail.store(0);
+    responses.head.store(0);
+    responses.tail.store(0);
+    store_sleeping.store(0);
+  }
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_FAST_PATH_H
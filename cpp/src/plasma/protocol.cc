@@ -180,6 +180,90 @@ Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes) {
+  DCHECK(object_ids.size() == data_sizes.size());
+  DCHECK(object_ids.size() == metadata_sizes.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<uint64_t> data_sizes_unsigned(data_sizes.begin(), data_sizes.end());
+  std::vector<uint64_t> metadata_sizes_unsigned(metadata_sizes.begin(),
+                                                metadata_sizes.end());
+  auto message = fb::CreatePlasmaCreateBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(data_sizes_unsigned), fbb.CreateVector(metadata_sizes_unsigned));
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchRequest, &fbb, message);
+}
+
+Status ReadCreateBatchRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  uoffset_t num_objects = message->object_ids()->size();
+  if (message->data_sizes()->size() != num_objects ||
+      message->metadata_sizes()->size() != num_objects) {
+    return Status::Invalid("Malformed create batch request");
+  }
+  object_ids->clear();
+  data_sizes->clear();
+  metadata_sizes->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    data_sizes->push_back(static_cast<int64_t>(message->data_sizes()->Get(i)));
+    metadata_sizes->push_back(static_cast<int64_t>(message->metadata_sizes()->Get(i)));
+  }
+  return Status::OK();
+}
+
+Status SendCreateBatchReply(int sock, PlasmaError error,
+                            const std::vector<PlasmaObject>& objects,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<PlasmaObjectSpec> object_specs;
+  for (const auto& object : objects) {
+    object_specs.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
+                                            object.data_size, object.metadata_offset,
+                                            object.metadata_size, object.device_num));
+  }
+  auto message = fb::CreatePlasmaCreateBatchReply(
+      fbb, error, fbb.CreateVectorOfStructs(object_specs), fbb.CreateVector(store_fds),
+      fbb.CreateVector(mmap_sizes));
+  return PlasmaSend(sock, MessageType::PlasmaCreateBatchReply, &fbb, message);
+}
+
+Status ReadCreateBatchReply(uint8_t* data, size_t size,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  objects->clear();
+  store_fds->clear();
+  mmap_sizes->clear();
+  for (uoffset_t i = 0; i < message->plasma_objects()->size(); ++i) {
+    const PlasmaObjectSpec* spec = message->plasma_objects()->Get(i);
+    PlasmaObject object;
+    object.store_fd = spec->segment_index();
+    object.data_offset = spec->data_offset();
+    object.data_size = spec->data_size();
+    object.metadata_offset = spec->metadata_offset();
+    object.metadata_size = spec->metadata_size();
+    object.device_num = spec->device_num();
+    objects->push_back(object);
+  }
+  ARROW_CHECK(message->store_fds()->size() == message->mmap_sizes()->size());
+  for (uoffset_t i = 0; i < message->store_fds()->size(); i++) {
+    store_fds->push_back(message->store_fds()->Get(i));
+    mmap_sizes->push_back(message->mmap_sizes()->Get(i));
+  }
+  return PlasmaErrorStatus(message->error());
+}
+
 Status SendAbortRequest(int sock, ObjectID object_id) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = fb::CreatePlasmaAbortRequest(fbb, fbb.CreateString(object_id.binary()));
@@ -244,6 +328,33 @@ Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<uint8_t>& digests) {
+  DCHECK(digests.size() == object_ids.size() * kDigestSize);
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(digests));
+  return PlasmaSend(sock, MessageType::PlasmaSealBatchRequest, &fbb, message);
+}
+
+Status ReadSealBatchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<uint8_t>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  uoffset_t num_objects = message->object_ids()->size();
+  if (message->digests()->size() != num_objects * kDigestSize) {
+    return Status::Invalid("Malformed seal batch request");
+  }
+  object_ids->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  digests->assign(message->digests()->begin(), message->digests()->end());
+  return Status::OK();
+}
+
 // Release messages.
 
 Status SendReleaseRequest(int sock, ObjectID object_id) {
@@ -483,6 +594,39 @@ Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity) {
   return Status::OK();
 }
 
+// Fast path messages.
+
+Status SendFastPathRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaFastPathRequest(fbb);
+  return PlasmaSend(sock, MessageType::PlasmaFastPathRequest, &fbb, message);
+}
+
+Status SendFastPathReply(int sock, PlasmaError error, int store_fd, int64_t offset,
+                         int64_t mmap_size) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message =
+      fb::CreatePlasmaFastPathReply(fbb, error, store_fd, offset, mmap_size);
+  return PlasmaSend(sock, MessageType::PlasmaFastPathReply, &fbb, message);
+}
+
+Status ReadFastPathReply(uint8_t* data, size_t size, int* store_fd, int64_t* offset,
+                         int64_t* mmap_size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaFastPathReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *store_fd = message->store_fd();
+  *offset = message->offset();
+  *mmap_size = message->mmap_size();
+  return PlasmaErrorStatus(message->error());
+}
+
+Status SendFastPathDoorbell(int sock) {
+  int64_t header[3] = {kPlasmaProtocolVersion,
+                       static_cast<int64_t>(MessageType::PlasmaFastPathDoorbell), 0};
+  return WriteBytes(sock, reinterpret_cast<uint8_t*>(header), sizeof(header));
+}
+
 // Evict messages.
 
 Status SendEvictRequest(int sock, int64_t num_bytes) {
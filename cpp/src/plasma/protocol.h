@@ -57,6 +57,25 @@ Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
 Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
                        PlasmaObject* object, int* store_fd, int64_t* mmap_size);
 
+Status SendCreateBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                              const std::vector<int64_t>& data_sizes,
+                              const std::vector<int64_t>& metadata_sizes);
+
+Status ReadCreateBatchRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids,
+                              std::vector<int64_t>* data_sizes,
+                              std::vector<int64_t>* metadata_sizes);
+
+Status SendCreateBatchReply(int sock, PlasmaError error,
+                            const std::vector<PlasmaObject>& objects,
+                            const std::vector<int>& store_fds,
+                            const std::vector<int64_t>& mmap_sizes);
+
+Status ReadCreateBatchReply(uint8_t* data, size_t size,
+                            std::vector<PlasmaObject>* objects,
+                            std::vector<int>* store_fds,
+                            std::vector<int64_t>* mmap_sizes);
+
 Status SendAbortRequest(int sock, ObjectID object_id);
 
 Status ReadAbortRequest(uint8_t* data, size_t size, ObjectID* object_id);
@@ -76,6 +95,12 @@ Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                            const std::vector<uint8_t>& digests);
+
+Status ReadSealBatchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                            std::vector<uint8_t>* digests);
+
 /* Plasma Get message functions. */
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
@@ -161,6 +186,20 @@ Status SendConnectReply(int sock, int64_t memory_capacity);
 
 Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity);
 
+/* Plasma fast path message functions. */
+
+Status SendFastPathRequest(int sock);
+
+Status SendFastPathReply(int sock, PlasmaError error, int store_fd, int64_t offset,
+                         int64_t mmap_size);
+
+Status ReadFastPathReply(uint8_t* data, size_t size, int* store_fd, int64_t* offset,
+                         int64_t* mmap_size);
+
+/// Wake up the store to process the fast path channel of the client. The
+/// doorbell has no body and is sent with a single write.
+Status SendFastPathDoorbell(int sock);
+
 /* Plasma Evict message functions (no reply so far). */
 
 Status SendEvictRequest(int sock, int64_t num_bytes);
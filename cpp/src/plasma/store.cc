@@ -43,9 +43,12 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <ctime>
 #include <deque>
 #include <memory>
+#include <new>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -109,21 +112,38 @@ GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
   num_objects_to_wait_for = unique_ids.size();
 }
 
-Client::Client(int fd) : fd(fd), notification_fd(-1) {}
+Client::Client(int fd) : fd(fd), notification_fd(-1), fast_path(nullptr) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, int64_t system_memory, std::string directory,
-                         bool hugepages_enabled)
-    : loop_(loop), eviction_policy_(&store_info_) {
+                         bool hugepages_enabled,
+                         std::shared_ptr<ExternalStore> external_store)
+    : loop_(loop),
+      eviction_policy_(&store_info_),
+      external_store_(std::move(external_store)) {
   store_info_.memory_capacity = system_memory;
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
+  loop_->SetPollCallbacks([this](bool idle) { BeforePoll(idle); },
+                          [this]() { WakeUp(); });
 #ifdef PLASMA_GPU
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  // The spilled objects can't be restored by another store.
+  if (!spilled_objects_.empty()) {
+    std::vector<ObjectID> object_ids;
+    for (const auto& spilled : spilled_objects_) {
+      object_ids.push_back(spilled.first);
+    }
+    Status s = external_store_->Delete(object_ids);
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to remove the spilled objects: " << s;
+    }
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
@@ -141,7 +161,7 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
     // Tell the eviction policy that this object is being used.
     std::vector<ObjectID> objects_to_evict;
     eviction_policy_.BeginObjectAccess(object_id, &objects_to_evict);
-    DeleteObjects(objects_to_evict);
+    EvictObjects(objects_to_evict);
   }
   // Increase reference count.
   entry->ref_count++;
@@ -150,12 +170,36 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
   client->object_ids.insert(object_id);
 }
 
+uint8_t* PlasmaStore::AllocateMemory(int64_t size) {
+  while (true) {
+    // Allocate space for the new object. We use dlmemalign instead of dlmalloc
+    // in order to align the allocated region to a 64-byte boundary. This is not
+    // strictly necessary, but it is an optimization that could speed up the
+    // computation of a hash of the data (see compute_object_hash_parallel in
+    // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
+    // it is not guaranteed that the corresponding pointer in the client will be
+    // 64-byte aligned, but in practice it often will be.
+    uint8_t* pointer = reinterpret_cast<uint8_t*>(dlmemalign(kBlockSize, size));
+    if (pointer != nullptr) {
+      return pointer;
+    }
+    // Tell the eviction policy how much space we need to create this object.
+    std::vector<ObjectID> objects_to_evict;
+    bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
+    EvictObjects(objects_to_evict);
+    if (!success) {
+      return nullptr;
+    }
+  }
+}
+
 // Create a new object buffer in the hash table.
 PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_size,
                                       int64_t metadata_size, int device_num,
                                       Client* client, PlasmaObject* result) {
   ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
-  if (store_info_.objects.count(object_id) != 0) {
+  if (store_info_.objects.count(object_id) != 0 ||
+      spilled_objects_.count(object_id) != 0) {
     // There is already an object with the same ID in the Plasma Store, so
     // ignore this requst.
     return PlasmaError::ObjectExists;
@@ -169,37 +213,17 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
     DCHECK_OK(manager_->GetContext(device_num - 1, &context_));
   }
 #endif
-  while (true) {
-    // Allocate space for the new object. We use dlmemalign instead of dlmalloc
-    // in order to align the allocated region to a 64-byte boundary. This is not
-    // strictly necessary, but it is an optimization that could speed up the
-    // computation of a hash of the data (see compute_object_hash_parallel in
-    // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
-    // it is not guaranteed that the corresponding pointer in the client will be
-    // 64-byte aligned, but in practice it often will be.
-    if (device_num == 0) {
-      pointer =
-          reinterpret_cast<uint8_t*>(dlmemalign(kBlockSize, data_size + metadata_size));
-      if (pointer == nullptr) {
-        // Tell the eviction policy how much space we need to create this object.
-        std::vector<ObjectID> objects_to_evict;
-        bool success =
-            eviction_policy_.RequireSpace(data_size + metadata_size, &objects_to_evict);
-        DeleteObjects(objects_to_evict);
-        // Return an error to the client if not enough space could be freed to
-        // create the object.
-        if (!success) {
-          return PlasmaError::OutOfMemory;
-        }
-      } else {
-        break;
-      }
-    } else {
+  if (device_num == 0) {
+    pointer = AllocateMemory(data_size + metadata_size);
+    // Return an error to the client if not enough space could be freed to
+    // create the object.
+    if (pointer == nullptr) {
+      return PlasmaError::OutOfMemory;
+    }
+  } else {
 #ifdef PLASMA_GPU
-      DCHECK_OK(context_->Allocate(data_size + metadata_size, &gpu_handle));
-      break;
+    DCHECK_OK(context_->Allocate(data_size + metadata_size, &gpu_handle));
 #endif
-    }
   }
   int fd = -1;
   int64_t map_size = 0;
@@ -242,6 +266,43 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
   return PlasmaError::OK;
 }
 
+PlasmaError PlasmaStore::CreateObjects(const std::vector<ObjectID>& object_ids,
+                                       const std::vector<int64_t>& data_sizes,
+                                       const std::vector<int64_t>& metadata_sizes,
+                                       Client* client,
+                                       std::vector<PlasmaObject>* results) {
+  // Check the IDs before allocating anything.
+  std::unordered_set<ObjectID> unique_ids;
+  for (const auto& object_id : object_ids) {
+    if (!unique_ids.insert(object_id).second ||
+        store_info_.objects.count(object_id) != 0 ||
+        spilled_objects_.count(object_id) != 0) {
+      return PlasmaError::ObjectExists;
+    }
+  }
+  results->resize(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    memset(&(*results)[i], 0, sizeof(PlasmaObject));
+    PlasmaError error = CreateObject(object_ids[i], data_sizes[i], metadata_sizes[i], 0,
+                                     client, &(*results)[i]);
+    if (error != PlasmaError::OK) {
+      // Free the objects of the batch which were created. They are in use by the
+      // client, so put them back in the LRU cache to remove them from the
+      // eviction policy.
+      for (size_t j = 0; j < i; ++j) {
+        std::vector<ObjectID> objects_to_evict;
+        eviction_policy_.EndObjectAccess(object_ids[j], &objects_to_evict);
+        eviction_policy_.RemoveObject(object_ids[j]);
+        client->object_ids.erase(object_ids[j]);
+        store_info_.objects.erase(object_ids[j]);
+      }
+      results->clear();
+      return error;
+    }
+  }
+  return PlasmaError::OK;
+}
+
 void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry) {
   DCHECK(object != nullptr);
   DCHECK(entry != nullptr);
@@ -406,6 +467,9 @@ void PlasmaStore::ProcessGetRequest(Client* client,
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
     auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry == nullptr && spilled_objects_.count(object_id) != 0) {
+      entry = RestoreSpilledObject(object_id);
+    }
     if (entry && entry->state == ObjectState::PLASMA_SEALED) {
       // Update the get request to take into account the present object.
       PlasmaObject_init(&get_req->objects[object_id], entry);
@@ -452,7 +516,7 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
         // Tell the eviction policy that this object is no longer being used.
         std::vector<ObjectID> objects_to_evict;
         eviction_policy_.EndObjectAccess(object_id, &objects_to_evict);
-        DeleteObjects(objects_to_evict);
+        EvictObjects(objects_to_evict);
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
@@ -475,8 +539,101 @@ void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
   ARROW_CHECK(RemoveFromClientObjectIds(object_id, entry, client) == 1);
 }
 
+Status PlasmaStore::SetUpFastPath(Client* client) {
+  if (client->fast_path == nullptr) {
+    // We don't evict objects to make room for the channel: if the store is
+    // full, the client only uses the socket.
+    void* pointer = dlmemalign(kBlockSize, sizeof(FastPathChannel));
+    if (pointer != nullptr) {
+      client->fast_path = new (pointer) FastPathChannel();
+      client->fast_path->Init();
+      fast_path_clients_.insert(client);
+    }
+  }
+  if (client->fast_path == nullptr) {
+    HANDLE_SIGPIPE(SendFastPathReply(client->fd, PlasmaError::OutOfMemory, -1, 0, 0),
+                   client->fd);
+    return Status::OK();
+  }
+  int fd = -1;
+  int64_t map_size = 0;
+  ptrdiff_t offset = 0;
+  GetMallocMapinfo(client->fast_path, &fd, &map_size, &offset);
+  HANDLE_SIGPIPE(
+      SendFastPathReply(client->fd, PlasmaError::OK, fd, offset, GetMmapSize(fd)),
+      client->fd);
+  WarnIfSigpipe(send_fd(client->fd, fd), client->fd);
+  return Status::OK();
+}
+
+void PlasmaStore::ProcessFastPathRequests(Client* client) {
+  FastPathChannel* channel = client->fast_path;
+  // The indices are written by the client, so don't trust them blindly.
+  if (!channel->requests.IsValid() || !channel->responses.IsValid()) {
+    ARROW_LOG(ERROR) << "Resetting the corrupted fast path channel of client on fd "
+                     << client->fd;
+    channel->Init();
+    return;
+  }
+  const FastPathRequest* front;
+  while ((front = channel->requests.Front()) != nullptr) {
+    FastPathRequest request = *front;
+    if (request.type == FastPathRequestType::Get) {
+      // The client never has more Get requests in flight than the capacity of
+      // the response ring, but stop here rather than drop a response.
+      if (channel->responses.IsFull()) {
+        break;
+      }
+      FastPathResponse response;
+      memset(&response, 0, sizeof(response));
+      response.object_id = request.object_id;
+      // Only sealed objects are served, since waiting for an object to be sealed
+      // is done over the socket. GPU objects need an IPC handle.
+      auto entry = GetObjectTableEntry(&store_info_, request.object_id);
+      if (entry && entry->state == ObjectState::PLASMA_SEALED && entry->device_num == 0) {
+        AddToClientObjectIds(request.object_id, entry, client);
+        response.found = 1;
+        response.store_fd = entry->fd;
+        response.data_offset = entry->offset;
+        response.data_size = entry->data_size;
+        response.metadata_size = entry->metadata_size;
+      }
+      channel->responses.Push(response);
+    } else if (request.type == FastPathRequestType::Release) {
+      ReleaseObject(request.object_id, client);
+    } else {
+      ARROW_LOG(ERROR) << "Ignoring fast path request of unknown type "
+                       << static_cast<int32_t>(request.type) << " from client on fd "
+                       << client->fd;
+    }
+    channel->requests.Pop();
+  }
+}
+
+void PlasmaStore::BeforePoll(bool idle) {
+  for (Client* client : fast_path_clients_) {
+    if (idle) {
+      // Setting the flag before draining the channel guarantees that a request
+      // pushed after the last check is followed by a doorbell.
+      client->fast_path->store_sleeping.store(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+    ProcessFastPathRequests(client);
+  }
+}
+
+void PlasmaStore::WakeUp() {
+  for (Client* client : fast_path_clients_) {
+    client->fast_path->store_sleeping.store(0, std::memory_order_relaxed);
+  }
+}
+
 // Check if an object is present.
 ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
+  if (spilled_objects_.count(object_id) != 0) {
+    // Spilled objects are restored when they are gotten.
+    return ObjectStatus::OBJECT_FOUND;
+  }
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   return entry && (entry->state == ObjectState::PLASMA_SEALED)
              ? ObjectStatus::OBJECT_FOUND
@@ -530,8 +687,23 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
   // error. Maybe we should also support deleting objects that have been
   // created but not sealed.
   if (entry == nullptr) {
-    // To delete an object it must be in the object table.
-    return PlasmaError::ObjectNonexistent;
+    auto it = spilled_objects_.find(object_id);
+    if (it == spilled_objects_.end()) {
+      // To delete an object it must be in the object table.
+      return PlasmaError::ObjectNonexistent;
+    }
+    spilled_objects_.erase(it);
+    Status s = external_store_->Delete({object_id});
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to remove spilled object " << object_id.hex() << ": "
+                         << s;
+    }
+    // Inform all subscribers that the object has been deleted.
+    fb::ObjectInfoT notification;
+    notification.object_id = object_id.binary();
+    notification.is_deletion = true;
+    PushNotification(&notification);
+    return PlasmaError::OK;
   }
 
   if (entry->state != ObjectState::PLASMA_SEALED) {
@@ -582,6 +754,105 @@ void PlasmaStore::DeleteObjects(const std::vector<ObjectID>& object_ids) {
   }
 }
 
+void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
+  if (external_store_ == nullptr || object_ids.empty()) {
+    DeleteObjects(object_ids);
+    return;
+  }
+  std::vector<ObjectID> objects_to_spill;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  std::vector<ObjectID> objects_to_delete;
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    ARROW_CHECK(entry != nullptr) << "To evict an object it must be in the object table.";
+    ARROW_CHECK(entry->state == ObjectState::PLASMA_SEALED)
+        << "To evict an object it must have been sealed.";
+    ARROW_CHECK(entry->ref_count == 0)
+        << "To evict an object, there must be no clients currently using it.";
+    if (entry->device_num == 0) {
+      objects_to_spill.push_back(object_id);
+      buffers.push_back(std::make_shared<Buffer>(
+          entry->pointer, entry->data_size + entry->metadata_size));
+    } else {
+      // Objects on GPUs are not spilled.
+      objects_to_delete.push_back(object_id);
+    }
+  }
+  // Write the whole batch at once, so that the external store can write the
+  // objects concurrently.
+  if (!objects_to_spill.empty()) {
+    Status s = external_store_->Put(objects_to_spill, buffers);
+    if (!s.ok()) {
+      ARROW_LOG(WARNING) << "Failed to spill " << objects_to_spill.size()
+                         << " objects, deleting them instead: " << s;
+      objects_to_delete.insert(objects_to_delete.end(), objects_to_spill.begin(),
+                               objects_to_spill.end());
+      objects_to_spill.clear();
+    }
+  }
+  for (const auto& object_id : objects_to_spill) {
+    ARROW_LOG(DEBUG) << "spilling object " << object_id.hex();
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    SpilledObject& spilled = spilled_objects_[object_id];
+    spilled.data_size = entry->data_size;
+    spilled.metadata_size = entry->metadata_size;
+    spilled.create_time = entry->create_time;
+    spilled.construct_duration = entry->construct_duration;
+    std::memcpy(&spilled.digest[0], &entry->digest[0], kDigestSize);
+    // The object can still be gotten, so the subscribers are not notified.
+    store_info_.objects.erase(object_id);
+  }
+  DeleteObjects(objects_to_delete);
+}
+
+ObjectTableEntry* PlasmaStore::RestoreSpilledObject(const ObjectID& object_id) {
+  ARROW_LOG(DEBUG) << "restoring object " << object_id.hex();
+  // Copy the information, since making room for the object may spill others.
+  const SpilledObject spilled = spilled_objects_[object_id];
+  int64_t size = spilled.data_size + spilled.metadata_size;
+  uint8_t* pointer = AllocateMemory(size);
+  if (pointer == nullptr) {
+    ARROW_LOG(WARNING) << "Not enough memory to restore spilled object "
+                       << object_id.hex();
+    return nullptr;
+  }
+  Status s = external_store_->Get(object_id, size, pointer);
+  if (!s.ok()) {
+    // The object is lost.
+    ARROW_LOG(ERROR) << "Failed to restore spilled object " << object_id.hex() << ": "
+                     << s;
+    dlfree(pointer);
+    spilled_objects_.erase(object_id);
+    fb::ObjectInfoT notification;
+    notification.object_id = object_id.binary();
+    notification.is_deletion = true;
+    PushNotification(&notification);
+    return nullptr;
+  }
+  spilled_objects_.erase(object_id);
+  s = external_store_->Delete({object_id});
+  if (!s.ok()) {
+    ARROW_LOG(WARNING) << "Failed to remove spilled object " << object_id.hex() << ": "
+                       << s;
+  }
+
+  auto entry = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
+  entry->data_size = spilled.data_size;
+  entry->metadata_size = spilled.metadata_size;
+  entry->pointer = pointer;
+  GetMallocMapinfo(pointer, &entry->fd, &entry->map_size, &entry->offset);
+  assert(entry->fd != -1);
+  entry->state = ObjectState::PLASMA_SEALED;
+  entry->device_num = 0;
+  entry->create_time = spilled.create_time;
+  entry->construct_duration = spilled.construct_duration;
+  std::memcpy(&entry->digest[0], &spilled.digest[0], kDigestSize);
+  ObjectTableEntry* result = entry.get();
+  store_info_.objects[object_id] = std::move(entry);
+  eviction_policy_.ObjectCreated(object_id);
+  return result;
+}
+
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
@@ -645,6 +916,13 @@ void PlasmaStore::DisconnectClient(int client_fd) {
     client->notification_fd = -1;
   }
 
+  if (client->fast_path != nullptr) {
+    // The requests of the channel were processed before the disconnection.
+    fast_path_clients_.erase(client);
+    dlfree(client->fast_path);
+    client->fast_path = nullptr;
+  }
+
   connected_clients_.erase(it);
 }
 
@@ -767,6 +1045,15 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
       PushNotification(&info, fd);
     }
   }
+  for (const auto& spilled : spilled_objects_) {
+    ObjectInfoT info;
+    info.object_id = spilled.first.binary();
+    info.data_size = spilled.second.data_size;
+    info.metadata_size = spilled.second.metadata_size;
+    info.digest = std::string(
+        reinterpret_cast<const char*>(&spilled.second.digest[0]), kDigestSize);
+    PushNotification(&info, fd);
+  }
 }
 
 Status PlasmaStore::ProcessMessage(Client* client) {
@@ -774,6 +1061,12 @@ Status PlasmaStore::ProcessMessage(Client* client) {
   Status s = ReadMessage(client->fd, &type, &input_buffer_);
   ARROW_CHECK(s.ok() || s.IsIOError());
 
+  // Process the requests that were pushed to the fast path channels before
+  // this message was sent, by this client and by the others.
+  for (Client* fast_path_client : fast_path_clients_) {
+    ProcessFastPathRequests(fast_path_client);
+  }
+
   uint8_t* input = input_buffer_.data();
   size_t input_size = input_buffer_.size();
   ObjectID object_id;
@@ -802,6 +1095,32 @@ Status PlasmaStore::ProcessMessage(Client* client) {
         WarnIfSigpipe(send_fd(client->fd, object.store_fd), client->fd);
       }
     } break;
+    case fb::MessageType::PlasmaCreateBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<int64_t> data_sizes;
+      std::vector<int64_t> metadata_sizes;
+      RETURN_NOT_OK(ReadCreateBatchRequest(input, input_size, &object_ids, &data_sizes,
+                                           &metadata_sizes));
+      std::vector<PlasmaObject> objects;
+      PlasmaError error_code =
+          CreateObjects(object_ids, data_sizes, metadata_sizes, client, &objects);
+      // Send each memory mapped file only once.
+      std::vector<int> store_fds;
+      std::vector<int64_t> mmap_sizes;
+      for (const auto& created_object : objects) {
+        int fd = created_object.store_fd;
+        if (std::find(store_fds.begin(), store_fds.end(), fd) == store_fds.end()) {
+          store_fds.push_back(fd);
+          mmap_sizes.push_back(GetMmapSize(fd));
+        }
+      }
+      HANDLE_SIGPIPE(
+          SendCreateBatchReply(client->fd, error_code, objects, store_fds, mmap_sizes),
+          client->fd);
+      for (int store_fd : store_fds) {
+        WarnIfSigpipe(send_fd(client->fd, store_fd), client->fd);
+      }
+    } break;
     case fb::MessageType::PlasmaAbortRequest: {
       RETURN_NOT_OK(ReadAbortRequest(input, input_size, &object_id));
       ARROW_CHECK(AbortObject(object_id, client) == 1) << "To abort an object, the only "
@@ -846,6 +1165,14 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest[0]));
       SealObject(object_id, &digest[0]);
     } break;
+    case fb::MessageType::PlasmaSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<uint8_t> digests;
+      RETURN_NOT_OK(ReadSealBatchRequest(input, input_size, &object_ids, &digests));
+      for (size_t i = 0; i < object_ids.size(); ++i) {
+        SealObject(object_ids[i], &digests[i * kDigestSize]);
+      }
+    } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
@@ -853,7 +1180,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       std::vector<ObjectID> objects_to_evict;
       int64_t num_bytes_evicted =
           eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
-      DeleteObjects(objects_to_evict);
+      EvictObjects(objects_to_evict);
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case fb::MessageType::PlasmaSubscribeRequest:
@@ -863,6 +1190,12 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       HANDLE_SIGPIPE(SendConnectReply(client->fd, store_info_.memory_capacity),
                      client->fd);
     } break;
+    case fb::MessageType::PlasmaFastPathRequest:
+      RETURN_NOT_OK(SetUpFastPath(client));
+      break;
+    case fb::MessageType::PlasmaFastPathDoorbell:
+      // The channel was processed above.
+      break;
     case fb::MessageType::PlasmaDisconnectClient:
       ARROW_LOG(DEBUG) << "Disconnecting client on fd " << client->fd;
       DisconnectClient(client->fd);
@@ -874,16 +1207,25 @@ Status PlasmaStore::ProcessMessage(Client* client) {
   return Status::OK();
 }
 
+// The number of threads writing the evicted objects to the spill directory.
+constexpr int kNumSpillThreads = 8;
+
 class PlasmaStoreRunner {
  public:
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, int64_t system_memory, std::string directory,
-             bool hugepages_enabled, bool use_one_memory_mapped_file) {
+             bool hugepages_enabled, bool use_one_memory_mapped_file,
+             std::string spill_directory) {
     // Create the event loop.
     loop_.reset(new EventLoop);
-    store_.reset(
-        new PlasmaStore(loop_.get(), system_memory, directory, hugepages_enabled));
+    std::shared_ptr<ExternalStore> external_store;
+    if (!spill_directory.empty()) {
+      ARROW_CHECK_OK(LocalFileExternalStore::Make(spill_directory, kNumSpillThreads,
+                                                  &external_store));
+    }
+    store_.reset(new PlasmaStore(loop_.get(), system_memory, directory,
+                                 hugepages_enabled, external_store));
     plasma_config = store_->GetPlasmaStoreInfo();
 
     // If the store is configured to use a single memory-mapped file, then we
@@ -929,7 +1271,8 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, int64_t system_memory, std::string plasma_directory,
-                 bool hugepages_enabled, bool use_one_memory_mapped_file) {
+                 bool hugepages_enabled, bool use_one_memory_mapped_file,
+                 std::string spill_directory) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
@@ -937,7 +1280,7 @@ void StartServer(char* socket_name, int64_t system_memory, std::string plasma_di
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
   g_runner->Start(socket_name, system_memory, plasma_directory, hugepages_enabled,
-                  use_one_memory_mapped_file);
+                  use_one_memory_mapped_file, spill_directory);
 }
 
 }  // namespace plasma
@@ -951,13 +1294,18 @@ int main(int argc, char* argv[]) {
   bool hugepages_enabled = false;
   // True if a single large memory-mapped file should be created at startup.
   bool use_one_memory_mapped_file = false;
+  // Directory where evicted objects are spilled. If empty, they are deleted.
+  std::string spill_directory;
   int64_t system_memory = -1;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:hf")) != -1) {
+  while ((c = getopt(argc, argv, "s:m:d:hfe:")) != -1) {
     switch (c) {
       case 'd':
         plasma_directory = std::string(optarg);
         break;
+      case 'e':
+        spill_directory = std::string(optarg);
+        break;
       case 'h':
         hugepages_enabled = true;
         break;
@@ -1001,6 +1349,9 @@ int main(int argc, char* argv[]) {
   ARROW_LOG(INFO) << "Starting object store with directory " << plasma_directory
                   << " and huge page support "
                   << (hugepages_enabled ? "enabled" : "disabled");
+  if (!spill_directory.empty()) {
+    ARROW_LOG(INFO) << "Spilling evicted objects to " << spill_directory;
+  }
 #ifdef __linux__
   if (!hugepages_enabled) {
     // On Linux, check that the amount of memory available in /dev/shm is large
@@ -1030,7 +1381,7 @@ int main(int argc, char* argv[]) {
   plasma::dlmalloc_set_footprint_limit((size_t)system_memory);
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
   plasma::StartServer(socket_name, system_memory, plasma_directory, hugepages_enabled,
-                      use_one_memory_mapped_file);
+                      use_one_memory_mapped_file, spill_directory);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -28,6 +28,8 @@
 #include "plasma/common.h"
 #include "plasma/events.h"
 #include "plasma/eviction_policy.h"
+#include "plasma/external_store.h"
+#include "plasma/fast_path.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 
@@ -57,6 +59,10 @@ struct Client {
   /// The file descriptor used to push notifications to client. This is only valid
   /// if client subscribes to plasma store. -1 indicates invalid.
   int notification_fd;
+
+  /// The shared-memory channel of the client, allocated in the dlmalloc arena.
+  /// nullptr if the client only uses the socket.
+  FastPathChannel* fast_path;
 };
 
 class PlasmaStore {
@@ -65,7 +71,8 @@ class PlasmaStore {
 
   // TODO: PascalCase PlasmaStore methods.
   PlasmaStore(EventLoop* loop, int64_t system_memory, std::string directory,
-              bool hugetlbfs_enabled);
+              bool hugetlbfs_enabled,
+              std::shared_ptr<ExternalStore> external_store = nullptr);
 
   ~PlasmaStore();
 
@@ -97,6 +104,20 @@ class PlasmaStore {
                            int64_t metadata_size, int device_num, Client* client,
                            PlasmaObject* result);
 
+  /// Create several objects on the host. Either all of the objects are created,
+  /// or none of them is.
+  ///
+  /// @param object_ids Object IDs of the objects to be created.
+  /// @param data_sizes Sizes in bytes of the data of the objects.
+  /// @param metadata_sizes Sizes in bytes of the metadata of the objects.
+  /// @param client The client that created the objects.
+  /// @param results The objects that have been created.
+  /// @return One of the error codes of CreateObject.
+  PlasmaError CreateObjects(const std::vector<ObjectID>& object_ids,
+                            const std::vector<int64_t>& data_sizes,
+                            const std::vector<int64_t>& metadata_sizes, Client* client,
+                            std::vector<PlasmaObject>* results);
+
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
   ///
@@ -121,6 +142,13 @@ class PlasmaStore {
   /// @param object_ids Object IDs of the objects to be deleted.
   void DeleteObjects(const std::vector<ObjectID>& object_ids);
 
+  /// Evict objects returned by the eviction policy. If the store has an
+  /// external store, the objects are written to it in one batch and restored
+  /// when they are gotten again, otherwise they are deleted.
+  ///
+  /// @param object_ids Object IDs of the objects to be evicted.
+  void EvictObjects(const std::vector<ObjectID>& object_ids);
+
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
   /// been sealed, the client that requested the object will be notified when it
@@ -171,6 +199,19 @@ class PlasmaStore {
   /// @param client_fd The client file descriptor that is disconnected.
   void DisconnectClient(int client_fd);
 
+  /// Allocate the shared-memory fast path channel of a client and send its
+  /// location to the client.
+  ///
+  /// @param client The client making this request.
+  Status SetUpFastPath(Client* client);
+
+  /// Process the requests queued in the fast path channel of a client, in
+  /// order. This must happen before processing any message received on a
+  /// socket, so that the requests are processed in the order they were made.
+  ///
+  /// @param client The client whose requests are processed.
+  void ProcessFastPathRequests(Client* client);
+
   NotificationMap::iterator SendNotifications(NotificationMap::iterator it);
 
   Status ProcessMessage(Client* client);
@@ -183,6 +224,20 @@ class PlasmaStore {
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
 
+  /// Allocate memory for an object on the host, evicting objects until there
+  /// is enough space.
+  ///
+  /// @param size The size of the object, i.e. of its data and metadata.
+  /// @return The allocated memory, or nullptr if the store is out of memory.
+  uint8_t* AllocateMemory(int64_t size);
+
+  /// Bring an evicted object back from the external store as a sealed object.
+  ///
+  /// @param object_id Object ID of the spilled object.
+  /// @return The entry of the restored object, or nullptr if it could not be
+  ///         restored.
+  ObjectTableEntry* RestoreSpilledObject(const ObjectID& object_id);
+
   /// Remove a GetRequest and clean up the relevant data structures.
   ///
   /// @param get_request The GetRequest to remove.
@@ -200,6 +255,16 @@ class PlasmaStore {
   int RemoveFromClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                                 Client* client);
 
+  /// Process the fast path requests of all clients. If the event loop is about
+  /// to block, ask the clients to ring the doorbell after their next requests.
+  ///
+  /// @param idle Whether the event loop will block after this call.
+  void BeforePoll(bool idle);
+
+  /// Tell the clients that they don't need to ring the doorbell anymore, since
+  /// their requests will be processed on the next iteration of the event loop.
+  void WakeUp();
+
   /// Event loop of the plasma store.
   EventLoop* loop_;
   /// The plasma store information, including the object tables, that is exposed
@@ -222,7 +287,25 @@ class PlasmaStore {
 
   std::unordered_map<int, std::unique_ptr<Client>> connected_clients_;
 
+  /// The clients which have a fast path channel.
+  std::unordered_set<Client*> fast_path_clients_;
+
   std::unordered_set<ObjectID> deletion_cache_;
+
+  /// Where the evicted objects are written, or nullptr if they are deleted.
+  std::shared_ptr<ExternalStore> external_store_;
+
+  /// The information needed to restore a sealed object from the external store.
+  struct SpilledObject {
+    int64_t data_size;
+    int64_t metadata_size;
+    int64_t create_time;
+    int64_t construct_duration;
+    unsigned char digest[kDigestSize];
+  };
+
+  /// The objects which were evicted to the external store.
+  std::unordered_map<ObjectID, SpilledObject> spilled_objects_;
 #ifdef PLASMA_GPU
   arrow::gpu::CudaDeviceManager* manager_;
 #endif
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Latency of creating, sealing, getting and releasing small objects, which is
+// dominated by the communication with the store rather than by the object
+// sizes.
+
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/util/logging.h"
+
+#include "plasma/client.h"
+#include "plasma/common.h"
+#include "plasma/test-util.h"
+
+namespace plasma {
+
+using Clock = std::chrono::steady_clock;
+
+// Set by the build to the path of the plasma_store_server executable
+#ifndef PLASMA_STORE_SERVER_PATH
+#define PLASMA_STORE_SERVER_PATH "plasma_store_server"
+#endif
+
+class PlasmaStoreFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State& state) override {
+    store_socket_name_ = "/tmp/plasma_benchmark_" + std::to_string(getpid());
+    store_pid_ = fork();
+    ARROW_CHECK(store_pid_ >= 0);
+    if (store_pid_ == 0) {
+      execl(PLASMA_STORE_SERVER_PATH, PLASMA_STORE_SERVER_PATH, "-m", "1000000000", "-s",
+            store_socket_name_.c_str(), nullptr);
+      _exit(1);
+    }
+    client_.reset(new PlasmaClient());
+    // Release objects right away, so that every release reaches the store.
+    ARROW_CHECK_OK(client_->Connect(store_socket_name_, "", 0));
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    ARROW_CHECK_OK(client_->Disconnect());
+    client_.reset();
+    kill(store_pid_, SIGKILL);
+    waitpid(store_pid_, nullptr, 0);
+  }
+
+ protected:
+  // Create and seal objects of the given size, released by this client. The
+  // client has no release delay, so the store sees the releases right away.
+  std::vector<ObjectID> CreateObjects(int64_t num_objects, int64_t data_size) {
+    std::vector<ObjectID> object_ids;
+    for (int64_t i = 0; i < num_objects; ++i) {
+      ObjectID object_id = random_object_id();
+      std::shared_ptr<Buffer> data;
+      ARROW_CHECK_OK(client_->Create(object_id, data_size, nullptr, 0, &data));
+      std::fill(data->mutable_data(), data->mutable_data() + data_size, 42);
+      ARROW_CHECK_OK(client_->Seal(object_id));
+      ARROW_CHECK_OK(client_->Release(object_id));
+      object_ids.push_back(object_id);
+    }
+    return object_ids;
+  }
+
+  std::string store_socket_name_;
+  pid_t store_pid_;
+  std::unique_ptr<PlasmaClient> client_;
+};
+
+// Report percentiles of the latencies of one operation, in microseconds
+static void ReportLatencies(const std::string& name, std::vector<double> latencies,
+                            benchmark::State* state) {
+  if (latencies.empty()) {
+    return;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    return latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))];
+  };
+  state->counters[name + "_p50_us"] = percentile(0.5);
+  state->counters[name + "_p90_us"] = percentile(0.9);
+  state->counters[name + "_p99_us"] = percentile(0.99);
+  state->counters[name + "_max_us"] = latencies.back();
+}
+
+static double MicrosecondsSince(Clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// Get a batch of objects which are sealed but not in use by the client, then
+// release them
+BENCHMARK_DEFINE_F(PlasmaStoreFixture, GetRelease)(benchmark::State& state) {
+  const int64_t batch_size = state.range(0);
+  const std::vector<ObjectID> object_ids = CreateObjects(batch_size, 64);
+
+  std::vector<double> get_latencies;
+  std::vector<double> release_latencies;
+  for (auto _ : state) {
+    std::vector<ObjectBuffer> object_buffers;
+    Clock::time_point start = Clock::now();
+    ARROW_CHECK_OK(client_->Get(object_ids, -1, &object_buffers));
+    get_latencies.push_back(MicrosecondsSince(start));
+    ARROW_CHECK(object_buffers.back().data);
+
+    start = Clock::now();
+    object_buffers.clear();
+    release_latencies.push_back(MicrosecondsSince(start));
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+  ReportLatencies("get", std::move(get_latencies), &state);
+  ReportLatencies("release", std::move(release_latencies), &state);
+}
+
+BENCHMARK_REGISTER_F(PlasmaStoreFixture, GetRelease)
+    ->RangeMultiplier(16)
+    ->Range(1, 256)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+// Get objects which are not sealed yet with a zero timeout, which always needs
+// the socket
+BENCHMARK_DEFINE_F(PlasmaStoreFixture, GetMissing)(benchmark::State& state) {
+  const ObjectID object_id = random_object_id();
+
+  std::vector<double> latencies;
+  for (auto _ : state) {
+    std::vector<ObjectBuffer> object_buffers;
+    Clock::time_point start = Clock::now();
+    ARROW_CHECK_OK(client_->Get({object_id}, 0, &object_buffers));
+    latencies.push_back(MicrosecondsSince(start));
+    ARROW_CHECK(!object_buffers.front().data);
+  }
+  state.SetItemsProcessed(state.iterations());
+  ReportLatencies("get", std::move(latencies), &state);
+}
+
+BENCHMARK_REGISTER_F(PlasmaStoreFixture, GetMissing)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+// Create, seal and release small objects one at a time
+BENCHMARK_DEFINE_F(PlasmaStoreFixture, CreateSeal)(benchmark::State& state) {
+  const int64_t num_objects = state.range(0);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < num_objects; ++i) {
+      ObjectID object_id = random_object_id();
+      std::shared_ptr<Buffer> data;
+      ARROW_CHECK_OK(client_->Create(object_id, 1024, nullptr, 0, &data));
+      ARROW_CHECK_OK(client_->Seal(object_id));
+      ARROW_CHECK_OK(client_->Release(object_id));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_objects);
+}
+
+BENCHMARK_REGISTER_F(PlasmaStoreFixture, CreateSeal)
+    ->Arg(256)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+// Create, seal and release small objects in batches of the given size
+BENCHMARK_DEFINE_F(PlasmaStoreFixture, CreateSealBatch)(benchmark::State& state) {
+  const int64_t batch_size = state.range(0);
+  const std::vector<int64_t> data_sizes(batch_size, 1024);
+  const std::vector<std::string> metadata(batch_size);
+  for (auto _ : state) {
+    std::vector<ObjectID> object_ids;
+    for (int64_t i = 0; i < batch_size; ++i) {
+      object_ids.push_back(random_object_id());
+    }
+    std::vector<std::shared_ptr<Buffer>> data;
+    ARROW_CHECK_OK(client_->CreateBatch(object_ids, data_sizes, metadata, &data));
+    ARROW_CHECK_OK(client_->SealBatch(object_ids));
+    for (const auto& object_id : object_ids) {
+      ARROW_CHECK_OK(client_->Release(object_id));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+BENCHMARK_REGISTER_F(PlasmaStoreFixture, CreateSealBatch)
+    ->RangeMultiplier(16)
+    ->Range(16, 4096)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace plasma
@@ -61,7 +61,8 @@ class TestPlasmaStore : public ::testing::Test {
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command = plasma_directory +
                                  "/plasma_store_server -m 1000000000 -s " +
-                                 store_socket_name_ + " 1> /dev/null 2> /dev/null &";
+                                 store_socket_name_ + ExtraStoreArguments() +
+                                 " 1> /dev/null 2> /dev/null &";
     system(plasma_command.c_str());
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -96,6 +97,8 @@ class TestPlasmaStore : public ::testing::Test {
   const std::string& GetStoreSocketName() const { return store_socket_name_; }
 
  protected:
+  virtual std::string ExtraStoreArguments() const { return ""; }
+
   PlasmaClient client_;
   PlasmaClient client2_;
   std::string store_socket_name_;
@@ -351,6 +354,87 @@ TEST_F(TestPlasmaStore, MultipleGetTest) {
   ASSERT_EQ(object_buffers[1].data->data()[0], 2);
 }
 
+TEST_F(TestPlasmaStore, ManyGetReleaseTest) {
+  // More objects than the shared-memory channel of a client holds at once.
+  const int num_objects = 600;
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < num_objects; i++) {
+    ObjectID object_id = random_object_id();
+    CreateObject(client2_, object_id, {static_cast<uint8_t>(i % 7)},
+                 {static_cast<uint8_t>(i % 251)});
+    object_ids.push_back(object_id);
+  }
+  ARROW_CHECK_OK(client2_.FlushReleaseHistory());
+
+  // The same object may be requested several times.
+  std::vector<ObjectID> requested_ids = object_ids;
+  requested_ids.push_back(object_ids[0]);
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(requested_ids, 0, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), num_objects + 1);
+  for (int i = 0; i < num_objects; i++) {
+    AssertObjectBufferEqual(object_buffers[i], {static_cast<uint8_t>(i % 7)},
+                            {static_cast<uint8_t>(i % 251)});
+  }
+  AssertObjectBufferEqual(object_buffers[num_objects], {0}, {0});
+
+  // The releases reach the store before the deletion requested afterwards, so
+  // the objects are deleted right away.
+  object_buffers.clear();
+  ARROW_CHECK_OK(client_.FlushReleaseHistory());
+  ARROW_CHECK_OK(client_.Delete(object_ids));
+  for (const auto& object_id : object_ids) {
+    EXPECT_FALSE(client_.IsInUse(object_id));
+    bool has_object;
+    ARROW_CHECK_OK(client2_.Contains(object_id, &has_object));
+    ASSERT_FALSE(has_object);
+  }
+}
+
+TEST_F(TestPlasmaStore, BatchCreateSealTest) {
+  // Enough small objects to be hashed concurrently, and a large one.
+  const int num_objects = 200;
+  std::vector<ObjectID> object_ids;
+  std::vector<int64_t> data_sizes;
+  std::vector<std::string> metadata;
+  for (int i = 0; i < num_objects; i++) {
+    object_ids.push_back(random_object_id());
+    data_sizes.push_back(i == 0 ? 3 << 20 : 10000 + i);
+    metadata.push_back(std::string(i % 3, static_cast<char>(i)));
+  }
+  std::vector<std::shared_ptr<Buffer>> data;
+  ARROW_CHECK_OK(client_.CreateBatch(object_ids, data_sizes, metadata, &data));
+  ASSERT_EQ(data.size(), num_objects);
+  for (int i = 0; i < num_objects; i++) {
+    ASSERT_EQ(data[i]->size(), data_sizes[i]);
+    memset(data[i]->mutable_data(), i % 251, data_sizes[i]);
+  }
+  ARROW_CHECK_OK(client_.SealBatch(object_ids));
+  data.clear();
+  // An object can't be sealed twice.
+  ASSERT_TRUE(client_.SealBatch({object_ids[1]}).IsPlasmaObjectAlreadySealed());
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  for (int i = 0; i < num_objects; i++) {
+    const std::string& object_metadata = metadata[i];
+    AssertObjectBufferEqual(
+        object_buffers[i],
+        std::vector<uint8_t>(object_metadata.begin(), object_metadata.end()),
+        std::vector<uint8_t>(data_sizes[i], static_cast<uint8_t>(i % 251)));
+  }
+
+  // If one of the objects exists, none of the objects are created.
+  ObjectID object_id = random_object_id();
+  ASSERT_TRUE(client_.CreateBatch({object_id, object_ids[0]}, {10, 10}, {"", ""}, &data)
+                  .IsPlasmaObjectExists());
+  ASSERT_TRUE(client_.CreateBatch({object_id, object_id}, {10, 10}, {"", ""}, &data)
+                  .IsPlasmaObjectExists());
+  std::shared_ptr<Buffer> buffer;
+  ARROW_CHECK_OK(client_.Create(object_id, 10, nullptr, 0, &buffer));
+  ARROW_CHECK_OK(client_.Seal(object_id));
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -487,6 +571,59 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+class TestPlasmaStoreWithSpilling : public TestPlasmaStore {
+ public:
+  void TearDown() override {
+    TestPlasmaStore::TearDown();
+    // The store is killed, so it can't clean up the spill directory.
+    system(("rm -rf " + SpillDirectory()).c_str());
+  }
+
+ protected:
+  std::string ExtraStoreArguments() const override { return " -e " + SpillDirectory(); }
+
+  std::string SpillDirectory() const { return store_socket_name_ + "_spill"; }
+
+  bool IsSpilled(const ObjectID& object_id) const {
+    return access((SpillDirectory() + "/" + object_id.hex()).c_str(), F_OK) == 0;
+  }
+};
+
+TEST_F(TestPlasmaStoreWithSpilling, SpillTest) {
+  // Release the objects right away, so that the store can evict them.
+  PlasmaClient client;
+  ARROW_CHECK_OK(client.Connect(store_socket_name_, "", 0));
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  CreateObject(client, object_id1, {1}, std::vector<uint8_t>(1000, 42));
+  CreateObject(client, object_id2, {2}, std::vector<uint8_t>(2000, 43));
+
+  // The evicted objects are written to the spill directory and remain in the
+  // store.
+  int64_t num_bytes_evicted;
+  ARROW_CHECK_OK(client.Evict(3002, num_bytes_evicted));
+  ASSERT_EQ(num_bytes_evicted, 3002);
+  ASSERT_TRUE(IsSpilled(object_id1));
+  ASSERT_TRUE(IsSpilled(object_id2));
+  bool has_object;
+  ARROW_CHECK_OK(client2_.Contains(object_id1, &has_object));
+  ASSERT_TRUE(has_object);
+
+  // Getting a spilled object restores it.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({object_id1}, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 1);
+  AssertObjectBufferEqual(object_buffers[0], {1}, std::vector<uint8_t>(1000, 42));
+  ASSERT_FALSE(IsSpilled(object_id1));
+
+  // Deleting a spilled object removes it from the spill directory.
+  ARROW_CHECK_OK(client.Delete(object_id2));
+  ASSERT_FALSE(IsSpilled(object_id2));
+  ARROW_CHECK_OK(client2_.Contains(object_id2, &has_object));
+  ASSERT_FALSE(has_object);
+  ARROW_CHECK_OK(client.Disconnect());
+}
+
 #ifdef PLASMA_GPU
 using arrow::gpu::CudaBuffer;
 using arrow::gpu::CudaBufferReader;
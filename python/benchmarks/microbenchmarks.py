@@ -15,6 +15,8 @@
 # specific language governing permissions and limitations
 # under the License.
 
+import numpy as np
+
 import pyarrow.benchmark as pb
 
 from . import common
@@ -43,3 +45,29 @@ class PandasObjectIsNull(object):
 
     def time_PandasObjectIsNull(self, *args):
         pb.benchmark_PandasObjectIsNull(self.lst)
+
+
+class NdarraysToArrow(object):
+    """
+    Convert several object ndarrays of strings, like the string columns of a
+    DataFrame, with and without threads.
+    """
+    size = 10 ** 5
+    num_arrays = 8
+
+    param_names = ['type', 'use_threads']
+    params = [('ascii', 'unicode'), (False, True)]
+
+    def setup(self, type_name, use_threads):
+        gen = common.BuiltinsGenerator()
+        if type_name == 'ascii':
+            lst = gen.generate_ascii_string_list(self.size, 5, 50)
+        elif type_name == 'unicode':
+            lst = gen.generate_unicode_string_list(self.size, 5, 50)
+        else:
+            assert 0
+        self.arrays = [np.array(lst, dtype=object)
+                       for i in range(self.num_arrays)]
+
+    def time_NdarraysToArrow(self, type_name, use_threads):
+        pb.benchmark_NdarraysToArrow(self.arrays, use_threads)
@@ -602,7 +602,7 @@ cdef class Array:
 
     def to_pandas(self, bint strings_to_categorical=False,
                   bint zero_copy_only=False, bint integer_object_nulls=False,
-                  bint date_as_object=False):
+                  bint date_as_object=False, bint deduplicate_objects=False):
         """
         Convert to a NumPy array object suitable for use in pandas.
 
@@ -617,6 +617,9 @@ cdef class Array:
             Cast integers with nulls to objects
         date_as_object : boolean, default False
             Cast dates to objects
+        deduplicate_objects : boolean, default False
+            Create a single Python object for equal string and binary values,
+            which reduces memory use when values are repeated
 
         See also
         --------
@@ -633,7 +636,8 @@ cdef class Array:
             zero_copy_only=zero_copy_only,
             integer_object_nulls=integer_object_nulls,
             date_as_object=date_as_object,
-            use_threads=False)
+            use_threads=False,
+            deduplicate_objects=deduplicate_objects)
         with nogil:
             check_status(ConvertArrayToPandas(options, self.sp_array,
                                               self, &out))
@@ -18,3 +18,7 @@
 
 def benchmark_PandasObjectIsNull(list obj):
     Benchmark_PandasObjectIsNull(obj)
+
+
+def benchmark_NdarraysToArrow(list arrays, c_bool use_threads):
+    Benchmark_NdarraysToArrow(arrays, use_threads)
@@ -1070,6 +1070,7 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         c_bool integer_object_nulls
         c_bool date_as_object
         c_bool use_threads
+        c_bool deduplicate_objects
 
 cdef extern from "arrow/python/api.h" namespace 'arrow::py' nogil:
 
@@ -1111,6 +1112,7 @@ cdef extern from 'arrow/python/inference.h' namespace 'arrow::py':
 
 cdef extern from 'arrow/python/benchmark.h' namespace 'arrow::py::benchmark':
     void Benchmark_PandasObjectIsNull(object lst) except *
+    void Benchmark_NdarraysToArrow(object lst, c_bool use_threads) except *
 
 
 cdef extern from 'arrow/util/compression.h' namespace 'arrow' nogil:
@@ -141,7 +141,7 @@ cdef class ChunkedArray:
 
     def to_pandas(self, bint strings_to_categorical=False,
                   bint zero_copy_only=False, bint integer_object_nulls=False,
-                  bint date_as_object=False):
+                  bint date_as_object=False, bint deduplicate_objects=False):
         """
         Convert the arrow::ChunkedArray to an array object suitable for use
         in pandas
@@ -157,6 +157,9 @@ cdef class ChunkedArray:
             Cast integers with nulls to objects
         date_as_object : boolean, default False
             Cast dates to objects
+        deduplicate_objects : boolean, default False
+            Create a single Python object for equal string and binary values,
+            which reduces memory use when values are repeated
 
         See also
         --------
@@ -171,7 +174,8 @@ cdef class ChunkedArray:
             zero_copy_only=zero_copy_only,
             integer_object_nulls=integer_object_nulls,
             date_as_object=date_as_object,
-            use_threads=False)
+            use_threads=False,
+            deduplicate_objects=deduplicate_objects)
 
         with nogil:
             check_status(libarrow.ConvertChunkedArrayToPandas(
@@ -501,7 +505,7 @@ cdef class Column:
 
     def to_pandas(self, bint strings_to_categorical=False,
                   bint zero_copy_only=False, bint integer_object_nulls=False,
-                  bint date_as_object=False):
+                  bint date_as_object=False, bint deduplicate_objects=False):
         """
         Convert the arrow::Column to a pandas.Series
 
@@ -516,6 +520,9 @@ cdef class Column:
             Cast integers with nulls to objects
         date_as_object : boolean, default False
             Cast dates to objects
+        deduplicate_objects : boolean, default False
+            Create a single Python object for equal string and binary values,
+            which reduces memory use when values are repeated
 
         Returns
         -------
@@ -525,7 +532,8 @@ cdef class Column:
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
             date_as_object=date_as_object,
-            integer_object_nulls=integer_object_nulls)
+            integer_object_nulls=integer_object_nulls,
+            deduplicate_objects=deduplicate_objects)
         result = pd.Series(values, name=self.name)
 
         if isinstance(self.type, TimestampType):
@@ -888,7 +896,7 @@ cdef class RecordBatch:
     def to_pandas(self, MemoryPool memory_pool=None, categories=None,
                   bint strings_to_categorical=False, bint zero_copy_only=False,
                   bint integer_object_nulls=False, bint date_as_object=False,
-                  bint use_threads=True):
+                  bint use_threads=True, bint deduplicate_objects=False):
         """
         Convert the arrow::RecordBatch to a pandas DataFrame
 
@@ -909,6 +917,9 @@ cdef class RecordBatch:
             Cast dates to objects
         use_threads: boolean, default True
             Whether to parallelize the conversion using multiple threads
+        deduplicate_objects : boolean, default False
+            Create a single Python object for equal string and binary values,
+            which reduces memory use when values are repeated
 
         Returns
         -------
@@ -919,7 +930,8 @@ cdef class RecordBatch:
             strings_to_categorical=strings_to_categorical,
             zero_copy_only=zero_copy_only,
             integer_object_nulls=integer_object_nulls,
-            date_as_object=date_as_object, use_threads=use_threads
+            date_as_object=date_as_object, use_threads=use_threads,
+            deduplicate_objects=deduplicate_objects
         )
 
     @classmethod
@@ -1371,7 +1383,7 @@ cdef class Table:
     def to_pandas(self, MemoryPool memory_pool=None, categories=None,
                   bint strings_to_categorical=False, bint zero_copy_only=False,
                   bint integer_object_nulls=False, bint date_as_object=False,
-                  bint use_threads=True):
+                  bint use_threads=True, bint deduplicate_objects=False):
         """
         Convert the arrow::Table to a pandas DataFrame
 
@@ -1392,6 +1404,9 @@ cdef class Table:
             Cast dates to objects
         use_threads: boolean, default True
             Whether to parallelize the conversion using multiple threads
+        deduplicate_objects : boolean, default False
+            Create a single Python object for equal string and binary values,
+            which reduces memory use when values are repeated
 
         Returns
         -------
@@ -1405,7 +1420,8 @@ cdef class Table:
             zero_copy_only=zero_copy_only,
             integer_object_nulls=integer_object_nulls,
             date_as_object=date_as_object,
-            use_threads=use_threads)
+            use_threads=use_threads,
+            deduplicate_objects=deduplicate_objects)
 
         mgr = pdcompat.table_to_blockmanager(options, self, memory_pool,
                                              categories)
@@ -1402,6 +1402,20 @@ class TestConvertStringLikeTypes(object):
             arr = np.array([b'foo', b'bar', b'baz'], dtype='|U3')
             pa.array(arr, type=pa.binary(3))
 
+    def test_deduplicate_objects(self):
+        values = [u'foo', None, u'bar', u'foo', u'bar']
+        table = pa.Table.from_pandas(pd.DataFrame({'strings': values * 10}))
+
+        result = table.to_pandas(deduplicate_objects=True)
+        tm.assert_frame_equal(result, table.to_pandas())
+        strings = result['strings']
+        assert strings[0] is strings[3]
+        assert strings[2] is strings[9]
+
+        arr = pa.array([b'ab', b'cd', b'ab'], type=pa.binary(2))
+        result = arr.to_pandas(deduplicate_objects=True)
+        assert result[0] is result[2]
+
 
 class TestConvertDecimalTypes(object):
     """
@@ -1969,6 +1983,19 @@ class TestConvertMisc(object):
     def test_non_threaded_conversion(self):
         _non_threaded_conversion()
 
+    def test_threaded_conversion_large_columns(self):
+        # Tall fixed-width columns are converted in row slices
+        n = 300000
+        df = pd.DataFrame({
+            'ints': np.arange(n, dtype=np.int64),
+            'floats': np.random.randn(n),
+            'floats_with_nulls': [None if i % 7 == 0 else float(i)
+                                  for i in range(n)],
+            'bools': np.arange(n) % 3 == 0,
+            'timestamps': pd.date_range('2000-01-01', periods=n, freq='s'),
+        })
+        _check_pandas_roundtrip(df, use_threads=True)
+
     def test_threaded_conversion_multiprocess(self):
         # Parallel conversion should work from child processes too (ARROW-2963)
         pool = mp.Pool(2)